@@ -0,0 +1,49 @@
+# ----------------------------------------------------------------------------------------
+# Micro-benchmark of the 3D Maxwell solvers (Maxwell-Ampere + Maxwell-Faraday) on a single patch
+#
+#   python bench_maxwell_solvers.py /path/to/smilei [cells per side] [steps]
+#
+# Runs tst3d_vacuum_solvers.py with 1 MPI process and 1 thread for each solver, and reads
+# the "Maxwell" timer. The bytes per cell are NOT measured: they are an estimate, counting
+# one read or write of one value per array streamed by the solvers at each step (no cache
+# reuse, no write-allocate traffic). The bandwidth column is this estimate times cells/s,
+# i.e. a lower bound of the memory traffic only if the arrays do not fit in cache.
+# ----------------------------------------------------------------------------------------
+import os, sys, subprocess, re, tempfile
+
+smilei = os.path.abspath(sys.argv[1])
+ncells = int(sys.argv[2]) if len(sys.argv)>2 else 64
+nsteps = int(sys.argv[3]) if len(sys.argv)>3 else 100
+namelist = os.path.join(os.path.dirname(os.path.abspath(__file__)), "tst3d_vacuum_solvers.py")
+
+# Estimated arrays read or written at each step, per cell
+#   Maxwell-Ampere : E read & written, B and J read
+#   Yee Maxwell-Faraday (out of place) : B_m and E read, B written
+#   Lehe Maxwell-Faraday (in place) : B read & written, E read ; B_m saved by a copy of B
+arrays = {
+    "Yee"  : 12 + 9,
+    "Lehe" : 12 + 9 + 6,
+}
+
+# Size of the field values (8, or 4 if compiled with config=float_fields)
+field_bytes = int(os.environ.get("SMILEI_BENCH_FIELD_BYTES", "8"))
+
+print("%-6s %14s %12s %16s %16s" % ("solver", "cells/s", "s/step", "est. bytes/cell", "est. GB/s"))
+for solver in ["Yee", "Lehe"]:
+    env = dict(os.environ, SMILEI_BENCH_SOLVER=solver, SMILEI_BENCH_CELLS=str(ncells),
+               SMILEI_BENCH_STEPS=str(nsteps), OMP_NUM_THREADS="1")
+    rundir = tempfile.mkdtemp(prefix="bench_"+solver+"_")
+    out = subprocess.run([smilei, namelist], cwd=rundir, env=env,
+                         stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    m = re.search(r"Maxwell\s+([0-9.eE+-]+)", out)
+    if m is None:
+        print("%-6s failed, see %s" % (solver, rundir))
+        open(os.path.join(rundir, "smilei.log"), "w").write(out)
+        continue
+    time = float(m.group(1))
+    # Cells of the patch, ghost cells included
+    ntot = (ncells+5)**3
+    bytes_per_cell = arrays[solver]*field_bytes
+    print("%-6s %14.4g %12.4g %16d %16.4g" % (solver, ntot*nsteps/time, time/nsteps, bytes_per_cell,
+          bytes_per_cell*ntot*nsteps/time*1e-9))
+print("(est. = estimated from the arrays streamed by each solver, not measured)")
@@ -0,0 +1,85 @@
+# ----------------------------------------------------------------------------------------
+# Comparison of the PSATD solver (is_spectral) with the Yee solver in 2D
+#
+#   python bench_psatd_vs_yee.py /path/to/smilei [norder] [mpirun command]
+#
+# Runs tst2d_psatd_vs_yee.py for both solvers, for a standing wave along x and along the
+# diagonal, at 16, 8 and 4 cells per wavelength along x. For each run:
+#   - dispersion : numerical phase velocity w/k - 1, w being measured from the oscillation
+#     of the energy exchanged between Ez and B, and the value expected from the dispersion
+#     relation of the solver (Yee, or finite differences of order norder for PSATD)
+#   - accuracy   : maximum relative variation of the electromagnetic energy
+#   - timing     : "Maxwell" timer and time loop, per step
+# PSATD requires Smilei compiled with FFTW=TRUE.
+# ----------------------------------------------------------------------------------------
+import os, sys, subprocess, re, tempfile, math, shlex
+
+smilei = os.path.abspath(sys.argv[1])
+norder = int(sys.argv[2]) if len(sys.argv)>2 else 16
+mpirun = shlex.split(sys.argv[3]) if len(sys.argv)>3 else []
+ncells = 64
+nsteps = 400
+namelist = os.path.join(os.path.dirname(os.path.abspath(__file__)), "tst2d_psatd_vs_yee.py")
+
+dx = 1.
+dt = 0.95*dx/math.sqrt(2.)
+
+def k_eff(k, p):
+    # Modified wave number of the staggered finite differences of order p (see PSATD_Solver)
+    h = p//2
+    s = 0.
+    for l in range(1, h+1):
+        log_c = (1-h)*math.log(16.) + 2*math.lgamma(p) - 2*math.log(2*l-1) \
+              - math.lgamma(h+l) - math.lgamma(h-l+1) - 2*math.lgamma(h)
+        s += (1 if l%2 else -1) * math.exp(log_c) * math.sin((2*l-1)*0.5*k*dx)
+    return 2./dx*s
+
+def expected_omega(solver, kx, ky):
+    if solver == "Yee":
+        s = math.sqrt(k_eff(kx, 2)**2 + k_eff(ky, 2)**2)*dt/2.
+        return 2./dt*math.asin(min(s, 1.))
+    return math.sqrt(k_eff(kx, norder)**2 + k_eff(ky, norder)**2)
+
+def load_scalars(rundir):
+    lines = open(os.path.join(rundir, "scalars.txt")).readlines()
+    names = [l.split()[2] for l in lines if l.startswith("# ") and len(l.split())==3]
+    rows = [list(map(float, l.split())) for l in lines if not l.startswith("#")]
+    return {n: [r[i] for r in rows] for i, n in enumerate(names)}
+
+def measured_omega(s):
+    # Ez^2 - B^2 ~ cos(2 w t) : zero crossings every pi/(2 w)
+    x = [ez - bx - by for ez, bx, by in zip(s["Uelm_Ez"], s["Uelm_Bx_m"], s["Uelm_By_m"])]
+    t = s["time"]
+    mean = sum(x)/len(x)
+    x = [v-mean for v in x]
+    crossings = [t[i] - x[i]*(t[i+1]-t[i])/(x[i+1]-x[i]) for i in range(len(x)-1) if x[i]*x[i+1] < 0.]
+    if len(crossings) < 2:
+        return float("nan")
+    return math.pi*(len(crossings)-1)/(2.*(crossings[-1]-crossings[0]))
+
+print("%-6s %5s %11s %13s %13s %12s %12s %12s" % ("solver", "angle", "cells/wvl", "vphi-1",
+      "vphi-1 theory", "max dU/U", "Maxwell/step", "loop/step"))
+for angle in [0, 45]:
+    for nwave in [4, 8, 16]:
+        kx = 2.*math.pi*nwave/(ncells*dx)
+        ky = kx if angle==45 else 0.
+        k = math.sqrt(kx**2 + ky**2)
+        for solver in ["Yee", "PSATD"]:
+            env = dict(os.environ, SMILEI_BENCH_SOLVER=solver, SMILEI_BENCH_CELLS=str(ncells),
+                       SMILEI_BENCH_NWAVE=str(nwave), SMILEI_BENCH_ANGLE=str(angle),
+                       SMILEI_BENCH_NORDER=str(norder), SMILEI_BENCH_STEPS=str(nsteps))
+            rundir = tempfile.mkdtemp(prefix="bench_%s_%d_%d_" % (solver, angle, nwave))
+            out = subprocess.run(mpirun+[smilei, namelist], cwd=rundir, env=env,
+                                 stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True).stdout
+            open(os.path.join(rundir, "smilei.log"), "w").write(out)
+            m = re.search(r"Maxwell\s+([0-9.eE+-]+)", out)
+            l = re.search(r"Time in time loop :\s+([0-9.eE+-]+)", out)
+            if m is None or l is None:
+                print("%-6s %5d %11d failed, see %s" % (solver, angle, ncells//nwave, rundir))
+                continue
+            s = load_scalars(rundir)
+            U0 = s["Uelm"][0]
+            dU = max(abs(u/U0-1.) for u in s["Uelm"])
+            print("%-6s %5d %11d %13.3e %13.3e %12.3e %12.4g %12.4g" % (solver, angle, ncells//nwave,
+                  measured_omega(s)/k-1., expected_omega(solver, kx, ky)/k-1., dU,
+                  float(m.group(1))/nsteps, float(l.group(1))/nsteps))
@@ -0,0 +1,51 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PSATD / YEE COMPARISON
+#
+# Standing wave Ez = sin(kx x + ky y) cos(w t) in a periodic 2D box, without particles.
+# The energy exchanged between Ez and B oscillates at 2 w, from which
+# bench_psatd_vs_yee.py measures the numerical phase velocity w/k.
+# Run through bench_psatd_vs_yee.py, which sets the environment variables below.
+# ----------------------------------------------------------------------------------------
+import math, os
+
+solver = os.environ.get("SMILEI_BENCH_SOLVER", "Yee")      # "Yee" or "PSATD"
+ncells = int(os.environ.get("SMILEI_BENCH_CELLS", "64"))    # cells per side of the box
+nwave  = int(os.environ.get("SMILEI_BENCH_NWAVE", "8"))     # wavelengths along x in the box
+angle  = int(os.environ.get("SMILEI_BENCH_ANGLE", "0"))     # 0 or 45 degrees
+norder = int(os.environ.get("SMILEI_BENCH_NORDER", "16"))
+nsteps = int(os.environ.get("SMILEI_BENCH_STEPS", "400"))
+
+dx = 1.
+dt = 0.95*dx/math.sqrt(2.)
+kx = 2.*math.pi*nwave/(ncells*dx)
+ky = kx if angle==45 else 0.
+
+spectral = dict( is_spectral = True, norder = [norder]*2, global_factor = [2, 2] ) if solver=="PSATD" else {}
+
+Main(
+    geometry = "2Dcartesian",
+    interpolation_order = 2,
+
+    cell_length = [dx, dx],
+    grid_length  = [ncells*dx]*2,
+    number_of_patches = [2, 2],
+
+    timestep = dt,
+    simulation_time = dt*nsteps,
+
+    EM_boundary_conditions = [ ["periodic"] ],
+
+    print_every = nsteps,
+    random_seed = smilei_mpi_rank,
+    **spectral
+)
+
+ExternalField(
+    field = "Ez",
+    profile = lambda x,y: math.sin(kx*x + ky*y)
+)
+
+DiagScalar(
+    every = 1,
+    vars = ["Uelm", "Uelm_Ez", "Uelm_Bx_m", "Uelm_By_m"]
+)
@@ -0,0 +1,39 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE SOLVERS BENCHMARK
+#
+# Fields in vacuum on a single 3D patch: only the Maxwell solvers are at work.
+# Run through bench_maxwell_solvers.py, which sets the environment variables below.
+# ----------------------------------------------------------------------------------------
+import math, os
+
+solver = os.environ.get("SMILEI_BENCH_SOLVER", "Yee")
+ncells = int(os.environ.get("SMILEI_BENCH_CELLS", "64"))
+nsteps = int(os.environ.get("SMILEI_BENCH_STEPS", "100"))
+
+Main(
+    geometry = "3Dcartesian",
+    interpolation_order = 2,
+    
+    cell_length = [1., 1., 1.],
+    grid_length  = [float(ncells)]*3,
+    number_of_patches = [1, 1, 1],
+    
+    timestep = 0.5,
+    simulation_time = 0.5*nsteps,
+    
+    maxwell_solver = solver,
+    EM_boundary_conditions = [ ["periodic"] ],
+    
+    print_every = nsteps,
+    random_seed = smilei_mpi_rank
+)
+
+# A standing wave, so that the fields are not zero
+ExternalField(
+    field = "Ey",
+    profile = lambda x,y,z: math.sin(2.*math.pi*x/ncells)
+)
+ExternalField(
+    field = "Bz",
+    profile = lambda x,y,z: math.cos(2.*math.pi*x/ncells)
+)
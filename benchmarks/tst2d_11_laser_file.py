@@ -0,0 +1,75 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Lasers injected from fields tabulated in HDF5 files (Laser.file) :
+#   - from xmin, a pulse tabulated on a time axis coarser than the timestep
+#   - from xmax, a single time slab, constant in time after time_start
+#
+# The files are in the databases directory, and were generated by :
+#
+#   dx, N = 0.2, 64
+#   def By(y,t): return math.exp(-(y-6.)**2/4.-(t-4.)**2/4.)*math.sin(t-0.1*y)
+#   def Bz(y,t): return 0.5*math.exp(-(y-7.)**2/4.-(t-4.)**2/4.)*math.cos(t)
+#   with h5py.File("laser_file.h5", "w") as f:
+#       f.attrs["time_start"] = 0.
+#       f.attrs["time_step" ] = 0.25
+#       t = 0.25*np.arange(50)
+#       # By at the primal y points j*dy, Bz at the dual y points (j-1/2)*dy
+#       f["By"] = [[By( j     *dx, ti) for j in range(N+1)] for ti in t]
+#       f["Bz"] = [[Bz((j-0.5)*dx, ti) for j in range(N+2)] for ti in t]
+#   with h5py.File("laser_single_slab.h5", "w") as f:
+#       f.attrs["time_start"] = 6.
+#       f["By"] = [[0.1*math.exp(-(j*dx-6.4)**2/4.) for j in range(N+1)]]
+
+dx = 0.2
+dt = 0.1
+N = 64
+Tsim = 12.
+
+Main(
+    geometry = "2Dcartesian",
+
+    interpolation_order = 2,
+
+    cell_length = [dx, dx],
+    grid_length  = [N*dx, N*dx],
+
+    number_of_patches = [ 4, 4 ],
+
+    timestep = dt,
+    simulation_time = Tsim,
+
+    EM_boundary_conditions = [ ['silver-muller'] ],
+
+    random_seed = smilei_mpi_rank
+)
+
+Laser(
+    box_side = "xmin",
+    file     = "laser_file.h5"
+)
+
+Laser(
+    box_side = "xmax",
+    file     = "laser_single_slab.h5"
+)
+
+DiagScalar(every = 5)
+
+DiagProbe(
+    every = 1,
+    origin = [2., 6.4],
+    fields = ['By', 'Bz']
+)
+
+DiagProbe(
+    every = 1,
+    origin = [N*dx-1., 6.4],
+    fields = ['By', 'Bz']
+)
+
+DiagFields(
+    every = 40,
+    fields = ['By', 'Bz']
+)
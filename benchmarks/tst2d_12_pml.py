@@ -0,0 +1,55 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Absorption of a laser pulse at oblique incidence by the PML boundary condition at xmax.
+# The pulse enters from xmin at 30 degrees; once it has left the box through xmax, the energy
+# remaining in the box is the reflected one (measured at t_measure, before it reaches xmin).
+# A silver-muller boundary would reflect a fraction ((1-cos(angle))/(1+cos(angle)))**2 of it.
+
+from math import pi, cos, sin
+
+dx = 0.2
+Lsim = [51.2, 38.4]
+angle = pi/6.
+t_measure = 110.
+
+Main(
+    geometry = "2Dcartesian",
+
+    interpolation_order = 2,
+
+    cell_length = [dx, dx],
+    grid_length  = Lsim,
+
+    number_of_patches = [ 8, 4 ],
+
+    timestep = 0.13,
+    simulation_time = t_measure,
+
+    EM_boundary_conditions = [
+        ["silver-muller", "PML"],
+        ["periodic"],
+    ],
+    EM_boundary_conditions_k = [[cos(angle), sin(angle)],[-1.,0.],[0.,1.],[0.,-1.]],
+    number_of_pml_cells = 10,
+
+    random_seed = smilei_mpi_rank
+)
+
+LaserGaussian2D(
+    box_side        = "xmin",
+    a0              = 1.,
+    omega           = 1.,
+    focus           = [10., Lsim[1]/2.],
+    waist           = 8.,
+    incidence_angle = angle,
+    time_envelope   = tgaussian(fwhm=12., center=20.)
+)
+
+DiagScalar(every = 5)
+
+DiagFields(
+    every = 250,
+    fields = ['Ex', 'Ey', 'Bz']
+)
@@ -0,0 +1,89 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Laser in a thin plasma slab, with the fields of the patches of each MPI process gathered
+# in a single grid (Main.supergrid). The patches are consecutive along X.
+
+dx = 0.2
+Lsim = [25.6, 3.2, 3.2]
+Tsim = 20.
+
+Main(
+    geometry = "3Dcartesian",
+
+    interpolation_order = 2,
+
+    cell_length = [dx, dx, dx],
+    grid_length  = Lsim,
+
+    number_of_patches = [ 8, 1, 1 ],
+
+    timestep = 0.1,
+    simulation_time = Tsim,
+
+    EM_boundary_conditions = [
+        ["silver-muller"],
+        ["periodic"],
+        ["periodic"],
+    ],
+
+    supergrid = True,
+
+    random_seed = smilei_mpi_rank
+)
+
+Species(
+    name = "electron",
+    position_initialization = "regular",
+    momentum_initialization = "maxwell-juettner",
+    temperature = [0.01],
+    particles_per_cell = 8,
+    mass = 1.,
+    charge = -1.,
+    number_density = trapezoidal(0.5, xvacuum=10., xplateau=8.),
+    boundary_conditions = [
+        ["remove"],
+        ["periodic"],
+        ["periodic"],
+    ]
+)
+
+Species(
+    name = "ion",
+    position_initialization = "regular",
+    momentum_initialization = "cold",
+    particles_per_cell = 8,
+    mass = 1836.,
+    charge = 1.,
+    number_density = trapezoidal(0.5, xvacuum=10., xplateau=8.),
+    boundary_conditions = [
+        ["remove"],
+        ["periodic"],
+        ["periodic"],
+    ]
+)
+
+LaserPlanar1D(
+    box_side      = "xmin",
+    a0            = 1.,
+    omega         = 1.,
+    polarization_phi = 0.3,
+    ellipticity   = 0.5,
+    time_envelope = tgaussian(fwhm=6., center=8.)
+)
+
+ExternalField(
+    field = "Bx",
+    profile = 0.1
+)
+
+DiagScalar(every = 5)
+
+DiagProbe(
+    every = 5,
+    origin = [0., Lsim[1]/2., Lsim[2]/2.],
+    corners = [[Lsim[0], Lsim[1]/2., Lsim[2]/2.]],
+    number = [128],
+    fields = ['Ey', 'Ez', 'Bx', 'By', 'Bz', 'Jy', 'Rho']
+)
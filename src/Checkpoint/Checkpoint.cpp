@@ -345,6 +345,20 @@ void Checkpoint::dumpPatch( ElectroMagn* EMfields, std::vector<Species*> vecSpec
         }
     }
     
+    // Auxiliary fields of the PML boundary conditions
+    for (unsigned int bcId=0 ; bcId<EMfields->emBoundCond.size() ; bcId++ ) {
+        if(! EMfields->emBoundCond[bcId]) continue;
+        vector<Field*> pml = EMfields->emBoundCond[bcId]->pmlFields();
+        if ( pml.size()==0 ) continue;
+        ostringstream name("");
+        name << setfill('0') << setw(2) << bcId;
+        string groupName=Tools::merge("EM_boundary-PML-",name.str());
+        hid_t gid = H5::group(patch_gid, groupName);
+        for (unsigned int i=0 ; i<pml.size() ; i++ )
+            dumpFieldsPerProc(gid, pml[i] );
+        H5Gclose(gid);
+    }
+    
     H5Fflush( patch_gid, H5F_SCOPE_GLOBAL );
     H5::attr(patch_gid, "species", vecSpecies.size());
     
@@ -581,6 +595,20 @@ void Checkpoint::restartPatch( ElectroMagn* EMfields,std::vector<Species*> &vecS
         }
     }
     
+    // Auxiliary fields of the PML boundary conditions
+    for (unsigned int bcId=0 ; bcId<EMfields->emBoundCond.size() ; bcId++ ) {
+        if(! EMfields->emBoundCond[bcId]) continue;
+        vector<Field*> pml = EMfields->emBoundCond[bcId]->pmlFields();
+        if ( pml.size()==0 ) continue;
+        ostringstream name("");
+        name << setfill('0') << setw(2) << bcId;
+        string groupName=Tools::merge("EM_boundary-PML-",name.str());
+        hid_t gid = H5Gopen(patch_gid, groupName.c_str(),H5P_DEFAULT);
+        for (unsigned int i=0 ; i<pml.size() ; i++ )
+            restartFieldsPerProc(gid, pml[i] );
+        H5Gclose(gid);
+    }
+    
     unsigned int vecSpeciesSize=0;
     H5::getAttr(patch_gid, "species", vecSpeciesSize );
     
@@ -640,7 +668,7 @@ void Checkpoint::dumpFieldsPerProc(hid_t fid, Field* field)
     hsize_t dims[1]={field->globalDims_};
     hid_t sid = H5Screate_simple (1, dims, NULL);
     hid_t did = H5Dcreate (fid, field->name.c_str(), H5T_NATIVE_DOUBLE, sid, H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
-    H5Dwrite(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &field->data_[0]);
+    H5Dwrite(did, SMILEI_H5T_FIELD, H5S_ALL, H5S_ALL, H5P_DEFAULT, &field->data_[0]);
     H5Dclose (did);
     H5Sclose(sid);
 }
@@ -648,7 +676,7 @@ void Checkpoint::dumpFieldsPerProc(hid_t fid, Field* field)
 void Checkpoint::restartFieldsPerProc(hid_t fid, Field* field)
 {
     hid_t did = H5Dopen (fid, field->name.c_str(),H5P_DEFAULT);
-    H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &field->data_[0]);
+    H5Dread(did, SMILEI_H5T_FIELD, H5S_ALL, H5S_ALL, H5P_DEFAULT, &field->data_[0]);
     H5Dclose (did);
 }
 
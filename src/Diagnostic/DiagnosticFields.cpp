@@ -337,7 +337,8 @@ void DiagnosticFields::run( SmileiMPI* smpi, VectorPatch& vecPatches, int itime,
 
 bool DiagnosticFields::needsRhoJs(int itime)
 {
-    return hasRhoJs && timeSelection->theTimeIsNow(itime);
+    // The whole time-average window needs the fields per species (only allocated on these timesteps)
+    return hasRhoJs && ( timeSelection->previousTime(itime) > itime - time_average );
 }
 
 // SUPPOSED TO BE EXECUTED ONLY BY MASTER MPI
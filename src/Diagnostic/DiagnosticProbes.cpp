@@ -500,7 +500,7 @@ void DiagnosticProbes::run( SmileiMPI* smpi, VectorPatch& vecPatches, int timest
                 H5Pclose(plist_id);
                 // Write
                 if ( nPart_MPI>0 )
-                    H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, &((*posArray)(0,0)) );
+                    H5Dwrite( dset_id, SMILEI_H5T_FIELD, memspace, filespace, transfer, &((*posArray)(0,0)) );
                 else
                     H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, NULL );
                 H5Dclose(dset_id);
@@ -587,7 +587,7 @@ void DiagnosticProbes::run( SmileiMPI* smpi, VectorPatch& vecPatches, int timest
         hid_t transfer = H5Pcreate(H5P_DATASET_XFER);
         H5Pset_dxpl_mpio(transfer, H5FD_MPIO_INDEPENDENT);
         // Write
-        H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, probesArray->data_ );
+        H5Dwrite( dset_id, SMILEI_H5T_FIELD, memspace, filespace, transfer, probesArray->data_ );
         H5Dclose(dset_id);
         H5Pclose( transfer );
         H5Sclose(filespace);
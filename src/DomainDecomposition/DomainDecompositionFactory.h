@@ -45,15 +45,16 @@ public:
         return domain_decomposition;
     }
 
-    static DomainDecomposition* createGlobal(Params& params) {
+    //! Decomposition in domains of global_factor patches along each dimension
+    static DomainDecomposition* createGlobal(Params& params, std::vector<unsigned int> global_factor) {
         DomainDecomposition* domain_decomposition = NULL;
 
         if ( ( params.geometry == "1Dcartesian" ) )
-            domain_decomposition = new GlobalDomainDecomposition1D( params );
+            domain_decomposition = new GlobalDomainDecomposition1D( params, global_factor );
         else if ( ( params.geometry == "2Dcartesian" ) ) 
-            domain_decomposition = new GlobalDomainDecomposition2D( params );
+            domain_decomposition = new GlobalDomainDecomposition2D( params, global_factor );
         else if ( ( params.geometry == "3Dcartesian" ) ) 
-            domain_decomposition = new GlobalDomainDecomposition3D( params );
+            domain_decomposition = new GlobalDomainDecomposition3D( params, global_factor );
         else
             ERROR( "Unknown geometry" );
 
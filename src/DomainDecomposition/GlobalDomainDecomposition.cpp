@@ -1,16 +1,17 @@
 #include "GlobalDomainDecomposition.h"
 
 
-GlobalDomainDecomposition::GlobalDomainDecomposition( Params& params )
-    : DomainDecomposition( params )
+GlobalDomainDecomposition::GlobalDomainDecomposition( Params& params, std::vector<unsigned int> global_factor )
+    : DomainDecomposition( params ),
+      global_factor_( global_factor )
 {
     ndomain_ = params.number_of_patches;
     block_size_.resize( ndomain_.size(), 2 );
 }
 
 
-GlobalDomainDecomposition1D::GlobalDomainDecomposition1D( Params& params )
-    : GlobalDomainDecomposition( params )
+GlobalDomainDecomposition1D::GlobalDomainDecomposition1D( Params& params, std::vector<unsigned int> global_factor )
+    : GlobalDomainDecomposition( params, global_factor )
 {
 }
 
@@ -44,8 +45,8 @@ std::vector<unsigned int> GlobalDomainDecomposition1D::getDomainCoordinates( uns
 }
 
 
-GlobalDomainDecomposition2D::GlobalDomainDecomposition2D( Params& params )
-    : GlobalDomainDecomposition( params )
+GlobalDomainDecomposition2D::GlobalDomainDecomposition2D( Params& params, std::vector<unsigned int> global_factor )
+    : GlobalDomainDecomposition( params, global_factor )
 {
 }
 
@@ -83,8 +84,8 @@ std::vector<unsigned int> GlobalDomainDecomposition2D::getDomainCoordinates( uns
 }
 
 
-GlobalDomainDecomposition3D::GlobalDomainDecomposition3D( Params& params )
-    : GlobalDomainDecomposition( params )
+GlobalDomainDecomposition3D::GlobalDomainDecomposition3D( Params& params, std::vector<unsigned int> global_factor )
+    : GlobalDomainDecomposition( params, global_factor )
 {
 }
 
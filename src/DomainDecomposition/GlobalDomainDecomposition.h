@@ -6,12 +6,15 @@
 class GlobalDomainDecomposition : public DomainDecomposition
 {
 public:
-    GlobalDomainDecomposition( Params& params );
+    GlobalDomainDecomposition( Params& params, std::vector<unsigned int> global_factor );
     virtual ~GlobalDomainDecomposition( ) {};
 
     virtual unsigned int getDomainId( std::vector<int> Coordinates ) = 0;
     virtual std::vector<unsigned int> getDomainCoordinates( unsigned int Id ) = 0;
 
+    //! Number of patches gathered in a domain along each dimension
+    std::vector<unsigned int> global_factor_;
+
 protected:
     std::vector<unsigned int> block_size_;
 
@@ -21,7 +24,7 @@ protected:
 class GlobalDomainDecomposition1D : public GlobalDomainDecomposition
 {
 public:
-    GlobalDomainDecomposition1D( Params& params );
+    GlobalDomainDecomposition1D( Params& params, std::vector<unsigned int> global_factor );
     ~GlobalDomainDecomposition1D( ) override final;
 
     unsigned int getDomainId( std::vector<int> Coordinates ) override final;
@@ -32,7 +35,7 @@ public:
 class GlobalDomainDecomposition2D : public GlobalDomainDecomposition
 {
 public:
-    GlobalDomainDecomposition2D( Params& params );
+    GlobalDomainDecomposition2D( Params& params, std::vector<unsigned int> global_factor );
     ~GlobalDomainDecomposition2D( ) override final;
 
     unsigned int getDomainId( std::vector<int> Coordinates ) override final;
@@ -43,7 +46,7 @@ public:
 class GlobalDomainDecomposition3D : public GlobalDomainDecomposition
 {
 public:
-    GlobalDomainDecomposition3D( Params& params );
+    GlobalDomainDecomposition3D( Params& params, std::vector<unsigned int> global_factor );
     ~GlobalDomainDecomposition3D( ) override final;
 
     unsigned int getDomainId( std::vector<int> Coordinates ) override final;
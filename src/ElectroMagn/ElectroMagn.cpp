@@ -14,6 +14,8 @@
 #include "Profile.h"
 #include "SolverFactory.h"
 #include "DomainDecompositionFactory.h"
+#include "GlobalDomainDecomposition.h"
+#include "PoissonMultigrid.h"
 
 using namespace std;
 
@@ -38,8 +40,9 @@ nrj_new_fields (  0.               )
     if ( !dynamic_cast<GlobalDomainDecomposition*>( domain_decomposition ) )
         n_space = params.n_space;
     else {
+        GlobalDomainDecomposition* global = static_cast<GlobalDomainDecomposition*>( domain_decomposition );
         for ( unsigned int i = 0 ; i < nDim_field ; i++ ) 
-            n_space[i] = params.n_space[i] * params.global_factor[i];
+            n_space[i] = params.n_space[i] * global->global_factor_[i];
     }
     
     // take useful things from params
@@ -51,8 +54,8 @@ nrj_new_fields (  0.               )
     
     emBoundCond = ElectroMagnBC_Factory::create(params, patch);
     
-    MaxwellAmpereSolver_  = SolverFactory::createMA(params);
-    MaxwellFaradaySolver_ = SolverFactory::createMF(params);
+    MaxwellAmpereSolver_  = SolverFactory::createMA(params, n_space);
+    MaxwellFaradaySolver_ = SolverFactory::createMF(params, n_space);
     
 }
 
@@ -78,8 +81,8 @@ nrj_new_fields ( 0. )
     
     emBoundCond = ElectroMagnBC_Factory::create(params, patch);
     
-    MaxwellAmpereSolver_  = SolverFactory::createMA(params);
-    MaxwellFaradaySolver_ = SolverFactory::createMF(params);
+    MaxwellAmpereSolver_  = SolverFactory::createMA(params, n_space);
+    MaxwellFaradaySolver_ = SolverFactory::createMF(params, n_space);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -109,6 +112,9 @@ void ElectroMagn::initElectroMagnQuantities()
     Jz_=NULL;
     rho_=NULL;
     
+    z_=NULL;
+    poisson_mg_=NULL;
+    
     
     // Species charge currents and density
     Jx_s.resize(n_species);
@@ -167,14 +173,13 @@ ElectroMagn::~ElectroMagn()
    if(Ex_ != NULL) delete Ex_;
    if(Ey_ != NULL) delete Ey_;
    if(Ez_ != NULL) delete Ez_;
+   // With spectral solvers, B_m may point to B (see saveMagneticFields)
+   if(Bx_m != NULL && Bx_m != Bx_) delete Bx_m;
+   if(By_m != NULL && By_m != By_) delete By_m;
+   if(Bz_m != NULL && Bz_m != Bz_) delete Bz_m;
    if(Bx_ != NULL) delete Bx_;
    if(By_ != NULL) delete By_;
    if(Bz_ != NULL) delete Bz_;
-   if (!is_pxr) {
-       if(Bx_m != NULL) delete Bx_m;
-       if(By_m != NULL) delete By_m;
-       if(Bz_m != NULL) delete Bz_m;
-   }
    if(Jx_ != NULL) delete Jx_;
    if(Jy_ != NULL) delete Jy_;
    if(Jz_ != NULL) delete Jz_;
@@ -259,8 +264,8 @@ void ElectroMagn::updateGridSize(Params &params, Patch* patch)
 // ---------------------------------------------------------------------------------------------------------------------
 // In the main program 
 //     - saveMagneticFields
-//     - solveMaxwellAmpere
-//     - solveMaxwellFaraday
+//     - solveMaxwellAmpere (+ applyPML_E)
+//     - solveMaxwellFaraday (+ applyPML_B)
 //     - boundaryConditions
 //     - vecPatches::exchangeB (patch & MPI sync)
 //     - centerMagneticFields
@@ -291,6 +296,20 @@ void ElectroMagn::boundaryConditions(int itime, double time_dual, Patch* patch,
 
 }
 
+void ElectroMagn::applyPML_E(Patch* patch)
+{
+    for (unsigned int i=0 ; i<emBoundCond.size() ; i++)
+        if (emBoundCond[i]!=NULL)
+            emBoundCond[i]->applyPML_E(this, patch);
+}
+
+void ElectroMagn::applyPML_B(Patch* patch)
+{
+    for (unsigned int i=0 ; i<emBoundCond.size() ; i++)
+        if (emBoundCond[i]!=NULL)
+            emBoundCond[i]->applyPML_B(this, patch);
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Method used to create a dump of the data contained in ElectroMagn
 // ---------------------------------------------------------------------------------------------------------------------
@@ -333,14 +352,45 @@ void ElectroMagn::restartRhoJ()
     rho_->put_to(0.);
 }
 
-void ElectroMagn::restartRhoJs()
+// ---------------------------------------------------------------------------------------------------------------------
+// Allocate the charge currents and densities of species requested by the diagnostics
+// - only on the timesteps where a diagnostic needs them (fields are initialized to 0)
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::allocateRhoJs()
+{
+    for (unsigned int ispec=0 ; ispec < n_species ; ispec++) {
+        if( Jx_s [ispec] && !Jx_s [ispec]->data_ ) Jx_s [ispec]->allocateDims(0,false);
+        if( Jy_s [ispec] && !Jy_s [ispec]->data_ ) Jy_s [ispec]->allocateDims(1,false);
+        if( Jz_s [ispec] && !Jz_s [ispec]->data_ ) Jz_s [ispec]->allocateDims(2,false);
+        if( rho_s[ispec] && !rho_s[ispec]->data_ ) rho_s[ispec]->allocateDims();
+    }
+}
+
+// Release the memory of a field per species, which gets back to its state before allocateDims
+static void releaseRhoJs( Field* field, vector<unsigned int>& dimPrim )
+{
+    if( !field || !field->data_ ) return;
+    field->deallocateDims();
+    field->dims_ = dimPrim;
+    field->isDual_.clear();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Release the charge currents and densities of species until the next timestep where a diagnostic needs them
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::deallocateRhoJs()
 {
     for (unsigned int ispec=0 ; ispec < n_species ; ispec++) {
-        if( Jx_s [ispec] ) Jx_s [ispec]->put_to(0.);
-        if( Jy_s [ispec] ) Jy_s [ispec]->put_to(0.);
-        if( Jz_s [ispec] ) Jz_s [ispec]->put_to(0.);
-        if( rho_s[ispec] ) rho_s[ispec]->put_to(0.);
+        releaseRhoJs( Jx_s [ispec], dimPrim );
+        releaseRhoJs( Jy_s [ispec], dimPrim );
+        releaseRhoJs( Jz_s [ispec], dimPrim );
+        releaseRhoJs( rho_s[ispec], dimPrim );
     }
+}
+
+void ElectroMagn::restartRhoJs()
+{
+    deallocateRhoJs();
     
     Jx_ ->put_to(0.);
     Jy_ ->put_to(0.);
@@ -379,6 +429,148 @@ double ElectroMagn::computeNRJ() {
     return nrj;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Multigrid preconditioner of the Poisson solver (see VectorPatch::solvePoisson)
+//     - each patch solves its residual with one V-cycle of the local multigrid on the whole patch, but the
+//       outermost ghost cells shared with a neighbour patch (not updated by compute_Ap), with homogeneous
+//       Dirichlet conditions beyond
+//     - the local solutions are summed on ghost cells (additive Schwarz method with overlap)
+//     - the correction of the agglomerated coarse grid (one node per patch) is added by addPoissonCoarseCorrection
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::initPoissonPreconditioner(Patch *patch, vector<double> coef)
+{
+    vector<unsigned int> n(3, 1);
+    vector<int> bc(3, PoissonMultigrid::MG_DIRICHLET);
+    for (unsigned int i=0 ; i<3 ; i++) {
+        poisson_mg_min_[i] = 0;
+        poisson_mg_max_[i] = 0;
+        if (i>=nDim_field) continue;
+        poisson_mg_min_[i] = patch->locateOnBorders(i, 0) ? 0 : 1;
+        poisson_mg_max_[i] = patch->locateOnBorders(i, 1) ? dimPrim[i]-1 : dimPrim[i]-2;
+        n[i] = poisson_mg_max_[i]-poisson_mg_min_[i]+1;
+    }
+    
+    poisson_mg_ = new PoissonMultigrid( n, coef, bc );
+    poisson_mg_f_.resize( n[0]*n[1]*n[2] );
+    poisson_mg_u_.resize( n[0]*n[1]*n[2] );
+    // primal in all directions, as rho
+    z_ = createField("Rho_Poisson_z");
+    
+} // initPoissonPreconditioner
+
+void ElectroMagn::applyPoissonPreconditioner()
+{
+    unsigned int n[3] = {1, 1, 1};
+    for (unsigned int i=0 ; i<nDim_field ; i++)
+        n[i] = dimPrim[i];
+    unsigned int *imin = poisson_mg_min_;
+    unsigned int nbox[3];
+    for (unsigned int i=0 ; i<3 ; i++)
+        nbox[i] = poisson_mg_max_[i]-poisson_mg_min_[i]+1;
+    
+    for (unsigned int i=0 ; i<nbox[0] ; i++)
+        for (unsigned int j=0 ; j<nbox[1] ; j++)
+            for (unsigned int k=0 ; k<nbox[2] ; k++)
+                poisson_mg_f_[(i*nbox[1]+j)*nbox[2]+k] = (*r_)( ((i+imin[0])*n[1]+j+imin[1])*n[2]+k+imin[2] );
+    
+    poisson_mg_->solve( &poisson_mg_u_[0], &poisson_mg_f_[0], 1 );
+    
+    z_->put_to(0.);
+    for (unsigned int i=0 ; i<nbox[0] ; i++)
+        for (unsigned int j=0 ; j<nbox[1] ; j++)
+            for (unsigned int k=0 ; k<nbox[2] ; k++)
+                (*z_)( ((i+imin[0])*n[1]+j+imin[1])*n[2]+k+imin[2] ) = poisson_mg_u_[(i*nbox[1]+j)*nbox[2]+k];
+    
+} // applyPoissonPreconditioner
+
+double ElectroMagn::restrictPoissonResidual()
+{
+    unsigned int n[3] = {1, 1, 1};
+    unsigned int imin[3] = {0, 0, 0}, imax[3] = {0, 0, 0};
+    for (unsigned int i=0 ; i<nDim_field ; i++) {
+        n[i]    = dimPrim[i];
+        imin[i] = index_min_p_[i];
+        imax[i] = index_max_p_[i];
+    }
+    
+    double sum = 0.;
+    for (unsigned int i=imin[0] ; i<=imax[0] ; i++)
+        for (unsigned int j=imin[1] ; j<=imax[1] ; j++)
+            for (unsigned int k=imin[2] ; k<=imax[2] ; k++)
+                sum += (*r_)( (i*n[1]+j)*n[2]+k );
+    return sum;
+    
+} // restrictPoissonResidual
+
+void ElectroMagn::addPoissonCoarseCorrection(Patch *patch, vector<double>& coarse_correction, vector<int>& number_of_patches, vector<bool>& periodic)
+{
+    // Coordinates of the patch owning each node, nodes are owned as in the scalar products (see index_min_p_)
+    unsigned int n[3] = {1, 1, 1};
+    int npatches[3] = {1, 1, 1};
+    vector<int> owner[3];
+    for (unsigned int i=0 ; i<3 ; i++) {
+        if (i<nDim_field) {
+            n[i]        = dimPrim[i];
+            npatches[i] = number_of_patches[i];
+        }
+        owner[i].resize( n[i], 0 );
+        if (i>=nDim_field) continue;
+        int prev = patch->Pcoordinates[i]-1;
+        int next = patch->Pcoordinates[i]+1;
+        if ( prev<0 )            prev = periodic[i] ? npatches[i]-1 : 0;
+        if ( next==npatches[i] ) next = periodic[i] ? 0 : next-1;
+        for (unsigned int j=0 ; j<n[i] ; j++) {
+            if      ( j<index_min_p_[i] ) owner[i][j] = prev;
+            else if ( j>index_max_p_[i] ) owner[i][j] = next;
+            else                          owner[i][j] = patch->Pcoordinates[i];
+        }
+    }
+    
+    for (unsigned int i=0 ; i<n[0] ; i++)
+        for (unsigned int j=0 ; j<n[1] ; j++)
+            for (unsigned int k=0 ; k<n[2] ; k++)
+                (*z_)( (i*n[1]+j)*n[2]+k ) += coarse_correction[ (owner[0][i]*npatches[1]+owner[1][j])*npatches[2]+owner[2][k] ];
+    
+} // addPoissonCoarseCorrection
+
+double ElectroMagn::compute_rz()
+{
+    unsigned int n[3] = {1, 1, 1};
+    unsigned int imin[3] = {0, 0, 0}, imax[3] = {0, 0, 0};
+    for (unsigned int i=0 ; i<nDim_field ; i++) {
+        n[i]    = dimPrim[i];
+        imin[i] = index_min_p_[i];
+        imax[i] = index_max_p_[i];
+    }
+    
+    double r_dot_z_local = 0.;
+    for (unsigned int i=imin[0] ; i<=imax[0] ; i++)
+        for (unsigned int j=imin[1] ; j<=imax[1] ; j++)
+            for (unsigned int k=imin[2] ; k<=imax[2] ; k++) {
+                unsigned int idx = (i*n[1]+j)*n[2]+k;
+                r_dot_z_local += (*r_)(idx)*(*z_)(idx);
+            }
+    return r_dot_z_local;
+    
+} // compute_rz
+
+void ElectroMagn::update_p_preconditioned(double rnew_dot_znew, double r_dot_z)
+{
+    double beta_k = rnew_dot_znew/r_dot_z;
+    for (unsigned int i=0 ; i<p_->globalDims_ ; i++)
+        (*p_)(i) = (*z_)(i) + beta_k * (*p_)(i);
+    
+} // update_p_preconditioned
+
+void ElectroMagn::deletePoissonPreconditioner()
+{
+    delete z_;
+    delete poisson_mg_;
+    z_ = NULL;
+    poisson_mg_ = NULL;
+    
+} // deletePoissonPreconditioner
+
 void ElectroMagn::applyExternalFields(Patch* patch) {    
     for (vector<ExtField>::iterator extfield=extFields.begin(); extfield!=extFields.end(); extfield++ ) {
         if( extfield->index < allFields.size() ) {
@@ -410,9 +602,72 @@ void ElectroMagn::applyAntenna(unsigned int iAntenna, double intensity) {
         
         field = allFields[antennas[iAntenna].index];
         
-        for (unsigned int i=0; i< field->globalDims_ ; i++)
-            (*field)(i) += intensity * (*antennaField)(i);
+        // Only the box containing the non-zero values of the antenna is updated
+        unsigned int n[3] = { 1, 1, 1 }, nbox[3] = { 1, 1, 1 };
+        for (unsigned int i=0; i<field->dims_.size(); i++) {
+            n   [i] = field       ->dims_[i];
+            nbox[i] = antennaField->dims_[i];
+        }
+        vector<unsigned int> &start = antennas[iAntenna].box_start;
+        
+        for (unsigned int i=0; i<nbox[0]; i++) {
+            for (unsigned int j=0; j<nbox[1]; j++) {
+                field_t * f = &field->data_[ ( (start[0]+i)*n[1] + start[1]+j )*n[2] + start[2] ];
+                field_t * a = &antennaField->data_[ ( i*nbox[1] + j )*nbox[2] ];
+                #pragma omp simd
+                for (unsigned int k=0; k<nbox[2]; k++)
+                    f[k] += intensity * a[k];
+            }
+        }
         
     }
 }
 
+
+void ElectroMagn::shrinkAntenna(Antenna& antenna) {
+    Field *field = antenna.field;
+    if (!field) return;
+    
+    // Bounding box of the non-zero values
+    unsigned int ndim = field->dims_.size();
+    unsigned int n[3] = { 1, 1, 1 }, lo[3], hi[3] = { 0, 0, 0 };
+    for (unsigned int d=0; d<ndim; d++)
+        n[d] = field->dims_[d];
+    for (unsigned int d=0; d<3; d++)
+        lo[d] = n[d];
+    for (unsigned int i=0; i<n[0]; i++) {
+        for (unsigned int j=0; j<n[1]; j++) {
+            for (unsigned int k=0; k<n[2]; k++) {
+                if( field->data_[ (i*n[1]+j)*n[2]+k ] == 0. ) continue;
+                lo[0] = min(lo[0], i); hi[0] = max(hi[0], i+1);
+                lo[1] = min(lo[1], j); hi[1] = max(hi[1], j+1);
+                lo[2] = min(lo[2], k); hi[2] = max(hi[2], k+1);
+            }
+        }
+    }
+    
+    // The antenna does not cover this patch
+    if( hi[0] == 0 ) {
+        delete field;
+        antenna.field = NULL;
+        return;
+    }
+    
+    // Copy the box, then reallocate the field with the dimensions of the box
+    vector<unsigned int> dims(ndim);
+    for (unsigned int d=0; d<ndim; d++)
+        dims[d] = hi[d]-lo[d];
+    vector<double> box( (hi[0]-lo[0])*(hi[1]-lo[1])*(hi[2]-lo[2]) );
+    unsigned int ibox = 0;
+    for (unsigned int i=lo[0]; i<hi[0]; i++)
+        for (unsigned int j=lo[1]; j<hi[1]; j++)
+            for (unsigned int k=lo[2]; k<hi[2]; k++)
+                box[ibox++] = field->data_[ (i*n[1]+j)*n[2]+k ];
+    field->deallocateDims();
+    field->allocateDims(dims);
+    for (unsigned int i=0; i<box.size(); i++)
+        field->data_[i] = box[i];
+    
+    antenna.box_start.assign( lo, lo+3 );
+}
+
@@ -19,6 +19,7 @@ class SimWindow;
 class Patch;
 class Solver;
 class DomainDecomposition;
+class PoissonMultigrid;
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -43,7 +44,10 @@ struct Antenna {
     Profile *time_profile;
     Profile *space_profile;
     
+    //! Space profile on the smallest box of the patch containing its non-zero values (NULL if zero on the whole patch)
     Field* field;
+    //! Position of this box in the patch
+    std::vector<unsigned int> box_start;
     
     unsigned int index;
 };
@@ -199,7 +203,11 @@ public:
     
     //! Method used to initialize the total charge currents and densities
     void restartRhoJ();
-    //! Method used to initialize the total charge currents and densities of species
+    //! Method used to allocate the charge currents and densities of species requested by the diagnostics
+    void allocateRhoJs();
+    //! Method used to release the charge currents and densities of species
+    void deallocateRhoJs();
+    //! Method used to release the charge currents and densities of species, and initialize the total ones
     void restartRhoJs();
     
     //! Method used to sum all species densities and currents to compute the total charge density and currents
@@ -245,6 +253,28 @@ public:
     Field* p_;
     Field* Ap_;
     
+    //! Preconditioned residual z = M^-1 r (when the Poisson solver uses the multigrid preconditioner)
+    Field* z_;
+    //! Multigrid solver of the patch-local part of the Poisson preconditioner
+    PoissonMultigrid* poisson_mg_;
+    //! Right hand side and solution of the local multigrid
+    std::vector<double> poisson_mg_f_, poisson_mg_u_;
+    //! Box of nodes solved by the local multigrid
+    unsigned int poisson_mg_min_[3];
+    unsigned int poisson_mg_max_[3];
+    
+    //! Allocate z and the local multigrid, coef = coefficients of the discrete laplacian in each direction
+    void initPoissonPreconditioner(Patch *patch, std::vector<double> coef);
+    //! Local contribution to z = M^-1 r : one V-cycle on the patch (to be summed on ghost cells)
+    void applyPoissonPreconditioner();
+    //! Sum of r on the nodes owned by the patch (restriction to the coarse grid of patches)
+    double restrictPoissonResidual();
+    //! Add the coarse grid correction (defined per patch) to z
+    void addPoissonCoarseCorrection(Patch *patch, std::vector<double>& coarse_correction, std::vector<int>& number_of_patches, std::vector<bool>& periodic);
+    double compute_rz();
+    void update_p_preconditioned(double rnew_dot_znew, double r_dot_z);
+    void deletePoissonPreconditioner();
+    
     //! \todo check time_dual or time_prim (MG)
 //    //! method used to solve Maxwell's equation (takes current time and time-step as input parameter)
 //    virtual void solveMaxwellAmpere() = 0;
@@ -254,9 +284,16 @@ public:
     Solver* MaxwellFaradaySolver_;
     virtual void saveMagneticFields(bool) = 0;
     virtual void centerMagneticFields() = 0;
+    //! Same as centerMagneticFields on the rows [istart, iend) of the first dimension only (see SuperGrid)
+    virtual void centerMagneticFields( unsigned int istart, unsigned int iend ) {
+        ERROR( "centerMagneticFields cannot be split in rows in this geometry" );
+    };
     virtual void binomialCurrentFilter() = 0;
     
     void boundaryConditions(int itime, double time_dual, Patch* patch, Params &params, SimWindow* simWindow);
+    //! Corrections of the PML boundary conditions after the Maxwell-Ampere and Maxwell-Faraday solvers
+    void applyPML_E(Patch* patch);
+    void applyPML_B(Patch* patch);
     
     void laserDisabled();
     
@@ -324,6 +361,9 @@ public:
     //! Method that fills the initial spatial profile of the antenna
     virtual void initAntennas(Patch* patch) {};
     
+    //! Reduces the field of an antenna to the smallest box containing its non-zero values
+    void shrinkAntenna(Antenna& antenna);
+    
     double computeNRJ();
     double getLostNrjMW() const {return nrj_mw_lost;}
     
@@ -339,17 +379,36 @@ public:
     inline int getMemFootPrint() {
     
         int emSize = 9+4; // 3 x (E, B, Bm) + 3 x J, rho
+        // Fields per species are only counted when allocated (see getRhoJsMemFootPrint)
         for (unsigned int ispec=0 ; ispec<Jx_s.size() ; ispec++) {
-            if (Jx_s [ispec]) emSize++;
-            if (Jy_s [ispec]) emSize++;
-            if (Jz_s [ispec]) emSize++;
-            if (rho_s [ispec]) emSize++;
+            if (Jx_s [ispec] && Jx_s [ispec]->data_) emSize++;
+            if (Jy_s [ispec] && Jy_s [ispec]->data_) emSize++;
+            if (Jz_s [ispec] && Jz_s [ispec]->data_) emSize++;
+            if (rho_s [ispec] && rho_s [ispec]->data_) emSize++;
         }
 
         for ( unsigned int idiag = 0 ; idiag < allFields_avg.size() ; idiag++)
             emSize += allFields_avg[idiag].size() ;
 
 
+        for (size_t i=0 ; i<nDim_field ; i++)
+            emSize *= dimPrim[i];
+    
+        emSize *= sizeof(field_t);
+        return emSize;
+    }
+
+    //! Memory of the fields per species requested by the diagnostics, allocated only when a diagnostic needs them
+    inline int getRhoJsMemFootPrint() {
+    
+        int emSize = 0;
+        for (unsigned int ispec=0 ; ispec<Jx_s.size() ; ispec++) {
+            if (Jx_s [ispec]) emSize++;
+            if (Jy_s [ispec]) emSize++;
+            if (Jz_s [ispec]) emSize++;
+            if (rho_s [ispec]) emSize++;
+        }
+
         for (size_t i=0 ; i<nDim_field ; i++)
             emSize *= dimPrim[i];
     
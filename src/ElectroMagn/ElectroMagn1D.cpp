@@ -5,6 +5,7 @@
 #include <sstream>
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 #include "Params.h"
 #include "Field1D.h"
@@ -428,7 +429,13 @@ void ElectroMagn1D::centeringErel( std::vector<double> E_Add )
 void ElectroMagn1D::saveMagneticFields(bool is_spectral)
 {
     // Static cast of the fields
-    if(!is_spectral){
+    if(!is_spectral && MaxwellFaradaySolver_->isOutOfPlace()){
+        // B_m gets the arrays of B, the solver fills the arrays of B from B_m
+        Bx_m->swapData(Bx_);
+        By_m->swapData(By_);
+        Bz_m->swapData(Bz_);
+    }
+    else if(!is_spectral){
    	 Field1D* Bx1D   = static_cast<Field1D*>(Bx_);
    	 Field1D* By1D   = static_cast<Field1D*>(By_);
    	 Field1D* Bz1D   = static_cast<Field1D*>(Bz_);
@@ -494,6 +501,11 @@ void ElectroMagn1D::saveMagneticFields(bool is_spectral)
 // Center the Magnetic Fields (used to push the particle)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn1D::centerMagneticFields()
+{
+    centerMagneticFields( 0, nx_d );
+}
+
+void ElectroMagn1D::centerMagneticFields( unsigned int istart, unsigned int iend )
 {
     // Static cast of the fields
     Field1D* Bx1D   = static_cast<Field1D*>(Bx_);
@@ -504,12 +516,12 @@ void ElectroMagn1D::centerMagneticFields()
     Field1D* Bz1D_m = static_cast<Field1D*>(Bz_m);
     
     // for Bx^(p)
-    for (unsigned int i=0 ; i<dimPrim[0] ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, dimPrim[0] ) ; i++) {
         (*Bx1D_m)(i) = ( (*Bx1D)(i)+ (*Bx1D_m)(i))*0.5 ;
     }
     
     // for By^(d) & Bz^(d)
-    for (unsigned int i=0 ; i<dimDual[0] ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, dimDual[0] ) ; i++) {
         (*By1D_m)(i)= ((*By1D)(i)+(*By1D_m)(i))*0.5 ;
         (*Bz1D_m)(i)= ((*Bz1D)(i)+(*Bz1D_m)(i))*0.5 ;
     }
@@ -662,16 +674,24 @@ void ElectroMagn1D::computePoynting() {
 void ElectroMagn1D::applyExternalField(Field* my_field,  Profile *profile, Patch* patch) {
     Field1D* field1D=static_cast<Field1D*>(my_field);
     
-    vector<double> pos(1);
-    pos[0] = dx * ((double)(patch->getCellStartingGlobalIndex(0))+(field1D->isDual(0)?-0.5:0.));
+    double pos = dx * ((double)(patch->getCellStartingGlobalIndex(0))+(field1D->isDual(0)?-0.5:0.));
     int N = (int)field1D->dims()[0];
     
+    // Coordinates of all the points, so that the profile is evaluated in one batch
+    vector<Field*> xyz(1, new Field1D(field1D->dims()));
+    Field1D values(field1D->dims());
+    
     // USING UNSIGNED INT CREATES PB WITH PERIODIC BCs
     for (int i=0 ; i<N ; i++) {
-        (*field1D)(i) += profile->valueAt(pos);
-        pos[0] += dx;
+        (*xyz[0])(i) = pos;
+        pos += dx;
     }
     
+    profile->valuesAt(xyz, values);
+    for (int i=0 ; i<N ; i++)
+        (*field1D)(i) += values(i);
+    
+    delete xyz[0];
 }
 
 
@@ -689,6 +709,7 @@ void ElectroMagn1D::initAntennas(Patch* patch)
         
         if (antennas[i].field) 
             applyExternalField(antennas[i].field, antennas[i].space_profile, patch);
+        shrinkAntenna(antennas[i]);
     }
 
 }
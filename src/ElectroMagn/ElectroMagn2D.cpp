@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include <iostream>
+#include <algorithm>
 #include <sstream>
 
 #include "Params.h"
@@ -12,6 +13,7 @@
 #include <cstring>
 
 #include "Profile.h"
+#include "Solver.h"
 
 #include "ElectroMagnBC.h"
 
@@ -155,8 +157,10 @@ void ElectroMagn2D::initElectroMagn2DQuantities(Params &params, Patch* patch)
     Jz_   = new Field2D(dimPrim, 2, false, "Jz");
     rho_  = new Field2D(dimPrim, "Rho" );
     
-    if(params.is_pxr == true) {
+    // rho at the previous time-step, for the spectral solvers
+    if( params.is_spectral || params.is_pxr )
         rhoold_ = new Field2D(dimPrim,"Rho");
+    if(params.is_pxr == true) {
         Ex_pxr  = new Field2D(dimDual);
         Ey_pxr  = new Field2D(dimDual);
         Ez_pxr  = new Field2D(dimDual);
@@ -794,7 +798,13 @@ void ElectroMagn2D::centeringErel( std::vector<double> E_Add )
 void ElectroMagn2D::saveMagneticFields(bool is_spectral)
 {
     // Static cast of the fields
-    if(!is_spectral  ){
+    if(!is_spectral && MaxwellFaradaySolver_->isOutOfPlace()){
+        // B_m gets the arrays of B, the solver fills the arrays of B from B_m
+        Bx_m->swapData(Bx_);
+        By_m->swapData(By_);
+        Bz_m->swapData(Bz_);
+    }
+    else if(!is_spectral  ){
    	 Field2D* Bx2D   = static_cast<Field2D*>(Bx_);
    	 Field2D* By2D   = static_cast<Field2D*>(By_);
    	 Field2D* Bz2D   = static_cast<Field2D*>(Bz_);
@@ -804,28 +814,28 @@ void ElectroMagn2D::saveMagneticFields(bool is_spectral)
    	 
    	 // Magnetic field Bx^(p,d)
    	 for (unsigned int i=0 ; i<nx_p ; i++) {
-   	     memcpy(&((*Bx2D_m)(i,0)), &((*Bx2D)(i,0)),ny_d*sizeof(double) );
+   	     memcpy(&((*Bx2D_m)(i,0)), &((*Bx2D)(i,0)),ny_d*sizeof(field_t) );
    	     //for (unsigned int j=0 ; j<ny_d ; j++) {
    	     //    (*Bx2D_m)(i,j)=(*Bx2D)(i,j);
    	     //}
    	 
    	 // Magnetic field By^(d,p)
-   	     memcpy(&((*By2D_m)(i,0)), &((*By2D)(i,0)),ny_p*sizeof(double) );
+   	     memcpy(&((*By2D_m)(i,0)), &((*By2D)(i,0)),ny_p*sizeof(field_t) );
    	     //for (unsigned int j=0 ; j<ny_p ; j++) {
    	     //    (*By2D_m)(i,j)=(*By2D)(i,j);
    	     //}
    	 
    	 // Magnetic field Bz^(d,d)
-   	     memcpy(&((*Bz2D_m)(i,0)), &((*Bz2D)(i,0)),ny_d*sizeof(double) );
+   	     memcpy(&((*Bz2D_m)(i,0)), &((*Bz2D)(i,0)),ny_d*sizeof(field_t) );
    	     //for (unsigned int j=0 ; j<ny_d ; j++) {
    	     //    (*Bz2D_m)(i,j)=(*Bz2D)(i,j);
    	     //}
    	 }// end for i
-   	     memcpy(&((*By2D_m)(nx_p,0)), &((*By2D)(nx_p,0)),ny_p*sizeof(double) );
+   	     memcpy(&((*By2D_m)(nx_p,0)), &((*By2D)(nx_p,0)),ny_p*sizeof(field_t) );
    	     //for (unsigned int j=0 ; j<ny_p ; j++) {
    	     //    (*By2D_m)(nx_p,j)=(*By2D)(nx_p,j);
    	     //}
-   	     memcpy(&((*Bz2D_m)(nx_p,0)), &((*Bz2D)(nx_p,0)),ny_d*sizeof(double) );
+   	     memcpy(&((*Bz2D_m)(nx_p,0)), &((*Bz2D)(nx_p,0)),ny_d*sizeof(field_t) );
    	     //for (unsigned int j=0 ; j<ny_d ; j++) {
    	     //    (*Bz2D_m)(nx_p,j)=(*Bz2D)(nx_p,j);
    	     //}
@@ -932,6 +942,11 @@ void ElectroMagn2D::binomialCurrentFilter()
 // Center the Magnetic Fields (used to push the particle)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn2D::centerMagneticFields()
+{
+    centerMagneticFields( 0, nx_d );
+}
+
+void ElectroMagn2D::centerMagneticFields( unsigned int istart, unsigned int iend )
 {
     // Static cast of the fields
     Field2D* Bx2D   = static_cast<Field2D*>(Bx_);
@@ -942,7 +957,7 @@ void ElectroMagn2D::centerMagneticFields()
     Field2D* Bz2D_m = static_cast<Field2D*>(Bz_m);
     
     // Magnetic field Bx^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_p ) ; i++) {
         #pragma omp simd
         for (unsigned int j=0 ; j<ny_d ; j++) {
             (*Bx2D_m)(i,j) = ( (*Bx2D)(i,j) + (*Bx2D_m)(i,j) )*0.5;
@@ -964,6 +979,7 @@ void ElectroMagn2D::centerMagneticFields()
             (*Bz2D_m)(i,j) = ( (*Bz2D)(i,j) + (*Bz2D_m)(i,j) )*0.5;
         } // end for j
       } // end for i
+    if ( istart<=nx_p && nx_p<iend ) {
         #pragma omp simd
         for (unsigned int j=0 ; j<ny_p ; j++) {
             (*By2D_m)(nx_p,j) = ( (*By2D)(nx_p,j) + (*By2D_m)(nx_p,j) )*0.5;
@@ -972,6 +988,7 @@ void ElectroMagn2D::centerMagneticFields()
         for (unsigned int j=0 ; j<ny_d ; j++) {
             (*Bz2D_m)(nx_p,j) = ( (*Bz2D)(nx_p,j) + (*Bz2D_m)(nx_p,j) )*0.5;
         } // end for j
+    }
 
     
 }//END centerMagneticFields
@@ -1156,16 +1173,29 @@ void ElectroMagn2D::applyExternalField(Field* my_field,  Profile *profile, Patch
     int N0 = (int)field2D->dims()[0];
     int N1 = (int)field2D->dims()[1];
     
+    // Coordinates of all the points, so that the profile is evaluated in one batch
+    vector<Field*> xyz(2);
+    for (unsigned int idim=0 ; idim<2 ; idim++)
+        xyz[idim] = new Field2D(field2D->dims());
+    Field2D values(field2D->dims());
+    
     // UNSIGNED INT LEADS TO PB IN PERIODIC BCs
     for (int i=0 ; i<N0 ; i++) {
         pos[1] = pos1;
         for (int j=0 ; j<N1 ; j++) {
-            (*field2D)(i,j) += profile->valueAt(pos);
+            (*xyz[0])(i,j) = pos[0];
+            (*xyz[1])(i,j) = pos[1];
             pos[1] += dy;
         }
         pos[0] += dx;
     }
     
+    profile->valuesAt(xyz, values);
+    for (unsigned int i=0 ; i<field2D->globalDims_ ; i++)
+        field2D->data_[i] += values.data_[i];
+    
+    for (unsigned int idim=0 ; idim<2 ; idim++)
+        delete xyz[idim];
 }
 
 
@@ -1183,6 +1213,7 @@ void ElectroMagn2D::initAntennas(Patch* patch)
         
         if (antennas[i].field) 
             applyExternalField(antennas[i].field, antennas[i].space_profile, patch);
+        shrinkAntenna(antennas[i]);
     }
 
 }
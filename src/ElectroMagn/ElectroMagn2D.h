@@ -66,6 +66,7 @@ public:
     
     //! Method used to center the Magnetic fields (used to push the particles)
     void centerMagneticFields();
+    void centerMagneticFields( unsigned int istart, unsigned int iend );
     
     //! Method used to apply a single-pass binomial filter on currents
     void binomialCurrentFilter();
@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include <iostream>
+#include <algorithm>
 #include <sstream>
 
 #include "Params.h"
@@ -12,6 +13,7 @@
 #include <cstring>
 
 #include "Profile.h"
+#include "Solver.h"
 
 #include "ElectroMagnBC.h"
 
@@ -158,8 +160,10 @@ void ElectroMagn3D::initElectroMagn3DQuantities(Params &params, Patch* patch)
     beta_edge.resize(24);
     S_edge.resize(24);
 
-    if(params.is_pxr == true) {
+    // rho at the previous time-step, for the spectral solvers
+    if( params.is_spectral || params.is_pxr )
         rhoold_ = new Field3D(dimPrim,"Rho");
+    if(params.is_pxr == true) {
         Ex_pxr  = new Field3D(dimDual);
         Ey_pxr  = new Field3D(dimDual);
         Ez_pxr  = new Field3D(dimDual);
@@ -941,7 +945,13 @@ void ElectroMagn3D::centeringErel( std::vector<double> E_Add )
 void ElectroMagn3D::saveMagneticFields(bool is_spectral)
 {
     // Static cast of the fields
-    if(!is_spectral){
+    if(!is_spectral && MaxwellFaradaySolver_->isOutOfPlace()){
+        // B_m gets the arrays of B, the solver fills the arrays of B from B_m
+        Bx_m->swapData(Bx_);
+        By_m->swapData(By_);
+        Bz_m->swapData(Bz_);
+    }
+    else if(!is_spectral){
 	    Field3D* Bx3D   = static_cast<Field3D*>(Bx_);
 	    Field3D* By3D   = static_cast<Field3D*>(By_);
 	    Field3D* Bz3D   = static_cast<Field3D*>(Bz_);
@@ -950,13 +960,13 @@ void ElectroMagn3D::saveMagneticFields(bool is_spectral)
 	    Field3D* Bz3D_m = static_cast<Field3D*>(Bz_m);
 	    
 	    // Magnetic field Bx^(p,d,d)
-	    memcpy(&((*Bx3D_m)(0,0,0)), &((*Bx3D)(0,0,0)),nx_p*ny_d*nz_d*sizeof(double) );
+	    memcpy(&((*Bx3D_m)(0,0,0)), &((*Bx3D)(0,0,0)),nx_p*ny_d*nz_d*sizeof(field_t) );
 	    
 	    // Magnetic field By^(d,p,d)
-	    memcpy(&((*By3D_m)(0,0,0)), &((*By3D)(0,0,0)),nx_d*ny_p*nz_d*sizeof(double) );
+	    memcpy(&((*By3D_m)(0,0,0)), &((*By3D)(0,0,0)),nx_d*ny_p*nz_d*sizeof(field_t) );
 	    
 	    // Magnetic field Bz^(d,d,p)
-	    memcpy(&((*Bz3D_m)(0,0,0)), &((*Bz3D)(0,0,0)),nx_d*ny_d*nz_p*sizeof(double) );
+	    memcpy(&((*Bz3D_m)(0,0,0)), &((*Bz3D)(0,0,0)),nx_d*ny_d*nz_p*sizeof(field_t) );
     }
     else{
             Bx_m = Bx_;
@@ -1036,6 +1046,11 @@ Field * ElectroMagn3D::createField(string fieldname)
 // Center the Magnetic Fields (used to push the particle)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn3D::centerMagneticFields()
+{
+    centerMagneticFields( 0, nx_d );
+}
+
+void ElectroMagn3D::centerMagneticFields( unsigned int istart, unsigned int iend )
 {
     // Static cast of the fields
     Field3D* Bx3D   = static_cast<Field3D*>(Bx_);
@@ -1046,7 +1061,7 @@ void ElectroMagn3D::centerMagneticFields()
     Field3D* Bz3D_m = static_cast<Field3D*>(Bz_m);
     
     // Magnetic field Bx^(p,d,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_p ) ; i++) {
         for (unsigned int j=0 ; j<ny_d ; j++) {
             for (unsigned int k=0 ; k<nz_d ; k++) {
                 (*Bx3D_m)(i,j,k) = ( (*Bx3D)(i,j,k) + (*Bx3D_m)(i,j,k) )*0.5;
@@ -1055,7 +1070,7 @@ void ElectroMagn3D::centerMagneticFields()
     }
     
     // Magnetic field By^(d,p,d)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_d ) ; i++) {
         for (unsigned int j=0 ; j<ny_p ; j++) {
             for (unsigned int k=0 ; k<nz_d ; k++) {
                 (*By3D_m)(i,j,k) = ( (*By3D)(i,j,k) + (*By3D_m)(i,j,k) )*0.5;
@@ -1064,7 +1079,7 @@ void ElectroMagn3D::centerMagneticFields()
     }
     
     // Magnetic field Bz^(d,d,p)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_d ) ; i++) {
         for (unsigned int j=0 ; j<ny_d ; j++) {
             for (unsigned int k=0 ; k<nz_p ; k++) {
                 (*Bz3D_m)(i,j,k) = ( (*Bz3D)(i,j,k) + (*Bz3D_m)(i,j,k) )*0.5;
@@ -1632,6 +1647,7 @@ void ElectroMagn3D::applyExternalField(Field* my_field,  Profile *profile, Patch
     for (unsigned int idim=0 ; idim<3 ; idim++) {
         xyz[idim] = new Field3D(n_space_to_create);
     }
+    Field3D values(n_space_to_create);
 
     for (int i=0 ; i<N0 ; i++) {
         pos[1] = pos1;
@@ -1648,8 +1664,13 @@ void ElectroMagn3D::applyExternalField(Field* my_field,  Profile *profile, Patch
         pos[0] += dx;
     }
 
-    profile->valuesAt(xyz,*my_field);
+    // The profile is added to the field, as in 1D and 2D
+    profile->valuesAt(xyz,values);
+    for (unsigned int i=0 ; i<field3D->globalDims_ ; i++)
+        field3D->data_[i] += values.data_[i];
 
+    for (unsigned int idim=0 ; idim<3 ; idim++)
+        delete xyz[idim];
 }
 
 
@@ -1671,6 +1692,7 @@ void ElectroMagn3D::initAntennas(Patch* patch)
         
         if (antennas[i].field) 
             applyExternalField(antennas[i].field, antennas[i].space_profile, patch);
+        shrinkAntenna(antennas[i]);
     }
 
 }
@@ -40,6 +40,9 @@ public:
         int nlaser = PyTools::nComponents("Laser");
         for (int ilaser = 0; ilaser < nlaser; ilaser++) {
             Laser * laser = new Laser(params, ilaser, patch);
+            if ( ( laser->box_side == "xmin" && params.EM_BCs[0][0] == "PML" )
+              || ( laser->box_side == "xmax" && params.EM_BCs[0][1] == "PML" ) )
+                ERROR("Laser #"<<ilaser<<": lasers cannot be injected from a PML boundary");
             if     ( laser->box_side == "xmin" && EMfields->emBoundCond[0]) {
                 if( patch->isXmin() ) laser->createFields(params, patch);
                 EMfields->emBoundCond[0]->vecLaser.push_back( laser );
@@ -39,7 +39,44 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
     space_time = PyTools::extract2Profiles ("space_time_profile", ilaser, space_time_profile);
     
     spacetime.resize(2, false);
-    if( space_time ) {
+    file = "";
+    PyTools::extract("file", file, "Laser", ilaser);
+    
+    if( ! file.empty() ) {
+        
+        if( space_time ) {
+            WARNING(errorPrefix << ": file defined, dismissing space_time_profile" );
+        }
+        
+        hid_t fid = H5Fopen( file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+        if( fid < 0 ) ERROR(errorPrefix << ": " << file << " is not a valid HDF5 file");
+        
+        // Time axis of the datasets (attributes of the file)
+        double time_start = 0., time_step = params.timestep;
+        if( H5::hasAttr(fid, "time_start") ) H5::getAttr(fid, "time_start", time_start);
+        if( H5::hasAttr(fid, "time_step" ) ) H5::getAttr(fid, "time_step" , time_step );
+        if( time_step <= 0. ) ERROR(errorPrefix << ": time_step in " << file << " must be positive");
+        
+        info << "\t\t" << errorPrefix << ": profile from file " << file << endl;
+        info << "\t\t\ttime_start         : " << time_start << endl;
+        info << "\t\t\ttime_step          : " << time_step;
+        
+        // By (primal along y) and Bz (dual along y)
+        const char * datasets[2] = { "By", "Bz" };
+        for( unsigned int i=0; i<2; i++ ) {
+            if( H5Lexists( fid, datasets[i], H5P_DEFAULT ) > 0 ) {
+                LaserProfileFile * p = new LaserProfileFile( file, datasets[i], i==0, time_start, time_step, params.nDim_field );
+                profiles.push_back( p );
+                info << endl << "\t\t\t" << (i==0?"first  axis":"second axis") << " : " << p->getInfo();
+            } else {
+                profiles.push_back( new LaserProfileNULL() );
+                info << endl << "\t\t\t" << (i==0?"first  axis":"second axis") << " : zero";
+            }
+        }
+        
+        H5Fclose( fid );
+        
+    } else if( space_time ) {
         
         spacetime[0] = (bool)(space_time_profile[0]);
         spacetime[1] = (bool)(space_time_profile[1]);
@@ -60,8 +97,8 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name.str("");
         name << "Laser[" << ilaser <<"].space_time_profile[0]";
         if( spacetime[0] ) {
-            p = new Profile(space_time_profile[0], params.nDim_field, name.str());
-            profiles.push_back( new LaserProfileNonSeparable(p) );
+            p = new Profile(space_time_profile[0], params.nDim_field, name.str(), true);
+            profiles.push_back( new LaserProfileNonSeparable(p, true) );
             info << "\t\t\tfirst  axis : " << p->getInfo() << endl;
         } else {
             profiles.push_back( new LaserProfileNULL() );
@@ -71,8 +108,8 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name.str("");
         name << "Laser[" << ilaser <<"].space_time_profile[1]";
         if( spacetime[1] ) {
-            p = new Profile(space_time_profile[1], params.nDim_field, name.str());
-            profiles.push_back( new LaserProfileNonSeparable(p) );
+            p = new Profile(space_time_profile[1], params.nDim_field, name.str(), true);
+            profiles.push_back( new LaserProfileNonSeparable(p, false) );
             info << "\t\t\tsecond axis : " << p->getInfo();
         } else {
             profiles.push_back( new LaserProfileNULL() );
@@ -161,8 +198,18 @@ Laser::Laser(Laser* laser, Params& params)
 {
     box_side   = laser->box_side;
     spacetime = laser->spacetime;
+    file      = laser->file;
     profiles.resize(0);
-    if( spacetime[0] || spacetime[1] ) {
+    if( ! file.empty() ) {
+        for( unsigned int i=0; i<2; i++ ) {
+            LaserProfileFile * p = dynamic_cast<LaserProfileFile*>( laser->profiles[i] );
+            if( p ) {
+                profiles.push_back( new LaserProfileFile(p) );
+            } else {
+                profiles.push_back( new LaserProfileNULL() );
+            }
+        }
+    } else if( spacetime[0] || spacetime[1] ) {
         if( spacetime[0] ) {
             profiles.push_back( new LaserProfileNonSeparable(static_cast<LaserProfileNonSeparable*>(laser->profiles[0])) );
         } else {
@@ -247,12 +294,12 @@ void LaserProfileSeparable::createFields(Params& params, Patch* patch)
         ERROR("Unknown geometry in laser");
     
     if( params.geometry!="1Dcartesian" ) {
-        unsigned int ny_p = params.n_space[1]*params.global_factor[1]+1+2*params.oversize[1];
+        unsigned int ny_p = patch->n_space[1]+1+2*params.oversize[1];
         unsigned int ny_d = ny_p+1;
         dim[0] = primal ? ny_p : ny_d;
         
         if( params.geometry!="2Dcartesian" ) {
-            unsigned int nz_p = params.n_space[2]*params.global_factor[2]+1+2*params.oversize[2];
+            unsigned int nz_p = patch->n_space[2]+1+2*params.oversize[2];
             unsigned int nz_d = nz_p+1;
             dim[1] = primal ? nz_d : nz_p;
         }
@@ -274,7 +321,7 @@ void LaserProfileSeparable::initFields(Params& params, Patch* patch)
         
     } else if( params.geometry=="2Dcartesian" ) {
         
-        unsigned int ny_p = params.n_space[1]*params.global_factor[1]+1+2*params.oversize[1];
+        unsigned int ny_p = patch->n_space[1]+1+2*params.oversize[1];
         unsigned int ny_d = ny_p+1;
         double dy = params.cell_length[1];
         vector<unsigned int> dim(1);
@@ -291,9 +338,9 @@ void LaserProfileSeparable::initFields(Params& params, Patch* patch)
         
     } else if( params.geometry=="3Dcartesian" ) {
         
-        unsigned int ny_p = params.n_space[1]*params.global_factor[1]+1+2*params.oversize[1];
+        unsigned int ny_p = patch->n_space[1]+1+2*params.oversize[1];
         unsigned int ny_d = ny_p+1;
-        unsigned int nz_p = params.n_space[2]*params.global_factor[2]+1+2*params.oversize[2];
+        unsigned int nz_p = patch->n_space[2]+1+2*params.oversize[2];
         unsigned int nz_d = nz_p+1;
         double dy = params.cell_length[1];
         double dz = params.cell_length[2];
@@ -331,10 +378,246 @@ double LaserProfileSeparable::getAmplitude(std::vector<double> pos, double t, in
     return amp;
 }
 
+// Amplitudes of a separable laser profile on the whole boundary
+void LaserProfileSeparable::getAmplitudes(double t, Field* amplitudes)
+{
+    #pragma omp critical
+    {
+        // The chirp is the same for all points, and the time envelope is the same for points with the same phase
+        double omega_ = omega * chirpProfile->valueAt(t);
+        double phi_envelope = 0., envelope = 0.;
+        bool known_envelope = false;
+        for (unsigned int i=0 ; i<space_envelope->globalDims_ ; i++) {
+            if( (*space_envelope)(i) == 0. ) continue;
+            double phi = (*phase)(i);
+            if( !known_envelope || phi != phi_envelope ) {
+                envelope = timeProfile->valueAt(t-(phi+delay_phase)/omega_);
+                phi_envelope = phi;
+                known_envelope = true;
+            }
+            (*amplitudes)(i) += envelope * (*space_envelope)(i) * sin( omega_*t - phi );
+        }
+    }
+}
+
 //Destructor
 LaserProfileNonSeparable::~LaserProfileNonSeparable()
 {
     if(spaceAndTimeProfile) delete spaceAndTimeProfile;
+    for (unsigned int i=0 ; i<coordinates.size() ; i++)
+        delete coordinates[i];
+    if(values) delete values;
+}
+
+// Transverse coordinates of the boundary points, where By (primal) or Bz (dual) are located
+void LaserProfileNonSeparable::createFields(Params& params, Patch* patch)
+{
+    if( params.geometry!="2Dcartesian" && params.geometry!="3Dcartesian" ) return;
+    
+    vector<unsigned int> dim(2, 1);
+    unsigned int ny_p = patch->n_space[1]+1+2*params.oversize[1];
+    dim[0] = primal ? ny_p : ny_p+1;
+    if( params.geometry=="3Dcartesian" ) {
+        unsigned int nz_p = patch->n_space[2]+1+2*params.oversize[2];
+        dim[1] = primal ? nz_p+1 : nz_p;
+    }
+    
+    coordinates.resize( params.nDim_field-1 );
+    for (unsigned int i=0 ; i<coordinates.size() ; i++)
+        coordinates[i] = new Field2D(dim);
+    values = new Field2D(dim);
+    
+    double dy = params.cell_length[1];
+    double y0 = patch->getDomainLocalMin(1) - ((primal?0.:0.5) + params.oversize[1])*dy;
+    for (unsigned int j=0 ; j<dim[0] ; j++) {
+        for (unsigned int k=0 ; k<dim[1] ; k++) {
+            (*coordinates[0])(j*dim[1]+k) = y0 + j*dy;
+            if( coordinates.size() > 1 ) {
+                double dz = params.cell_length[2];
+                double z0 = patch->getDomainLocalMin(2) - ((primal?0.5:0.) + params.oversize[2])*dz;
+                (*coordinates[1])(j*dim[1]+k) = z0 + k*dz;
+            }
+        }
+    }
+}
+
+// Amplitudes of a non-separable laser profile on the whole boundary : one call to the profile (numpy if possible)
+void LaserProfileNonSeparable::getAmplitudes(double t, Field* amplitudes)
+{
+    #pragma omp critical
+    spaceAndTimeProfile->valuesAt(coordinates, t, *values);
+    for (unsigned int i=0 ; i<values->globalDims_ ; i++)
+        (*amplitudes)(i) += (*values)(i);
+}
+
+
+// Profile tabulated in a file
+LaserProfileFile::LaserProfileFile(string file, string dataset, bool primal, double time_start, double time_step, unsigned int ndim) :
+    primal    ( primal     ),
+    file      ( file       ),
+    dataset   ( dataset    ),
+    time_start( time_start ),
+    time_step ( time_step  ),
+    ndim      ( ndim       ),
+    fid(-1), did(-1)
+{
+    // Only the dimensions are needed here: the file remains open only for the patches on the boundary
+    open();
+    H5Dclose( did );
+    H5Fclose( fid );
+    fid = did = -1;
+}
+// Cloning constructor
+LaserProfileFile::LaserProfileFile(LaserProfileFile * lp) :
+    primal    ( lp->primal     ),
+    file      ( lp->file       ),
+    dataset   ( lp->dataset    ),
+    time_start( lp->time_start ),
+    time_step ( lp->time_step  ),
+    ndim      ( lp->ndim       ),
+    dims      ( lp->dims       ),
+    fid(-1), did(-1)
+{
+}
+//Destructor
+LaserProfileFile::~LaserProfileFile()
+{
+    if( did >= 0 ) H5Dclose( did );
+    if( fid >= 0 ) H5Fclose( fid );
 }
 
+void LaserProfileFile::open()
+{
+    fid = H5Fopen( file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+    if( fid < 0 ) ERROR("Laser: " << file << " is not a valid HDF5 file");
+    did = H5Dopen( fid, dataset.c_str(), H5P_DEFAULT );
+    if( did < 0 ) ERROR("Laser: cannot open dataset " << dataset << " in " << file);
+    hid_t sid = H5Dget_space( did );
+    dims.resize( H5Sget_simple_extent_ndims( sid ) );
+    H5Sget_simple_extent_dims( sid, &dims[0], NULL );
+    H5Sclose( sid );
+    if( dims.size() != ndim )
+        ERROR("Laser: dataset " << dataset << " in " << file << " should have " << ndim << " dimensions (time and transverse coordinates)");
+    if( dims[0] == 0 )
+        ERROR("Laser: dataset " << dataset << " in " << file << " has no time slab");
+}
+
+string LaserProfileFile::getInfo()
+{
+    ostringstream info("");
+    info << "dataset " << dataset << " (" << dims[0] << " time slabs";
+    for( unsigned int i=1; i<dims.size(); i++ ) info << " x " << dims[i];
+    info << ")";
+    return info.str();
+}
+
+// Locates the tile of the dataset corresponding to the boundary of the patch, and opens the file for this patch only
+void LaserProfileFile::createFields(Params& params, Patch* patch)
+{
+    dim_boundary[0] = dim_boundary[1] = 1;
+    offset[0] = offset[1] = first[0] = first[1] = 0;
+    count [0] = count [1] = 1;
+    if( params.geometry=="2Dcartesian" || params.geometry=="3Dcartesian" ) {
+        // Same layout as the boundary fields: By (ny_p, nz_d) and Bz (ny_d, nz_p)
+        unsigned int ny_p = patch->n_space[1]+1+2*params.oversize[1];
+        dim_boundary[0] = primal ? ny_p : ny_p+1;
+        if( params.geometry=="3Dcartesian" ) {
+            unsigned int nz_p = patch->n_space[2]+1+2*params.oversize[2];
+            dim_boundary[1] = primal ? nz_p+1 : nz_p;
+        }
+        // The point j of the boundary field has the index (first cell of the patch + j) in the dataset,
+        // for primal (points j*dy) as well as dual (points (j-0.5)*dy) coordinates
+        for( unsigned int d=0; d<dims.size()-1; d++ ) {
+            int start = patch->getCellStartingGlobalIndex( d+1 );
+            int lo = max( start, 0 );
+            int hi = min( start+(int)dim_boundary[d], (int)dims[d+1] );
+            offset[d] = lo;
+            first [d] = lo-start;
+            count [d] = max( hi-lo, 0 );
+        }
+    }
+    slab[0].resize( count[0]*count[1] );
+    slab[1].resize( count[0]*count[1] );
+    slab_index[0] = slab_index[1] = -1;
+    if( fid < 0 && slab[0].size() > 0 ) open();
+}
+
+void LaserProfileFile::readSlab(unsigned int islab, int it)
+{
+    unsigned int ndims = dims.size();
+    vector<hsize_t> start(ndims, 0), n(ndims, 1);
+    start[0] = it;
+    for( unsigned int d=1; d<ndims; d++ ) {
+        start[d] = offset[d-1];
+        n    [d] = count [d-1];
+    }
+    hid_t filespace = H5Dget_space( did );
+    H5Sselect_hyperslab( filespace, H5S_SELECT_SET, &start[0], NULL, &n[0], NULL );
+    hsize_t size = slab[islab].size();
+    hid_t memspace = H5Screate_simple( 1, &size, NULL );
+    H5Dread( did, H5T_NATIVE_DOUBLE, memspace, filespace, H5P_DEFAULT, &slab[islab][0] );
+    H5Sclose( memspace );
+    H5Sclose( filespace );
+    slab_index[islab] = it;
+}
 
+bool LaserProfileFile::prepareSlabs(double t, double &w)
+{
+    if( slab[0].size() == 0 ) return false;
+    double u = ( t - time_start ) / time_step;
+    if( u < 0. ) return false;
+    // A single slab is constant in time after time_start (the second slab, of weight 0, stays at zero)
+    if( dims[0] == 1 ) {
+        if( slab_index[0] != 0 ) readSlab( 0, 0 );
+        w = 0.;
+        return true;
+    }
+    if( u > (double)(dims[0]-1) ) return false;
+    int it = min( (int)floor(u), (int)dims[0]-2 );
+    w = u - it;
+    // The slabs are read only when the time goes beyond the current pair; the second slab is kept when it becomes the first
+    if( slab_index[0] != it ) {
+        if( slab_index[1] == it ) {
+            slab[0].swap( slab[1] );
+            slab_index[0] = it;
+            slab_index[1] = -1;
+        } else {
+            readSlab( 0, it );
+        }
+    }
+    if( slab_index[1] != it+1 ) readSlab( 1, it+1 );
+    return true;
+}
+
+double LaserProfileFile::getAmplitude(std::vector<double> pos, double t, int j, int k)
+{
+    double amp = 0., w;
+    #pragma omp critical
+    {
+        if( prepareSlabs( t, w ) ) {
+            int jt = j-(int)first[0], kt = k-(int)first[1];
+            if( jt>=0 && jt<(int)count[0] && kt>=0 && kt<(int)count[1] ) {
+                unsigned int i = jt*count[1]+kt;
+                amp = (1.-w)*slab[0][i] + w*slab[1][i];
+            }
+        }
+    }
+    return amp;
+}
+
+// Amplitudes on the whole boundary : the tile of the patch, interpolated between two slabs
+void LaserProfileFile::getAmplitudes(double t, Field* amplitudes)
+{
+    double w;
+    bool inside;
+    #pragma omp critical
+    inside = prepareSlabs( t, w );
+    if( ! inside ) return;
+    for( unsigned int j=0; j<count[0]; j++ ) {
+        field_t * a  = &(*amplitudes)( (j+first[0])*dim_boundary[1] + first[1] );
+        double * s0 = &slab[0][j*count[1]];
+        double * s1 = &slab[1][j*count[1]];
+        for( unsigned int k=0; k<count[1]; k++ )
+            a[k] += (1.-w)*s0[k] + w*s1[k];
+    }
+}
@@ -7,6 +7,7 @@
 #include "Field.h"
 #include "Field1D.h"
 #include "Field2D.h"
+#include "H5.h"
 
 #include <vector>
 #include <string>
@@ -23,6 +24,8 @@ public:
     LaserProfile() {};
     virtual ~LaserProfile() {};
     virtual double getAmplitude(std::vector<double> pos, double t, int j, int k) {return 0.;};
+    //! Adds the amplitudes on all the points of the boundary (2D & 3D, same layout as the fields from createFields)
+    virtual void getAmplitudes(double t, Field* amplitudes) {};
     virtual std::string getInfo() { return "?"; };
     virtual void createFields(Params& params, Patch* patch) {};
     virtual void initFields  (Params& params, Patch* patch) {};
@@ -51,6 +54,14 @@ public:
     inline double getAmplitude1(std::vector<double> pos, double t, int j, int k) {
         return profiles[1]->getAmplitude(pos, t, j, k);
     }
+    //! Adds the amplitudes on the whole boundary of the patch (By)
+    inline void getAmplitudes0(double t, Field* amplitudes) {
+        profiles[0]->getAmplitudes(t, amplitudes);
+    }
+    //! Adds the amplitudes on the whole boundary of the patch (Bz)
+    inline void getAmplitudes1(double t, Field* amplitudes) {
+        profiles[1]->getAmplitudes(t, amplitudes);
+    }
     
     void createFields(Params& params, Patch* patch)
     {
@@ -77,6 +88,9 @@ private:
     //! True if spatio-temporal profile (Bx and By)
     std::vector<bool> spacetime;
     
+    //! HDF5 file containing the tabulated profile (empty if not read from a file)
+    std::string file;
+    
 
 };
 
@@ -93,6 +107,7 @@ public:
     void createFields(Params& params, Patch* patch);
     void initFields  (Params& params, Patch* patch);
     double getAmplitude(std::vector<double> pos, double t, int j, int k);
+    void getAmplitudes(double t, Field* amplitudes);
 protected:
     Field *space_envelope, *phase;
 private:
@@ -106,19 +121,64 @@ private:
 class LaserProfileNonSeparable : public LaserProfile {
 friend class SmileiMPI;
 public:
-    LaserProfileNonSeparable(Profile * spaceAndTimeProfile)
-     : spaceAndTimeProfile(spaceAndTimeProfile) {};
+    LaserProfileNonSeparable(Profile * spaceAndTimeProfile, bool primal)
+     : primal(primal), spaceAndTimeProfile(spaceAndTimeProfile), values(NULL) {};
     LaserProfileNonSeparable(LaserProfileNonSeparable* lp)
-     : spaceAndTimeProfile( new Profile(lp->spaceAndTimeProfile) ) {};
+     : primal(lp->primal), spaceAndTimeProfile( new Profile(lp->spaceAndTimeProfile) ), values(NULL) {};
     ~LaserProfileNonSeparable();
+    void createFields(Params& params, Patch* patch);
     inline double getAmplitude(std::vector<double> pos, double t, int j, int k) {
         double amp;
         #pragma omp critical
         amp = spaceAndTimeProfile->valueAt(pos, t);
         return amp;
     }
+    void getAmplitudes(double t, Field* amplitudes);
 private:
+    bool primal;
     Profile * spaceAndTimeProfile;
+    //! Transverse coordinates of the points of the boundary, and values of the profile at these points
+    std::vector<Field*> coordinates;
+    Field* values;
+};
+
+// Laser profile tabulated in an HDF5 file: the dataset (By or Bz) has the dimensions (time, y[, z]) and contains the
+// field on the points of the whole box side (without ghost cells). Each boundary patch reads only its own tile of the
+// dataset, one time slab at a time, and the field is interpolated linearly in time between two consecutive slabs.
+class LaserProfileFile : public LaserProfile {
+public:
+    LaserProfileFile(std::string file, std::string dataset, bool primal, double time_start, double time_step, unsigned int ndim);
+    LaserProfileFile(LaserProfileFile*);
+    ~LaserProfileFile();
+    void createFields(Params& params, Patch* patch);
+    double getAmplitude(std::vector<double> pos, double t, int j, int k);
+    void getAmplitudes(double t, Field* amplitudes);
+    std::string getInfo();
+private:
+    bool primal;
+    std::string file, dataset;
+    //! Time of the first slab of the dataset, and time interval between two slabs
+    double time_start, time_step;
+    //! Expected number of dimensions of the dataset (nDim_field : time, then nDim_field-1 transverse dimensions)
+    unsigned int ndim;
+    //! Dimensions of the dataset: number of slabs, then transverse dimensions
+    std::vector<hsize_t> dims;
+    
+    //! Opens the file and the dataset, reads and checks the dimensions of the dataset
+    void open();
+    //! Reads the tile of the slab `it` in the slab `islab`
+    void readSlab(unsigned int islab, int it);
+    //! Prepares the two slabs surrounding the time t, and returns the interpolation weight (false if out of the dataset)
+    bool prepareSlabs(double t, double &w);
+    
+    hid_t fid, did;
+    //! Dimension of the boundary fields (from createFields)
+    unsigned int dim_boundary[2];
+    //! Tile of the dataset read by this patch: first index in the dataset, first index in the boundary fields, size
+    hsize_t offset[2], first[2], count[2];
+    //! Two consecutive slabs of the tile, and their indices in the dataset
+    std::vector<double> slab[2];
+    int slab_index[2];
 };
 
 // Null laser profile
@@ -7,6 +7,7 @@
 
 #include "Params.h"
 #include "Laser.h"
+#include "Field2D.h"
 #include "Tools.h"
 #include "Patch.h"
 
@@ -17,6 +18,8 @@ ElectroMagnBC::ElectroMagnBC( Params &params, Patch* patch, unsigned int _min_ma
 min_max(_min_max)
 {
     vecLaser.resize(0);
+    By_laser = NULL;
+    Bz_laser = NULL;
     
     // time step
     dt = params.timestep;
@@ -29,6 +32,8 @@ ElectroMagnBC::~ElectroMagnBC()
         delete vecLaser[i];
     }
     vecLaser.clear();
+    if( By_laser ) delete By_laser;
+    if( Bz_laser ) delete Bz_laser;
 }
 
 
@@ -41,3 +46,19 @@ void ElectroMagnBC::laserDisabled()
     vecLaser.resize(0);
 }
 
+
+
+// Amplitudes of all the lasers, evaluated for the whole boundary in one call per laser
+void ElectroMagnBC::computeLaserAmplitudes( vector<unsigned int> dimBy, vector<unsigned int> dimBz, double time_dual )
+{
+    if( !By_laser ) {
+        By_laser = new Field2D( dimBy, "By_laser" );
+        Bz_laser = new Field2D( dimBz, "Bz_laser" );
+    }
+    By_laser->put_to( 0. );
+    Bz_laser->put_to( 0. );
+    for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
+        vecLaser[ilaser]->getAmplitudes0( time_dual, By_laser );
+        vecLaser[ilaser]->getAmplitudes1( time_dual, Bz_laser );
+    }
+}
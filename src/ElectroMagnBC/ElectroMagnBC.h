@@ -25,11 +25,22 @@ public:
     virtual void save_fields(Field*, Patch* patch) {};
     virtual void disableExternalFields() {};
 
+    //! PML : corrections of E after the Maxwell-Ampere solver, and of B after the Maxwell-Faraday solver
+    virtual void applyPML_E(ElectroMagn* EMfields, Patch* patch) {};
+    virtual void applyPML_B(ElectroMagn* EMfields, Patch* patch) {};
+    //! PML : auxiliary fields, sent with the patch
+    virtual std::vector<Field*> pmlFields() { return std::vector<Field*>(); };
+
     //! Vector for the various lasers
     std::vector<Laser*> vecLaser;
     
 protected:
 
+    //! Amplitudes (By and Bz) of all the lasers on the whole boundary, with the layout of the fields of the lasers
+    Field *By_laser, *Bz_laser;
+    //! Sum the amplitudes of all the lasers on the boundary at once (arrays allocated at the first call)
+    void computeLaserAmplitudes( std::vector<unsigned int> dimBy, std::vector<unsigned int> dimBz, double time_dual );
+
     //! time-step
     double dt;
 
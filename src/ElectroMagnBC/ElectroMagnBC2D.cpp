@@ -11,10 +11,10 @@ ElectroMagnBC2D::ElectroMagnBC2D( Params &params, Patch* patch, unsigned int _mi
   : ElectroMagnBC( params, patch, _min_max )
 {
     // number of nodes of the primal and dual grid in the x-direction
-    nx_p = params.n_space[0]*params.global_factor[0]+1+2*params.oversize[0];
+    nx_p = patch->n_space[0]+1+2*params.oversize[0];
     nx_d = nx_p+1;
     // number of nodes of the primal and dual grid in the y-direction
-    ny_p = params.n_space[1]*params.global_factor[1]+1+2*params.oversize[1];
+    ny_p = patch->n_space[1]+1+2*params.oversize[1];
     ny_d = ny_p+1;
     
     // spatial-step and ratios time-step by spatial-step & spatial-step by time-step (in the x-direction)
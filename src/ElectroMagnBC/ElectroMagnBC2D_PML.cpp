@@ -0,0 +1,28 @@
+#include "ElectroMagnBC2D_PML.h"
+
+#include "Params.h"
+#include "Patch.h"
+#include "ElectroMagn.h"
+
+using namespace std;
+
+ElectroMagnBC2D_PML::ElectroMagnBC2D_PML( Params &params, Patch* patch, unsigned int _min_max )
+: ElectroMagnBC2D_SM( params, patch, _min_max ),
+  layer( params, patch, _min_max )
+{
+}
+
+void ElectroMagnBC2D_PML::applyPML_E(ElectroMagn* EMfields, Patch* patch)
+{
+    layer.applyE( EMfields );
+}
+
+void ElectroMagnBC2D_PML::applyPML_B(ElectroMagn* EMfields, Patch* patch)
+{
+    layer.applyB( EMfields );
+}
+
+vector<Field*> ElectroMagnBC2D_PML::pmlFields()
+{
+    return layer.psi;
+}
@@ -0,0 +1,29 @@
+#ifndef ELECTROMAGNBC2D_PML_H
+#define ELECTROMAGNBC2D_PML_H
+
+#include <vector>
+#include "ElectroMagnBC2D_SM.h"
+#include "PML_Layer.h"
+
+class Params;
+class ElectroMagn;
+class Field;
+
+//! PML boundary condition : absorbing layer inside the box (see PML_Layer), terminated by a Silver-Muller condition
+class ElectroMagnBC2D_PML : public ElectroMagnBC2D_SM {
+public:
+
+    ElectroMagnBC2D_PML( Params &params, Patch* patch, unsigned int _min_max );
+    ~ElectroMagnBC2D_PML() {};
+
+    void applyPML_E(ElectroMagn* EMfields, Patch* patch) override;
+    void applyPML_B(ElectroMagn* EMfields, Patch* patch) override;
+    std::vector<Field*> pmlFields() override;
+
+private:
+
+    PML_Layer layer;
+
+};
+
+#endif
@@ -222,17 +222,13 @@ void ElectroMagnBC2D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
         Field2D* By2D = static_cast<Field2D*>(EMfields->By_);
         Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_);
         
+        // Lasers, for the whole boundary
+        computeLaserAmplitudes( {ny_p, 1}, {ny_d, 1}, time_dual );
+        
         // for By^(d,p)
-        vector<double> yp(1);
         for (unsigned int j=0 ; j<ny_p ; j++) {
             
-            double byW = 0.;
-            yp[0] = patch->getDomainLocalMin(1) + ((int)j - (int)EMfields->oversize[1])*dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                byW += vecLaser[ilaser]->getAmplitude0(yp, time_dual, j, 0);
-            }
+            double byW = (*By_laser)(j);
             
             (*By2D)(0+pxr_offset,j) = Alpha_SM_W   * (*Ez2D)(0+pxr_offset,j)
             +              Beta_SM_W    *( (*By2D)(1+pxr_offset,j)-By_val[j])
@@ -245,16 +241,9 @@ void ElectroMagnBC2D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
         
         
         // for Bz^(d,d)
-        vector<double> yd(1);
         for (unsigned int j=0 ; j<ny_d ; j++) {
             
-            double bzW = 0.;
-            yd[0] = patch->getDomainLocalMin(1) + ((int)j - 0.5 - (int)EMfields->oversize[1])*dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                bzW += vecLaser[ilaser]->getAmplitude1(yd, time_dual, j, 0);
-            }
+            double bzW = (*Bz_laser)(j);
             
             /*(*Bz2D)(0,j) = -Alpha_SM_W * (*Ey2D)(0,j)
              +               Beta_SM_W  * (*Bz2D)(1,j)
@@ -277,17 +266,13 @@ void ElectroMagnBC2D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
         Field2D* By2D = static_cast<Field2D*>(EMfields->By_);
         Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_);
         
+        // Lasers, for the whole boundary
+        computeLaserAmplitudes( {ny_p, 1}, {ny_d, 1}, time_dual );
+        
         // for By^(d,p)
-        vector<double> yp(1);
         for (unsigned int j=0 ; j<ny_p ; j++) {
             
-            double byE = 0.;
-            yp[0] = patch->getDomainLocalMin(1) + ((int)j - (int)EMfields->oversize[1])*dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                byE += vecLaser[ilaser]->getAmplitude0(yp, time_dual, j, 0);
-            }
+            double byE = (*By_laser)(j);
             
             /*(*By2D)(nx_d-1,j) = Alpha_SM_E   * (*Ez2D)(nx_p-1,j)
              +                   Beta_SM_E    * (*By2D)(nx_d-2,j)
@@ -305,16 +290,9 @@ void ElectroMagnBC2D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
         
         
         // for Bz^(d,d)
-        vector<double> yd(1);
         for (unsigned int j=0 ; j<ny_d ; j++) {
             
-            double bzE = 0.;
-            yd[0] = patch->getDomainLocalMin(1) + ((int)j - 0.5 - (int)EMfields->oversize[1])*dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                bzE += vecLaser[ilaser]->getAmplitude1(yd, time_dual, j, 0);
-            }
+            double bzE = (*Bz_laser)(j);
             
             /*(*Bz2D)(nx_d-1,j) = -Alpha_SM_E * (*Ey2D)(nx_p-1,j)
              +                    Beta_SM_E  * (*Bz2D)(nx_d-2,j)
@@ -0,0 +1,29 @@
+#ifndef ELECTROMAGNBC3D_PML_H
+#define ELECTROMAGNBC3D_PML_H
+
+#include <vector>
+#include "ElectroMagnBC3D_SM.h"
+#include "PML_Layer.h"
+
+class Params;
+class ElectroMagn;
+class Field;
+
+//! PML boundary condition : absorbing layer inside the box (see PML_Layer), terminated by a Silver-Muller condition
+class ElectroMagnBC3D_PML : public ElectroMagnBC3D_SM {
+public:
+
+    ElectroMagnBC3D_PML( Params &params, Patch* patch, unsigned int _min_max );
+    ~ElectroMagnBC3D_PML() {};
+
+    void applyPML_E(ElectroMagn* EMfields, Patch* patch) override;
+    void applyPML_B(ElectroMagn* EMfields, Patch* patch) override;
+    std::vector<Field*> pmlFields() override;
+
+private:
+
+    PML_Layer layer;
+
+};
+
+#endif
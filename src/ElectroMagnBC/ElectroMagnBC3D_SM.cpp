@@ -308,20 +308,16 @@ void ElectroMagnBC3D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
    Field3D* Bx3D = static_cast<Field3D*>(EMfields->Bx_);
    Field3D* By3D = static_cast<Field3D*>(EMfields->By_);
    Field3D* Bz3D = static_cast<Field3D*>(EMfields->Bz_);
-   vector<double> pos(2);
 
     if ( min_max==0 && patch->isXmin() ) {
         
+        // Lasers, for the whole boundary
+        computeLaserAmplitudes( {ny_p, nz_d}, {ny_d, nz_p}, time_dual );
+        
         // for By^(d,p,d)
         for (unsigned int j=patch->isYmin() ; j<ny_p-patch->isYmax() ; j++) {
-            pos[0] = patch->getDomainLocalMin(1) + ((int)j - (int)EMfields->oversize[1])*dy;
             for (unsigned int k=patch->isZmin() ; k<nz_d-patch->isZmax() ; k++) {
-                pos[1] = patch->getDomainLocalMin(2) + ((int)k -0.5 - (int)EMfields->oversize[2])*dz;
-                // Lasers
-                double byW = 0.;
-                for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                    byW += vecLaser[ilaser]->getAmplitude0(pos, time_dual, j, k);
-                }
+                double byW = (*By_laser)(j,k);
                 
                 (*By3D)(0,j,k) = Alpha_SM_W   * (*Ez3D)(0,j,k)
                 +              Beta_SM_W    *( (*By3D)(1,j,k)-(*By_val)(j,k))
@@ -334,14 +330,8 @@ void ElectroMagnBC3D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
         
         // for Bz^(d,d,p)
          for (unsigned int j=patch->isYmin() ; j<ny_d-patch->isYmax() ; j++) {
-            pos[0] = patch->getDomainLocalMin(1) + ((int)j - 0.5 - (int)EMfields->oversize[1])*dy;
             for (unsigned int k=patch->isZmin() ; k<nz_p-patch->isZmax() ; k++) {
-                pos[1] = patch->getDomainLocalMin(2) + ((int)k - (int)EMfields->oversize[2])*dz;
-                // Lasers
-                double bzW = 0.;
-                for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                    bzW += vecLaser[ilaser]->getAmplitude1(pos, time_dual, j, k);
-                }
+                double bzW = (*Bz_laser)(j,k);
                 
                 (*Bz3D)(0,j,k) = - Alpha_SM_W   * (*Ey3D)(0,j,k)
                 +              Beta_SM_W    *( (*Bz3D)(1,j,k)-(*Bz_val)(j,k))
@@ -355,16 +345,13 @@ void ElectroMagnBC3D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
     }
     else if (min_max==1 && patch->isXmax() ) {
         
+        // Lasers, for the whole boundary
+        computeLaserAmplitudes( {ny_p, nz_d}, {ny_d, nz_p}, time_dual );
+        
         // for By^(d,p,d)
         for (unsigned int j=patch->isYmin() ; j<ny_p-patch->isYmax() ; j++) {
-            pos[0] = patch->getDomainLocalMin(1) + ((int)j - (int)EMfields->oversize[1])*dy;
             for (unsigned int k=patch->isZmin() ; k<nz_d-patch->isZmax() ; k++) {
-                pos[1] = patch->getDomainLocalMin(2) + ((int)k - 0.5 - (int)EMfields->oversize[2])*dz;
-                // Lasers
-                double byE = 0.;
-                for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                    byE += vecLaser[ilaser]->getAmplitude0(pos, time_dual, j, k);
-                }
+                double byE = (*By_laser)(j,k);
                 
                 (*By3D)(nx_d-1,j,k) = Alpha_SM_E   * (*Ez3D)(nx_p-1,j,k)
                 +                   Beta_SM_E    *( (*By3D)(nx_d-2,j,k) -(*By_val)(j,k))
@@ -378,14 +365,8 @@ void ElectroMagnBC3D_SM::apply(ElectroMagn* EMfields, double time_dual, Patch* p
         
         // for Bz^(d,d,p)
         for (unsigned int j=patch->isYmin() ; j<ny_d-patch->isYmax(); j++) {
-            pos[0] = patch->getDomainLocalMin(1) + ((int)j - 0.5 - (int)EMfields->oversize[1])*dy;
             for (unsigned int k=patch->isZmin() ; k<nz_p-patch->isZmax() ; k++) {
-                pos[1] = patch->getDomainLocalMin(2) + ((int)k - (int)EMfields->oversize[2])*dz;
-                // Lasers
-                double bzE = 0.;
-                for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                    bzE += vecLaser[ilaser]->getAmplitude1(pos, time_dual, j, k);
-                }
+                double bzE = (*Bz_laser)(j,k);
                 
                 (*Bz3D)(nx_d-1,j,k) = -Alpha_SM_E * (*Ey3D)(nx_p-1,j,k)
                 +                    Beta_SM_E  *( (*Bz3D)(nx_d-2,j,k) -(*Bz_val)(j,k))
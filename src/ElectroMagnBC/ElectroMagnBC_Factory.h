@@ -7,9 +7,11 @@
 #include "ElectroMagnBC1D_refl.h"
 #include "ElectroMagnBC2D_SM.h"
 #include "ElectroMagnBC2D_refl.h"
+#include "ElectroMagnBC2D_PML.h"
 #include "ElectroMagnBC3D_SM.h"
 #include "ElectroMagnBC3D_refl.h"
 #include "ElectroMagnBC3D_BM.h"
+#include "ElectroMagnBC3D_PML.h"
 
 #include "Params.h"
 
@@ -69,6 +71,10 @@ public:
                 else if ( params.EM_BCs[0][ii] == "reflective" ) {
                     emBoundCond[ii] = new ElectroMagnBC2D_refl(params, patch, ii);
                 }
+                // absorbing layer (PML)
+                else if ( params.EM_BCs[0][ii] == "PML" ) {
+                    emBoundCond[ii] = new ElectroMagnBC2D_PML(params, patch, ii);
+                }
                 // else: error
                 else if ( params.EM_BCs[0][ii] != "periodic" ) {
                     ERROR( "Unknown EM x-boundary condition `" << params.EM_BCs[0][ii] << "`");
@@ -83,6 +89,10 @@ public:
                 else if ( params.EM_BCs[1][ii] == "reflective" ) {
                     emBoundCond[ii+2] = new ElectroMagnBC2D_refl(params, patch, ii+2);
                 }
+                // absorbing layer (PML)
+                else if ( params.EM_BCs[1][ii] == "PML" ) {
+                    emBoundCond[ii+2] = new ElectroMagnBC2D_PML(params, patch, ii+2);
+                }
                 // else: error
                 else if ( params.EM_BCs[1][ii] != "periodic" ) {
                     ERROR( "Unknown EM y-boundary condition `" << params.EM_BCs[1][ii] << "`");
@@ -106,6 +116,10 @@ public:
                 else if ( params.EM_BCs[0][ii] == "reflective" ) {
                     emBoundCond[ii] = new ElectroMagnBC3D_refl(params, patch, ii);
                 }
+                // absorbing layer (PML)
+                else if ( params.EM_BCs[0][ii] == "PML" ) {
+                    emBoundCond[ii] = new ElectroMagnBC3D_PML(params, patch, ii);
+                }
                 // Buneman bcs (absorbing)
                 else if ( params.EM_BCs[0][ii] == "buneman" ) {
                     emBoundCond[ii] = new ElectroMagnBC3D_BM(params, patch, ii);
@@ -124,6 +138,10 @@ public:
                 else if ( params.EM_BCs[1][ii] == "reflective" ) {
                     emBoundCond[ii+2] = new ElectroMagnBC3D_refl(params, patch, ii+2);
                 }
+                // absorbing layer (PML)
+                else if ( params.EM_BCs[1][ii] == "PML" ) {
+                    emBoundCond[ii+2] = new ElectroMagnBC3D_PML(params, patch, ii+2);
+                }
                 // Buneman bcs (absorbing)
                 else if ( params.EM_BCs[1][ii] == "buneman" ) {
                     emBoundCond[ii+2] = new ElectroMagnBC3D_BM(params, patch, ii+2);
@@ -142,6 +160,10 @@ public:
                 else if ( params.EM_BCs[2][ii] == "reflective" ) {
                     emBoundCond[ii+4] = new ElectroMagnBC3D_refl(params, patch, ii+4);
                 }
+                // absorbing layer (PML)
+                else if ( params.EM_BCs[2][ii] == "PML" ) {
+                    emBoundCond[ii+4] = new ElectroMagnBC3D_PML(params, patch, ii+4);
+                }
                 // Buneman bcs (absorbing)
                 else if ( params.EM_BCs[2][ii] == "buneman" ) {
                     emBoundCond[ii+4] = new ElectroMagnBC3D_BM(params, patch, ii+4);
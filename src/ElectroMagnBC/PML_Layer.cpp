@@ -0,0 +1,151 @@
+#include "PML_Layer.h"
+
+#include <cmath>
+#include <string>
+
+#include "Params.h"
+#include "Patch.h"
+#include "ElectroMagn.h"
+#include "Field2D.h"
+#include "Field3D.h"
+
+using namespace std;
+
+PML_Layer::PML_Layer( Params& params, Patch* patch, unsigned int min_max )
+{
+    idim = min_max/2;
+    dt   = params.timestep;
+    dh   = params.cell_length[idim];
+    start[0] = end[0] = start[1] = end[1] = 0;
+
+    if ( !patch->locateOnBorders( idim, min_max%2 ) )
+        return;
+
+    // Profiles of the layer :  sigma = sigma_max u^m ,  alpha = alpha_max (1-u) ,  u = depth in the layer (0 to 1)
+    const double m = 3.;
+    const double sigma_max = 0.8*( m+1. )/dh;
+    const double alpha_max = 0.1;
+    double npml = params.number_of_pml_cells;
+    double nglobal = params.n_space_global[idim];
+    int    first = patch->getCellStartingGlobalIndex( idim );
+
+    // Nodes of the patch along idim (ghost cells included)
+    unsigned int n_p = params.n_space[idim]+1+2*params.oversize[idim];
+    for ( unsigned int dual=0 ; dual<2 ; dual++ ) {
+        vector<double> depth( n_p+dual );
+        for ( unsigned int i=0 ; i<n_p+dual ; i++ ) {
+            double position = first + (double)i - 0.5*dual;
+            depth[i] = ( min_max%2==0 ) ? ( npml-position )/npml : ( position-( nglobal-npml ) )/npml;
+        }
+        start[dual] = n_p+dual;
+        end  [dual] = 0;
+        for ( unsigned int i=0 ; i<n_p+dual ; i++ ) {
+            if ( depth[i] > 0. ) {
+                if ( i<start[dual] ) start[dual] = i;
+                end[dual] = i+1;
+            }
+        }
+        if ( end[dual] < start[dual] ) start[dual] = end[dual];
+        for ( unsigned int i=start[dual] ; i<end[dual] ; i++ ) {
+            double u     = min( depth[i], 1. );
+            double sigma = sigma_max*pow( u, m );
+            double alpha = alpha_max*( 1.-u );
+            b[dual].push_back( exp( -( sigma+alpha )*dt ) );
+            a[dual].push_back( sigma/( sigma+alpha )*( b[dual].back()-1. ) );
+        }
+    }
+
+    // Auxiliary fields of the components E_(d+1), E_(d+2) (primal along d) and B_(d+1), B_(d+2) (dual along d)
+    for ( unsigned int ifield=0 ; ifield<4 ; ifield++ ) {
+        unsigned int component = ( idim+1+ifield%2 )%3;
+        bool onB = ( ifield>=2 );
+        vector<unsigned int> dims( params.nDim_field );
+        for ( unsigned int i=0 ; i<params.nDim_field ; i++ ) {
+            bool dual = onB ? ( i!=component ) : ( i==component );
+            dims[i] = ( i==idim ) ? end[dual]-start[dual] : params.n_space[i]+1+2*params.oversize[i]+dual;
+        }
+        string name = string( "psi_" ) + ( onB ? "B" : "E" ) + "xyz"[component];
+        if ( params.nDim_field==2 )
+            psi.push_back( new Field2D( dims, name ) );
+        else
+            psi.push_back( new Field3D( dims, name ) );
+    }
+
+}
+
+PML_Layer::~PML_Layer()
+{
+    for ( unsigned int i=0 ; i<psi.size() ; i++ )
+        delete psi[i];
+}
+
+void PML_Layer::applyE( ElectroMagn* EMfields )
+{
+    if ( psi.empty() ) return;
+
+    Field* E[3] = { EMfields->Ex_, EMfields->Ey_, EMfields->Ez_ };
+    Field* B[3] = { EMfields->Bx_, EMfields->By_, EMfields->Bz_ };
+    unsigned int c1 = ( idim+1 )%3, c2 = ( idim+2 )%3;
+
+    // E_(d+1) -= dt dB_(d+2)/dd ,  E_(d+2) += dt dB_(d+1)/dd
+    update( E[c1], B[c2], psi[0], -1., false, false );
+    update( E[c2], B[c1], psi[1],  1., false, false );
+}
+
+void PML_Layer::applyB( ElectroMagn* EMfields )
+{
+    if ( psi.empty() ) return;
+
+    Field* E[3] = { EMfields->Ex_, EMfields->Ey_, EMfields->Ez_ };
+    Field* B[3] = { EMfields->Bx_, EMfields->By_, EMfields->Bz_ };
+    unsigned int c1 = ( idim+1 )%3, c2 = ( idim+2 )%3;
+
+    // B_(d+1) += dt dE_(d+2)/dd ,  B_(d+2) -= dt dE_(d+1)/dd
+    update( B[c1], E[c2], psi[2],  1., true, true );
+    update( B[c2], E[c1], psi[3], -1., true, true );
+}
+
+void PML_Layer::update( Field* F, Field* G, Field* psi, double sign, bool dual, bool onB )
+{
+    // Dimensions of F, G and psi (1 for unused dimensions)
+    unsigned int nF[3] = { 1, 1, 1 }, nG[3] = { 1, 1, 1 }, nP[3] = { 1, 1, 1 };
+    for ( unsigned int i=0 ; i<F->dims_.size() ; i++ ) {
+        nF[i] = F->dims_[i];
+        nG[i] = G->dims_[i];
+        nP[i] = psi->dims_[i];
+    }
+
+    // Points updated by the Yee solver : all points for E, interior points along dual dimensions for B
+    unsigned int lo[3], hi[3];
+    for ( unsigned int i=0 ; i<3 ; i++ ) {
+        bool interior = onB && ( i<F->dims_.size() ) && F->isDual( i );
+        lo[i] = interior ? 1 : 0;
+        hi[i] = interior ? nF[i]-1 : nF[i];
+    }
+    lo[idim] = max( lo[idim], start[dual] );
+    hi[idim] = min( hi[idim], end  [dual] );
+
+    // The derivative is  G(i+1)-G(i)  for E (primal along idim) and  G(i)-G(i-1)  for B (dual along idim)
+    unsigned int strideG[3] = { nG[1]*nG[2], nG[2], 1 };
+    int shift = onB ? 0 : 1;
+    double one_ov_dh = 1./dh;
+    double sign_dt = sign*dt;
+
+    unsigned int id[3];
+    for ( id[0]=lo[0] ; id[0]<hi[0] ; id[0]++ ) {
+        for ( id[1]=lo[1] ; id[1]<hi[1] ; id[1]++ ) {
+            for ( id[2]=lo[2] ; id[2]<hi[2] ; id[2]++ ) {
+                unsigned int il = id[idim]-start[dual];
+                unsigned int iF = ( id[0]*nF[1] + id[1] )*nF[2] + id[2];
+                unsigned int iG = ( id[0]*nG[1] + id[1] )*nG[2] + id[2] + shift*strideG[idim];
+                unsigned int jP[3] = { id[0], id[1], id[2] };
+                jP[idim] = il;
+                unsigned int iP = ( jP[0]*nP[1] + jP[1] )*nP[2] + jP[2];
+
+                double dG = ( G->data_[iG] - G->data_[iG-strideG[idim]] )*one_ov_dh;
+                psi->data_[iP] = b[dual][il]*psi->data_[iP] + a[dual][il]*dG;
+                F->data_[iF] += sign_dt*psi->data_[iP];
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef PML_LAYER_H
+#define PML_LAYER_H
+
+#include <vector>
+
+class Params;
+class Patch;
+class ElectroMagn;
+class Field;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PML_Layer
+//! Convolutional PML (CFS-CPML, Roden & Gedney 2000) located in the last number_of_pml_cells cells of the box, next
+//! to one side of the box (2D & 3D cartesian, Yee solver). The spatial derivatives normal to this side are stretched
+//! through auxiliary fields psi, updated by recursive convolution after the Maxwell-Ampere and Maxwell-Faraday solvers:
+//!     psi = b psi + a dF/dx    and    the Yee update of each transverse component gets the additional term  dt psi
+//! Only boundary patches own a layer. As the Yee solver, it is applied on all points of the patch (ghost cells included)
+//! so that the fields stay consistent between neighbouring patches along the boundary.
+//  --------------------------------------------------------------------------------------------------------------------
+class PML_Layer
+{
+
+public:
+    //! Creator for PML_Layer, along the side min_max (0:xmin 1:xmax 2:ymin 3:ymax 4:zmin 5:zmax) of the patch
+    PML_Layer( Params& params, Patch* patch, unsigned int min_max );
+    ~PML_Layer();
+
+    //! Corrections of the transverse components of E (after the Maxwell-Ampere solver)
+    void applyE( ElectroMagn* EMfields );
+    //! Corrections of the transverse components of B (after the Maxwell-Faraday solver)
+    void applyB( ElectroMagn* EMfields );
+
+    //! Auxiliary fields: E and B components (d+1)%3 and (d+2)%3, d being the normal dimension (empty if not on the side)
+    std::vector<Field*> psi;
+
+private:
+    //! Dimension normal to the side
+    unsigned int idim;
+
+    double dt;
+    double dh;
+
+    //! Range of the nodes of the layer along idim (primal [0] and dual [1] indices) : [start, end[
+    unsigned int start[2], end[2];
+
+    //! Coefficients of the recursive convolution of the nodes of the layer (primal [0] and dual [1])
+    std::vector<double> a[2], b[2];
+
+    //! psi = b psi + a ( G(+offset) - G(offset-1) )/dh ;  F += sign dt psi  on the points of the layer
+    void update( Field* F, Field* G, Field* psi, double sign, bool dual, bool onB );
+};
+
+#endif
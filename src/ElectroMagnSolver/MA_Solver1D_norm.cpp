@@ -4,8 +4,10 @@
 #include "ElectroMagn.h"
 #include "Field1D.h"
 
-MA_Solver1D_norm::MA_Solver1D_norm(Params &params)
-    : Solver1D(params)
+#include <algorithm>
+
+MA_Solver1D_norm::MA_Solver1D_norm(Params &params, std::vector<unsigned int> n_space)
+    : Solver1D(params, n_space)
 {
 }
 
@@ -14,6 +16,11 @@ MA_Solver1D_norm::~MA_Solver1D_norm()
 }
 
 void MA_Solver1D_norm::operator() ( ElectroMagn* fields )
+{
+    (*this)( fields, 0, nx_d );
+}
+
+void MA_Solver1D_norm::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
     Field1D* Ex1D = static_cast<Field1D*>(fields->Ex_);
     Field1D* Ey1D = static_cast<Field1D*>(fields->Ey_);
@@ -28,11 +35,11 @@ void MA_Solver1D_norm::operator() ( ElectroMagn* fields )
     // Solve Maxwell-Ampere
     // --------------------
     // Calculate the electrostatic field ex on the dual grid
-    for (unsigned int ix=0 ; ix<nx_d ; ix++) {
+    for (unsigned int ix=istart ; ix<std::min( iend, nx_d ) ; ix++) {
         (*Ex1D)(ix)= (*Ex1D)(ix) - dt * (*Jx1D)(ix) ;
     }
     // Transverse fields ey, ez  are defined on the primal grid
-    for (unsigned int ix=0 ; ix<nx_p ; ix++) {
+    for (unsigned int ix=istart ; ix<std::min( iend, nx_p ) ; ix++) {
         (*Ey1D)(ix)= (*Ey1D)(ix) - dt_ov_dx * ( (*Bz1D)(ix+1) - (*Bz1D)(ix)) - dt * (*Jy1D)(ix) ;
         (*Ez1D)(ix)= (*Ez1D)(ix) + dt_ov_dx * ( (*By1D)(ix+1) - (*By1D)(ix)) - dt * (*Jz1D)(ix) ;
     }
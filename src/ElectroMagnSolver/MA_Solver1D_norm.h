@@ -12,11 +12,12 @@ class MA_Solver1D_norm : public Solver1D
 
 public:
     //! Creator for MF_Solver1D_Yee
-    MA_Solver1D_norm(Params &params);
+    MA_Solver1D_norm(Params &params, std::vector<unsigned int> n_space);
     virtual ~MA_Solver1D_norm();
 
     //! Overloading of () operator
     virtual void operator()( ElectroMagn* fields);
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
 
 protected:
 
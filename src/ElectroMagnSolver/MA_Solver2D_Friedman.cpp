@@ -4,8 +4,8 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
-MA_Solver2D_Friedman::MA_Solver2D_Friedman(Params &params)
-: Solver2D(params)
+MA_Solver2D_Friedman::MA_Solver2D_Friedman(Params &params, std::vector<unsigned int> n_space)
+: Solver2D(params, n_space)
 {
     ftheta = params.Friedman_theta;
     alpha  = 1.-0.5*ftheta+0.5*ftheta*ftheta;
@@ -12,7 +12,7 @@ class MA_Solver2D_Friedman : public Solver2D
 
 public:
     //! Creator for MF_Solver2D_Yee
-    MA_Solver2D_Friedman(Params &params);
+    MA_Solver2D_Friedman(Params &params, std::vector<unsigned int> n_space);
     virtual ~MA_Solver2D_Friedman();
 
     //! Overloading of () operator
@@ -4,8 +4,10 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
-MA_Solver2D_norm::MA_Solver2D_norm(Params &params)
-: Solver2D(params)
+#include <algorithm>
+
+MA_Solver2D_norm::MA_Solver2D_norm(Params &params, std::vector<unsigned int> n_space)
+: Solver2D(params, n_space)
 {
 }
 
@@ -14,6 +16,11 @@ MA_Solver2D_norm::~MA_Solver2D_norm()
 }
 
 void MA_Solver2D_norm::operator() ( ElectroMagn* fields )
+{
+    (*this)( fields, 0, nx_d );
+}
+
+void MA_Solver2D_norm::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
 
     // Static-cast of the fields
@@ -27,21 +34,21 @@ void MA_Solver2D_norm::operator() ( ElectroMagn* fields )
     Field2D* Jy2D = static_cast<Field2D*>(fields->Jy_);
     Field2D* Jz2D = static_cast<Field2D*>(fields->Jz_);
     // Electric field Ex^(d,p)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_d ) ; i++) {
         for (unsigned int j=0 ; j<ny_p ; j++) {
             (*Ex2D)(i,j) += -dt*(*Jx2D)(i,j) + dt_ov_dy * ( (*Bz2D)(i,j+1) - (*Bz2D)(i,j) );
         }
     }
     
     // Electric field Ey^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_p ) ; i++) {
         for (unsigned int j=0 ; j<ny_d ; j++) {
             (*Ey2D)(i,j) += -dt*(*Jy2D)(i,j) - dt_ov_dx * ( (*Bz2D)(i+1,j) - (*Bz2D)(i,j) );
         }
     }
     
     // Electric field Ez^(p,p)
-    for (unsigned int i=0 ;  i<nx_p ; i++) {
+    for (unsigned int i=istart ; i<std::min( iend, nx_p ) ; i++) {
         for (unsigned int j=0 ; j<ny_p ; j++) {
             (*Ez2D)(i,j) += -dt*(*Jz2D)(i,j)
             +               dt_ov_dx * ( (*By2D)(i+1,j) - (*By2D)(i,j) )
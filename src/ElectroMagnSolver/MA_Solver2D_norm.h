@@ -12,11 +12,12 @@ class MA_Solver2D_norm : public Solver2D
 
 public:
     //! Creator for MF_Solver2D_Yee
-    MA_Solver2D_norm(Params &params);
+    MA_Solver2D_norm(Params &params, std::vector<unsigned int> n_space);
     virtual ~MA_Solver2D_norm();
 
     //! Overloading of () operator
     virtual void operator()( ElectroMagn* fields);
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
 
 protected:
 
@@ -1,11 +1,12 @@
-
 #include "MA_Solver3D_norm.h"
 
 #include "ElectroMagn.h"
 #include "Field3D.h"
 
-MA_Solver3D_norm::MA_Solver3D_norm(Params &params)
-: Solver3D(params)
+#include <algorithm>
+
+MA_Solver3D_norm::MA_Solver3D_norm(Params &params, std::vector<unsigned int> n_space)
+: Solver3D(params, n_space)
 {
 }
 
@@ -14,6 +15,11 @@ MA_Solver3D_norm::~MA_Solver3D_norm()
 }
 
 void MA_Solver3D_norm::operator() ( ElectroMagn* fields )
+{
+    (*this)( fields, 0, nx_d );
+}
+
+void MA_Solver3D_norm::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
 
     // Static-cast of the fields
@@ -27,38 +33,62 @@ void MA_Solver3D_norm::operator() ( ElectroMagn* fields )
     Field3D* Jy3D = static_cast<Field3D*>(fields->Jy_);
     Field3D* Jz3D = static_cast<Field3D*>(fields->Jz_);
 
-    // Electric field Ex^(d,p,p)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            for (unsigned int k=0 ; k<nz_p ; k++) {
-                (*Ex3D)(i,j,k) += -dt*(*Jx3D)(i,j,k)
-                +                 dt_ov_dy * ( (*Bz3D)(i,j+1,k) - (*Bz3D)(i,j,k) )
-                -                 dt_ov_dz * ( (*By3D)(i,j,k+1) - (*By3D)(i,j,k) );
-            }
-        }
-    }
-    
-    // Electric field Ey^(p,d,p)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            for (unsigned int k=0 ; k<nz_p ; k++) {
-                (*Ey3D)(i,j,k) += -dt*(*Jy3D)(i,j,k)
-                -                  dt_ov_dx * ( (*Bz3D)(i+1,j,k) - (*Bz3D)(i,j,k) )
-                +                  dt_ov_dz * ( (*Bx3D)(i,j,k+1) - (*Bx3D)(i,j,k) );
-            }
-        }
-    }
-    
-    // Electric field Ez^(p,p,d)
-    for (unsigned int i=0 ;  i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            for (unsigned int k=0 ; k<nz_d ; k++) {
-                (*Ez3D)(i,j,k) += -dt*(*Jz3D)(i,j,k)
-                +                  dt_ov_dx * ( (*By3D)(i+1,j,k) - (*By3D)(i,j,k) )
-                -                  dt_ov_dy * ( (*Bx3D)(i,j+1,k) - (*Bx3D)(i,j,k) );
+    // Blocks of rows along y, the three components being updated row by row,
+    // with contiguous (vectorized) loops along z
+    for (unsigned int j0=0 ; j0<ny_d ; j0+=ny_block) {
+        unsigned int j1 = std::min( j0+ny_block, ny_d );
+        for (unsigned int i=istart ; i<std::min( iend, nx_d ) ; i++) {
+            for (unsigned int j=j0 ; j<j1 ; j++) {
+
+                // Electric field Ex^(d,p,p)
+                if ( j<ny_p ) {
+                    field_t* ex  = &(*Ex3D)(i,j,0);
+                    field_t* jx  = &(*Jx3D)(i,j,0);
+                    field_t* bz  = &(*Bz3D)(i,j,0);
+                    field_t* bz1 = &(*Bz3D)(i,j+1,0);
+                    field_t* by  = &(*By3D)(i,j,0);
+                    #pragma omp simd
+                    for (unsigned int k=0 ; k<nz_p ; k++) {
+                        ex[k] += -dt*jx[k]
+                        +        dt_ov_dy * ( bz1[k] - bz[k] )
+                        -        dt_ov_dz * ( by[k+1] - by[k] );
+                    }
+                }
+
+                if ( i==nx_p ) continue;
+
+                // Electric field Ey^(p,d,p)
+                field_t* ey  = &(*Ey3D)(i,j,0);
+                field_t* jy  = &(*Jy3D)(i,j,0);
+                field_t* bz  = &(*Bz3D)(i,j,0);
+                field_t* bz1 = &(*Bz3D)(i+1,j,0);
+                field_t* bx  = &(*Bx3D)(i,j,0);
+                #pragma omp simd
+                for (unsigned int k=0 ; k<nz_p ; k++) {
+                    ey[k] += -dt*jy[k]
+                    -         dt_ov_dx * ( bz1[k] - bz[k] )
+                    +         dt_ov_dz * ( bx[k+1] - bx[k] );
+                }
+
+                // Electric field Ez^(p,p,d)
+                if ( j<ny_p ) {
+                    field_t* ez  = &(*Ez3D)(i,j,0);
+                    field_t* jz  = &(*Jz3D)(i,j,0);
+                    field_t* by  = &(*By3D)(i,j,0);
+                    field_t* by1 = &(*By3D)(i+1,j,0);
+                    field_t* bx  = &(*Bx3D)(i,j,0);
+                    field_t* bx1 = &(*Bx3D)(i,j+1,0);
+                    #pragma omp simd
+                    for (unsigned int k=0 ; k<nz_d ; k++) {
+                        ez[k] += -dt*jz[k]
+                        +         dt_ov_dx * ( by1[k] - by[k] )
+                        -         dt_ov_dy * ( bx1[k] - bx[k] );
+                    }
+                }
             }
         }
     }
 
 }
 
+
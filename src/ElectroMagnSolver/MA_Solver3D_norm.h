@@ -11,11 +11,12 @@ class MA_Solver3D_norm : public Solver3D
 {
 
 public:
-    MA_Solver3D_norm(Params &params);
+    MA_Solver3D_norm(Params &params, std::vector<unsigned int> n_space);
     virtual ~MA_Solver3D_norm();
 
     //! Overloading of () operator
     virtual void operator()( ElectroMagn* fields);
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
 
 protected:
 
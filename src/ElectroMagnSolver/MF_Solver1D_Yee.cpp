@@ -4,8 +4,10 @@
 #include "ElectroMagn.h"
 #include "Field1D.h"
 
-MF_Solver1D_Yee::MF_Solver1D_Yee(Params &params)
-    : Solver1D(params)
+#include <algorithm>
+
+MF_Solver1D_Yee::MF_Solver1D_Yee(Params &params, std::vector<unsigned int> n_space)
+    : Solver1D(params, n_space)
 {
 }
 
@@ -14,11 +16,21 @@ MF_Solver1D_Yee::~MF_Solver1D_Yee()
 }
 
 void MF_Solver1D_Yee::operator() ( ElectroMagn* fields )
+{
+    (*this)( fields, 0, nx_d );
+}
+
+void MF_Solver1D_Yee::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
     Field1D* Ey1D   = static_cast<Field1D*>(fields->Ey_);
     Field1D* Ez1D   = static_cast<Field1D*>(fields->Ez_);
     Field1D* By1D   = static_cast<Field1D*>(fields->By_);
     Field1D* Bz1D   = static_cast<Field1D*>(fields->Bz_);
+    // Former B (see ElectroMagn1D::saveMagneticFields)
+    Field1D* Bx1D   = static_cast<Field1D*>(fields->Bx_);
+    Field1D* Bx1D_m = static_cast<Field1D*>(fields->Bx_m);
+    Field1D* By1D_m = static_cast<Field1D*>(fields->By_m);
+    Field1D* Bz1D_m = static_cast<Field1D*>(fields->Bz_m);
     
     // ---------------------
     // Solve Maxwell-Faraday
@@ -26,9 +38,16 @@ void MF_Solver1D_Yee::operator() ( ElectroMagn* fields )
     // NB: bx is given in 1d and defined when initializing the fields (here put to 0)
     // Transverse fields  by & bz are defined on the dual grid
     //for (unsigned int ix=1 ; ix<nx_p ; ix++) {
-    for (unsigned int ix=1 ; ix<nx_d-1 ; ix++) {
-        (*By1D)(ix)= (*By1D)(ix) + dt_ov_dx * ( (*Ez1D)(ix) - (*Ez1D)(ix-1)) ;
-        (*Bz1D)(ix)= (*Bz1D)(ix) - dt_ov_dx * ( (*Ey1D)(ix) - (*Ey1D)(ix-1)) ;
+    for (unsigned int ix=std::max( istart, 1u ) ; ix<std::min( iend, nx_d-1 ) ; ix++) {
+        (*By1D)(ix)= (*By1D_m)(ix) + dt_ov_dx * ( (*Ez1D)(ix) - (*Ez1D)(ix-1)) ;
+        (*Bz1D)(ix)= (*Bz1D_m)(ix) - dt_ov_dx * ( (*Ey1D)(ix) - (*Ey1D)(ix-1)) ;
     } 
+    
+    // Points not updated by the solver
+    for (unsigned int ix=istart ; ix<std::min( iend, nx_p ) ; ix++) {
+        (*Bx1D)(ix) = (*Bx1D_m)(ix);
+    }
+    copyDualFaces( By1D, By1D_m, istart, iend );
+    copyDualFaces( Bz1D, Bz1D_m, istart, iend );
 }
 
@@ -6,8 +6,8 @@
 
 #include <algorithm>
 
-MF_Solver2D_Cowan::MF_Solver2D_Cowan(Params &params)
-: Solver2D(params)
+MF_Solver2D_Cowan::MF_Solver2D_Cowan(Params &params, std::vector<unsigned int> n_space)
+: Solver2D(params, n_space)
 {
     ERROR("Under development, not yet working");
     dx = params.cell_length[0];
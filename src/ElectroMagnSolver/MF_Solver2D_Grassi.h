@@ -12,7 +12,7 @@ class MF_Solver2D_Grassi : public Solver2D
 
 public:
     //! Creator for MF_Solver2D_Yee
-    MF_Solver2D_Grassi(Params &params);
+    MF_Solver2D_Grassi(Params &params, std::vector<unsigned int> n_space);
     virtual ~MF_Solver2D_Grassi();
 
     //! Overloading of () operator
@@ -4,8 +4,8 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
-MF_Solver2D_GrassiSpL::MF_Solver2D_GrassiSpL(Params &params)
-: Solver2D(params)
+MF_Solver2D_GrassiSpL::MF_Solver2D_GrassiSpL(Params &params, std::vector<unsigned int> n_space)
+: Solver2D(params, n_space)
 {
     
     double dt    = params.timestep;
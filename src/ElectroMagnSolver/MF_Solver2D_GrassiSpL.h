@@ -12,7 +12,7 @@ class MF_Solver2D_GrassiSpL : public Solver2D
 
 public:
     //! Creator for MF_Solver2D_Yee
-    MF_Solver2D_GrassiSpL(Params &params);
+    MF_Solver2D_GrassiSpL(Params &params, std::vector<unsigned int> n_space);
     virtual ~MF_Solver2D_GrassiSpL();
 
     //! Overloading of () operator
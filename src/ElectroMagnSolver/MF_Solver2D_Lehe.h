@@ -12,7 +12,7 @@ class MF_Solver2D_Lehe : public Solver2D
 
 public:
     //! Creator for MF_Solver2D_Lehe
-    MF_Solver2D_Lehe(Params &params);
+    MF_Solver2D_Lehe(Params &params, std::vector<unsigned int> n_space);
     virtual ~MF_Solver2D_Lehe();
 
     //! Overloading of () operator
@@ -4,8 +4,10 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
-MF_Solver2D_Yee::MF_Solver2D_Yee(Params &params)
-: Solver2D(params)
+#include <algorithm>
+
+MF_Solver2D_Yee::MF_Solver2D_Yee(Params &params, std::vector<unsigned int> n_space)
+: Solver2D(params, n_space)
 {
     isEFilterApplied = false;
     if (params.Friedman_filter)
@@ -17,6 +19,11 @@ MF_Solver2D_Yee::~MF_Solver2D_Yee()
 }
 
 void MF_Solver2D_Yee::operator() ( ElectroMagn* fields )
+{
+    (*this)( fields, 0, nx_d );
+}
+
+void MF_Solver2D_Yee::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
     // Static-cast of the fields
     Field2D* Ex2D;
@@ -32,21 +39,25 @@ void MF_Solver2D_Yee::operator() ( ElectroMagn* fields )
     Field2D* Bx2D = static_cast<Field2D*>(fields->Bx_);
     Field2D* By2D = static_cast<Field2D*>(fields->By_);
     Field2D* Bz2D = static_cast<Field2D*>(fields->Bz_);
+    // Former B (see ElectroMagn2D::saveMagneticFields)
+    Field2D* Bx2D_m = static_cast<Field2D*>(fields->Bx_m);
+    Field2D* By2D_m = static_cast<Field2D*>(fields->By_m);
+    Field2D* Bz2D_m = static_cast<Field2D*>(fields->Bz_m);
     
     // Magnetic field Bx^(p,d)
     //cout << "nx_p,nx_d-1" << nx_p << " " << nx_d-1 ;
     //{
-    {
+    if ( istart==0 ) {
         #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bx2D)(0,j) -= dt_ov_dy * ( (*Ez2D)(0,j) - (*Ez2D)(0,j-1) );
+            (*Bx2D)(0,j) = (*Bx2D_m)(0,j) - dt_ov_dy * ( (*Ez2D)(0,j) - (*Ez2D)(0,j-1) );
         }
     }
     //    for (unsigned int i=0 ; i<nx_p;  i++) {
-    for (unsigned int i=1 ; i<nx_d-1;  i++) {
+    for (unsigned int i=std::max( istart, 1u ) ; i<std::min( iend, nx_d-1 );  i++) {
         #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bx2D)(i,j) -= dt_ov_dy * ( (*Ez2D)(i,j) - (*Ez2D)(i,j-1) );
+            (*Bx2D)(i,j) = (*Bx2D_m)(i,j) - dt_ov_dy * ( (*Ez2D)(i,j) - (*Ez2D)(i,j-1) );
         }
         //    }
         
@@ -54,7 +65,7 @@ void MF_Solver2D_Yee::operator() ( ElectroMagn* fields )
         //    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
         #pragma omp simd
         for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*By2D)(i,j) += dt_ov_dx * ( (*Ez2D)(i,j) - (*Ez2D)(i-1,j) );
+            (*By2D)(i,j) = (*By2D_m)(i,j) + dt_ov_dx * ( (*Ez2D)(i,j) - (*Ez2D)(i-1,j) );
         }
         //}
         
@@ -62,10 +73,15 @@ void MF_Solver2D_Yee::operator() ( ElectroMagn* fields )
         //for (unsigned int i=1 ; i<nx_d-1 ; i++) {
         #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bz2D)(i,j) += dt_ov_dy * ( (*Ex2D)(i,j) - (*Ex2D)(i,j-1) )
-            -               dt_ov_dx * ( (*Ey2D)(i,j) - (*Ey2D)(i-1,j) );
+            (*Bz2D)(i,j) = (*Bz2D_m)(i,j) + ( dt_ov_dy * ( (*Ex2D)(i,j) - (*Ex2D)(i,j-1) )
+            -                                 dt_ov_dx * ( (*Ey2D)(i,j) - (*Ey2D)(i-1,j) ) );
         }
     }
     //}// end parallel
+    
+    // Points not updated by the solver
+    copyDualFaces( Bx2D, Bx2D_m, istart, iend );
+    copyDualFaces( By2D, By2D_m, istart, iend );
+    copyDualFaces( Bz2D, Bz2D_m, istart, iend );
 }
 
@@ -12,11 +12,15 @@ class MF_Solver2D_Yee : public Solver2D
 
 public:
     //! Creator for MF_Solver2D_Yee
-    MF_Solver2D_Yee(Params &params);
+    MF_Solver2D_Yee(Params &params, std::vector<unsigned int> n_space);
     virtual ~MF_Solver2D_Yee();
 
     //! Overloading of () operator
     virtual void operator()( ElectroMagn* fields);
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
+    
+    //! B is computed from B_m (the former B)
+    bool isOutOfPlace() { return true; };
 
 protected:
     // Check if time filter is applied or not
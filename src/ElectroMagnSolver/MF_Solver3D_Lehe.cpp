@@ -7,8 +7,8 @@
 
 #include <algorithm>
 
-MF_Solver3D_Lehe::MF_Solver3D_Lehe(Params &params)
-    : Solver3D(params)
+MF_Solver3D_Lehe::MF_Solver3D_Lehe(Params &params, std::vector<unsigned int> n_space)
+    : Solver3D(params, n_space)
 {
     dx = params.cell_length[0];
     dy = params.cell_length[1];
@@ -41,46 +41,68 @@ void MF_Solver3D_Lehe::operator() ( ElectroMagn* fields )
     ElectroMagn3D* EM3D = static_cast<ElectroMagn3D*>(fields); 
 
 
-    // Magnetic field Bx^(p,d,d)
-    for (unsigned int i=1 ; i<nx_p-1;  i++) {
-        for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            for (unsigned int k=1 ; k<nz_d-1 ; k++) {
-                (*Bx3D)(i,j,k) += -dt_ov_dy * (  alpha_y * ( (*Ez3D)(i,  j,k)  - (*Ez3D)(i,  j-1,k)                                      )
-                                               + beta_yx * ( (*Ez3D)(i+1,j,k)  - (*Ez3D)(i+1,j-1,k) + (*Ez3D)(i-1,j,k)-(*Ez3D)(i-1,j-1,k))
-                                              )
-                                  +dt_ov_dz * ( /*alpha_z*/ alpha_y * ( (*Ey3D)(i  ,j  ,k)-(*Ey3D)(i  ,j,k-1))                                         
-                                              +/*beta_zx*/ beta_yx * ( (*Ey3D)(i+1,j  ,k)-(*Ey3D)(i+1,j,k-1) + (*Ey3D)(i-1,j  ,k)-(*Ey3D)(i-1,j,k-1)) 
-                                              );
-            }
-        }
-    }
-    
-    // Magnetic field By^(d,p,d)
-    for (unsigned int i=2 ; i<nx_d-2 ; i++) {
-        for (unsigned int j=1 ; j<ny_p-1 ; j++) {
-            for (unsigned int k=1 ; k<nz_d-1 ; k++) {
-                (*By3D)(i,j,k) += dt_ov_dx * (  alpha_x * ( (*Ez3D)(i,  j  ,k  ) - (*Ez3D)(i-1,j  ,k  ))
-                                              + beta_xy * ( (*Ez3D)(i,  j+1,k  ) - (*Ez3D)(i-1,j+1,k  ) + (*Ez3D)(i  ,j-1,k  )-(*Ez3D)(i-1,j-1,k) )
-                                              + beta_xz * ( (*Ez3D)(i  ,j  ,k+1) - (*Ez3D)(i-1,j  ,k+1) + (*Ez3D)(i  ,j  ,k-1)-(*Ez3D)(i-1,j  ,k-1))
-                                              + delta_x * ( (*Ez3D)(i+1,j  ,k  ) - (*Ez3D)(i-2,j  ,k)))
-                                 -dt_ov_dz * ( /*alpha_z*/ alpha_y * ( (*Ex3D)(i  ,j  ,k)-(*Ex3D)(i  ,j,k-1))                                         
-                                              +/*beta_zx*/ beta_yx * ( (*Ex3D)(i+1,j  ,k)-(*Ex3D)(i+1,j,k-1) + (*Ex3D)(i-1,j  ,k)-(*Ex3D)(i-1,j,k-1)) 
-                                             ); 
-            }
-        }
-    }
-    
-    
-    // Magnetic field Bz^(d,d,p)
-    for (unsigned int i=2 ; i<nx_d-2 ; i++) {
-        for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            for (unsigned int k=1 ; k<nz_p-1 ; k++) {
-                (*Bz3D)(i,j,k) += dt_ov_dy * (  alpha_y * ( (*Ex3D)(i  ,j  ,k  )-(*Ex3D)(i    ,j-1,k))
-                                              + beta_yx * ( (*Ex3D)(i+1,j  ,k  )-(*Ex3D)(i+1  ,j-1,k)   + (*Ex3D)(i-1,j  ,k  )-(*Ex3D)(i-1,j-1,k  )))
-                                - dt_ov_dx * (  alpha_x * ( (*Ey3D)(i  ,j  ,k  )-(*Ey3D)(i-1  ,j  ,k))
-                                              + beta_xy * ( (*Ey3D)(i  ,j+1,k  )-(*Ey3D)(i-1  ,j+1,k)   + (*Ey3D)(i  ,j-1,k  )-(*Ey3D)(i-1,j-1,k  ))
-                                              + beta_xz * ( (*Ey3D)(i  ,j  ,k+1)-(*Ey3D)(i-1  ,j  ,k+1) + (*Ey3D)(i  ,j  ,k-1)-(*Ey3D)(i-1,j  ,k-1))
-                                              + delta_x * ( (*Ey3D)(i+1,j  ,k  )-(*Ey3D)(i-2  ,j  ,k) ) );
+    // Strides along x and y of E
+    const int sx_Ex = ny_p*nz_p, sy_Ex = nz_p;
+    const int sx_Ey = ny_d*nz_p, sy_Ey = nz_p;
+    const int sx_Ez = ny_p*nz_d, sy_Ez = nz_d;
+
+    // Blocks of rows along y, the three components being updated row by row,
+    // with contiguous (vectorized) loops along z
+    for (unsigned int j0=0 ; j0<ny_d ; j0+=ny_block) {
+        unsigned int j1 = std::min( j0+ny_block, ny_d );
+        for (unsigned int i=1 ; i<nx_d-2 ; i++) {
+            for (unsigned int j=std::max(j0,1u) ; j<j1 ; j++) {
+
+                // Magnetic field Bx^(p,d,d)
+                if ( i<nx_p-1 && j<ny_d-1 ) {
+                    field_t* bx = &(*Bx3D)(i,j,0);
+                    field_t* ez = &(*Ez3D)(i,j,0);
+                    field_t* ey = &(*Ey3D)(i,j,0);
+                    #pragma omp simd
+                    for (int k=1 ; k<(int)nz_d-1 ; k++) {
+                        bx[k] += -dt_ov_dy * (  alpha_y * ( ez[k]       - ez[k-sy_Ez]                                                           )
+                                              + beta_yx * ( ez[k+sx_Ez] - ez[k+sx_Ez-sy_Ez] + ez[k-sx_Ez]-ez[k-sx_Ez-sy_Ez])
+                                             )
+                                 +dt_ov_dz * ( /*alpha_z*/ alpha_y * ( ey[k]      -ey[k-1])
+                                             +/*beta_zx*/ beta_yx * ( ey[k+sx_Ey]-ey[k+sx_Ey-1] + ey[k-sx_Ey]-ey[k-sx_Ey-1])
+                                             );
+                    }
+                }
+
+                if ( i==1 ) continue;
+
+                // Magnetic field By^(d,p,d)
+                if ( j<ny_p-1 ) {
+                    field_t* by = &(*By3D)(i,j,0);
+                    field_t* ez = &(*Ez3D)(i,j,0);
+                    field_t* ex = &(*Ex3D)(i,j,0);
+                    #pragma omp simd
+                    for (int k=1 ; k<(int)nz_d-1 ; k++) {
+                        by[k] += dt_ov_dx * (  alpha_x * ( ez[k        ] - ez[k-sx_Ez        ])
+                                             + beta_xy * ( ez[k+sy_Ez  ] - ez[k-sx_Ez+sy_Ez  ] + ez[k-sy_Ez  ]-ez[k-sx_Ez-sy_Ez] )
+                                             + beta_xz * ( ez[k+1      ] - ez[k-sx_Ez+1      ] + ez[k-1      ]-ez[k-sx_Ez-1    ])
+                                             + delta_x * ( ez[k+sx_Ez  ] - ez[k-2*sx_Ez      ]))
+                                -dt_ov_dz * ( /*alpha_z*/ alpha_y * ( ex[k      ]-ex[k-1      ])
+                                             +/*beta_zx*/ beta_yx * ( ex[k+sx_Ex]-ex[k+sx_Ex-1] + ex[k-sx_Ex]-ex[k-sx_Ex-1])
+                                            );
+                    }
+                }
+
+                // Magnetic field Bz^(d,d,p)
+                if ( j<ny_d-1 ) {
+                    field_t* bz = &(*Bz3D)(i,j,0);
+                    field_t* ex = &(*Ex3D)(i,j,0);
+                    field_t* ey = &(*Ey3D)(i,j,0);
+                    #pragma omp simd
+                    for (int k=1 ; k<(int)nz_p-1 ; k++) {
+                        bz[k] += dt_ov_dy * (  alpha_y * ( ex[k      ]-ex[k-sy_Ex      ])
+                                             + beta_yx * ( ex[k+sx_Ex]-ex[k+sx_Ex-sy_Ex]   + ex[k-sx_Ex]-ex[k-sx_Ex-sy_Ex]))
+                               - dt_ov_dx * (  alpha_x * ( ey[k      ]-ey[k-sx_Ey      ])
+                                             + beta_xy * ( ey[k+sy_Ey]-ey[k-sx_Ey+sy_Ey]   + ey[k-sy_Ey]-ey[k-sx_Ey-sy_Ey])
+                                             + beta_xz * ( ey[k+1    ]-ey[k-sx_Ey+1    ]   + ey[k-1    ]-ey[k-sx_Ey-1    ])
+                                             + delta_x * ( ey[k+sx_Ey]-ey[k-2*sx_Ey    ] ) );
+                    }
+                }
             }
         }
     }
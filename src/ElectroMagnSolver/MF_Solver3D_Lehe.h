@@ -12,7 +12,7 @@ class MF_Solver3D_Lehe : public Solver3D
 
 public:
     //! Creator for MF_Solver3D_Lehe
-    MF_Solver3D_Lehe(Params &params);
+    MF_Solver3D_Lehe(Params &params, std::vector<unsigned int> n_space);
     virtual ~MF_Solver3D_Lehe();
 
     //! Overloading of () operator
@@ -4,8 +4,10 @@
 #include "ElectroMagn.h"
 #include "Field3D.h"
 
-MF_Solver3D_Yee::MF_Solver3D_Yee(Params &params)
-: Solver3D(params)
+#include <algorithm>
+
+MF_Solver3D_Yee::MF_Solver3D_Yee(Params &params, std::vector<unsigned int> n_space)
+: Solver3D(params, n_space)
 {
 }
 
@@ -14,6 +16,11 @@ MF_Solver3D_Yee::~MF_Solver3D_Yee()
 }
 
 void MF_Solver3D_Yee::operator() ( ElectroMagn* fields )
+{
+    (*this)( fields, 0, nx_d );
+}
+
+void MF_Solver3D_Yee::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
     // Static-cast of the fields
     Field3D* Ex3D = static_cast<Field3D*>(fields->Ex_);
@@ -22,33 +29,67 @@ void MF_Solver3D_Yee::operator() ( ElectroMagn* fields )
     Field3D* Bx3D = static_cast<Field3D*>(fields->Bx_);
     Field3D* By3D = static_cast<Field3D*>(fields->By_);
     Field3D* Bz3D = static_cast<Field3D*>(fields->Bz_);
+    // Former B (see ElectroMagn3D::saveMagneticFields)
+    Field3D* Bx3D_m = static_cast<Field3D*>(fields->Bx_m);
+    Field3D* By3D_m = static_cast<Field3D*>(fields->By_m);
+    Field3D* Bz3D_m = static_cast<Field3D*>(fields->Bz_m);
     
-    // Magnetic field Bx^(p,d,d)
-    for (unsigned int i=0 ; i<nx_p;  i++) {
-        for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            for (unsigned int k=1 ; k<nz_d-1 ; k++) {
-                (*Bx3D)(i,j,k) += -dt_ov_dy * ( (*Ez3D)(i,j,k) - (*Ez3D)(i,j-1,k) ) + dt_ov_dz * ( (*Ey3D)(i,j,k) - (*Ey3D)(i,j,k-1) );
-            }
-        }
-    }
-        
-    // Magnetic field By^(d,p,d)
-    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            for (unsigned int k=1 ; k<nz_d-1 ; k++) {
-                (*By3D)(i,j,k) += -dt_ov_dz * ( (*Ex3D)(i,j,k) - (*Ex3D)(i,j,k-1) ) + dt_ov_dx * ( (*Ez3D)(i,j,k) - (*Ez3D)(i-1,j,k) );
-            }
-        }
-    }
-        
-    // Magnetic field Bz^(d,d,p)
-    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
-        for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            for (unsigned int k=0 ; k<nz_p ; k++) {
-                (*Bz3D)(i,j,k) += -dt_ov_dx * ( (*Ey3D)(i,j,k) - (*Ey3D)(i-1,j,k) ) + dt_ov_dy * ( (*Ex3D)(i,j,k) - (*Ex3D)(i,j-1,k) );
+    // Blocks of rows along y, the three components being updated row by row,
+    // with contiguous (vectorized) loops along z
+    for (unsigned int j0=0 ; j0<ny_d ; j0+=ny_block) {
+        unsigned int j1 = std::min( j0+ny_block, ny_d );
+        for (unsigned int i=istart ; i<std::min( iend, nx_d-1 ) ; i++) {
+            for (unsigned int j=j0 ; j<j1 ; j++) {
+
+                // Magnetic field Bx^(p,d,d)
+                if ( i<nx_p && j>=1 && j<ny_d-1 ) {
+                    field_t* bx   = &(*Bx3D)  (i,j,0);
+                    field_t* bx_m = &(*Bx3D_m)(i,j,0);
+                    field_t* ez   = &(*Ez3D)  (i,j,0);
+                    field_t* ez0  = &(*Ez3D)  (i,j-1,0);
+                    field_t* ey   = &(*Ey3D)  (i,j,0);
+                    #pragma omp simd
+                    for (unsigned int k=1 ; k<nz_d-1 ; k++) {
+                        bx[k] = bx_m[k] + ( -dt_ov_dy * ( ez[k] - ez0[k] ) + dt_ov_dz * ( ey[k] - ey[k-1] ) );
+                    }
+                }
+
+                if ( i==0 ) continue;
+
+                // Magnetic field By^(d,p,d)
+                if ( j<ny_p ) {
+                    field_t* by   = &(*By3D)  (i,j,0);
+                    field_t* by_m = &(*By3D_m)(i,j,0);
+                    field_t* ex   = &(*Ex3D)  (i,j,0);
+                    field_t* ez   = &(*Ez3D)  (i,j,0);
+                    field_t* ez0  = &(*Ez3D)  (i-1,j,0);
+                    #pragma omp simd
+                    for (unsigned int k=1 ; k<nz_d-1 ; k++) {
+                        by[k] = by_m[k] + ( -dt_ov_dz * ( ex[k] - ex[k-1] ) + dt_ov_dx * ( ez[k] - ez0[k] ) );
+                    }
+                }
+
+                // Magnetic field Bz^(d,d,p)
+                if ( j>=1 && j<ny_d-1 ) {
+                    field_t* bz   = &(*Bz3D)  (i,j,0);
+                    field_t* bz_m = &(*Bz3D_m)(i,j,0);
+                    field_t* ey   = &(*Ey3D)  (i,j,0);
+                    field_t* ey0  = &(*Ey3D)  (i-1,j,0);
+                    field_t* ex   = &(*Ex3D)  (i,j,0);
+                    field_t* ex0  = &(*Ex3D)  (i,j-1,0);
+                    #pragma omp simd
+                    for (unsigned int k=0 ; k<nz_p ; k++) {
+                        bz[k] = bz_m[k] + ( -dt_ov_dx * ( ey[k] - ey0[k] ) + dt_ov_dy * ( ex[k] - ex0[k] ) );
+                    }
+                }
             }
         }
     }
+    
+    // Points not updated by the solver
+    copyDualFaces( Bx3D, Bx3D_m, istart, iend );
+    copyDualFaces( By3D, By3D_m, istart, iend );
+    copyDualFaces( Bz3D, Bz3D_m, istart, iend );
 
 }
 
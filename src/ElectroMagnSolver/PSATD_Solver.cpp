@@ -0,0 +1,240 @@
+#include "PSATD_Solver.h"
+
+#include <cmath>
+#include <complex>
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ElectroMagn.h"
+#include "Field.h"
+#include "Tools.h"
+
+using namespace std;
+
+PSATD_Solver::PSATD_Solver(Params &params)
+: Solver(params),
+  nDim_( params.nDim_field ),
+  dt_( params.timestep ),
+  cell_length_( params.cell_length ),
+  norder_( params.norder ),
+  initialized_( false ),
+  rho_old_available_( false ),
+  nreal_( 0 ),
+  ncomplex_( 0 )
+{
+#ifdef _FFTW
+    buffer_   = NULL;
+    forward_  = NULL;
+    backward_ = NULL;
+#else
+    ERROR( "The spectral solver requires Smilei to be compiled with FFTW=TRUE" );
+#endif
+}
+
+PSATD_Solver::~PSATD_Solver()
+{
+#ifdef _FFTW
+    if ( forward_  ) fftw_destroy_plan( forward_  );
+    if ( backward_ ) fftw_destroy_plan( backward_ );
+    for ( unsigned int i=0 ; i<spectra_.size() ; i++ )
+        fftw_free( spectra_[i] );
+    if ( buffer_ ) fftw_free( buffer_ );
+#endif
+}
+
+void PSATD_Solver::init( ElectroMagn* fields )
+{
+#ifdef _FFTW
+    // The transforms cover the dual size of the local grid
+    unsigned int m[3];
+    nreal_    = 1;
+    ncomplex_ = 1;
+    for ( unsigned int i=0 ; i<3 ; i++ ) {
+        n_[i] = 1;
+        m [i] = 1;
+        if ( i<nDim_ ) {
+            n_[i] = fields->rho_->dims_[i]+1;
+            // real to complex : the last dimension is halved
+            m [i] = ( i==nDim_-1 ) ? n_[i]/2+1 : n_[i];
+        }
+        nreal_    *= n_[i];
+        ncomplex_ *= m [i];
+
+        k_       [i].resize( m[i], 0. );
+        cos_half_[i].resize( m[i], 1. );
+        sin_half_[i].resize( m[i], 0. );
+        for ( unsigned int j=0 ; j<m[i] && i<nDim_ ; j++ ) {
+            int mode = ( (int)j <= n_[i]/2 ) ? j : (int)j-n_[i];
+            double k = 2.*M_PI*mode/( n_[i]*cell_length_[i] );
+            k_       [i][j] = modifiedWaveNumber( k, cell_length_[i], norder_[i] );
+            cos_half_[i][j] = cos( 0.5*k*cell_length_[i] );
+            sin_half_[i][j] = sin( 0.5*k*cell_length_[i] );
+        }
+    }
+
+    buffer_ = fftw_alloc_real( nreal_ );
+    spectra_.resize( 11 );
+    for ( unsigned int i=0 ; i<spectra_.size() ; i++ )
+        spectra_[i] = fftw_alloc_complex( ncomplex_ );
+
+#ifdef _OPENMP
+    static bool fftw_threads_initialized = false;
+    if ( !fftw_threads_initialized ) {
+        fftw_init_threads();
+        fftw_threads_initialized = true;
+    }
+    fftw_plan_with_nthreads( omp_get_max_threads() );
+#endif
+    forward_  = fftw_plan_dft_r2c( nDim_, n_, buffer_, spectra_[0], FFTW_MEASURE );
+    backward_ = fftw_plan_dft_c2r( nDim_, n_, spectra_[0], buffer_, FFTW_MEASURE );
+#endif
+
+    initialized_ = true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Modified wave number of the centered staggered finite difference of order p (even) :
+//     k_eff = 2/dx sum_{l=1}^{p/2} c_l sin( (2l-1) k dx/2 )
+//     c_l   = (-1)^(l+1) 16^(1-p/2) ((p-1)!)^2 / ( (2l-1)^2 (p/2+l-1)! (p/2-l)! ((p/2-1)!)^2 )
+// p = 2 gives the Yee derivative 2/dx sin(k dx/2), k_eff tends to k when p tends to infinity
+// ---------------------------------------------------------------------------------------------------------------------
+double PSATD_Solver::modifiedWaveNumber( double k, double dx, int p )
+{
+    int h = p/2;
+    double k_eff = 0.;
+    for ( int l=1 ; l<=h ; l++ ) {
+        double log_c = ( 1.-h )*log( 16. ) + 2.*lgamma( p ) - 2.*log( 2.*l-1. )
+                     - lgamma( h+l ) - lgamma( h-l+1 ) - 2.*lgamma( h );
+        double c = ( l%2 ? 1. : -1. ) * exp( log_c );
+        k_eff += c * sin( ( 2.*l-1. )*0.5*k*dx );
+    }
+    return 2./dx * k_eff;
+}
+
+#ifdef _FFTW
+void PSATD_Solver::forward( Field* field, fftw_complex* spectrum )
+{
+    unsigned int d[3] = { 1, 1, 1 };
+    for ( unsigned int i=0 ; i<field->dims_.size() ; i++ )
+        d[i] = field->dims_[i];
+
+    memset( buffer_, 0, nreal_*sizeof(double) );
+    for ( unsigned int i=0 ; i<d[0] ; i++ )
+        for ( unsigned int j=0 ; j<d[1] ; j++ )
+            for ( unsigned int k=0 ; k<d[2] ; k++ )
+                buffer_[ ( i*n_[1] + j )*n_[2] + k ] = field->data_[ ( i*d[1] + j )*d[2] + k ];
+
+    fftw_execute_dft_r2c( forward_, buffer_, spectrum );
+}
+
+void PSATD_Solver::backward( fftw_complex* spectrum, Field* field )
+{
+    unsigned int d[3] = { 1, 1, 1 };
+    for ( unsigned int i=0 ; i<field->dims_.size() ; i++ )
+        d[i] = field->dims_[i];
+
+    fftw_execute_dft_c2r( backward_, spectrum, buffer_ );
+
+    double normalization = 1./(double)nreal_;
+    for ( unsigned int i=0 ; i<d[0] ; i++ )
+        for ( unsigned int j=0 ; j<d[1] ; j++ )
+            for ( unsigned int k=0 ; k<d[2] ; k++ )
+                field->data_[ ( i*d[1] + j )*d[2] + k ] = normalization * buffer_[ ( i*n_[1] + j )*n_[2] + k ];
+}
+#endif
+
+void PSATD_Solver::operator() ( ElectroMagn* fields )
+{
+#ifdef _FFTW
+    if ( !initialized_ )
+        init( fields );
+
+    Field* f[11] = { fields->Ex_, fields->Ey_, fields->Ez_,
+                     fields->Bx_, fields->By_, fields->Bz_,
+                     fields->Jx_, fields->Jy_, fields->Jz_,
+                     fields->rho_, fields->rhoold_ };
+    unsigned int nfields = rho_old_available_ ? 11 : 10;
+
+    for ( unsigned int ifield=0 ; ifield<nfields ; ifield++ )
+        forward( f[ifield], spectra_[ifield] );
+
+    // Dual dimensions of each field
+    bool dual[11][3];
+    for ( unsigned int ifield=0 ; ifield<nfields ; ifield++ )
+        for ( unsigned int i=0 ; i<3 ; i++ )
+            dual[ifield][i] = ( i<nDim_ ) && f[ifield]->isDual( i );
+
+    typedef complex<double> cplx;
+    const cplx I( 0., 1. );
+    unsigned int m1 = k_[1].size(), m2 = k_[2].size();
+
+    for ( unsigned int i=0 ; i<k_[0].size() ; i++ ) {
+        for ( unsigned int j=0 ; j<m1 ; j++ ) {
+            for ( unsigned int l=0 ; l<m2 ; l++ ) {
+                unsigned int idx = ( i*m1 + j )*m2 + l;
+                unsigned int id[3] = { i, j, l };
+
+                // Spectra at the nodes of the grid : f(x-dx/2) -> f(x) along dual dimensions
+                cplx phase[11], F[11];
+                for ( unsigned int ifield=0 ; ifield<nfields ; ifield++ ) {
+                    phase[ifield] = 1.;
+                    for ( unsigned int d=0 ; d<nDim_ ; d++ )
+                        if ( dual[ifield][d] )
+                            phase[ifield] *= cplx( cos_half_[d][id[d]], sin_half_[d][id[d]] );
+                    F[ifield] = reinterpret_cast<cplx*>( spectra_[ifield] )[idx] * phase[ifield];
+                }
+
+                double kx = k_[0][i], ky = k_[1][j], kz = k_[2][l];
+                double k2 = kx*kx + ky*ky + kz*kz;
+                cplx* E = &F[0];
+                cplx* B = &F[3];
+                cplx* J = &F[6];
+                cplx Enew[3], Bnew[3];
+
+                if ( k2 == 0. ) {
+                    for ( unsigned int c=0 ; c<3 ; c++ ) {
+                        Enew[c] = E[c] - dt_*J[c];
+                        Bnew[c] = B[c];
+                    }
+                } else {
+                    double k = sqrt( k2 );
+                    double C = cos( k*dt_ );
+                    double S = sin( k*dt_ );
+                    double S_ov_kdt = S/( k*dt_ );
+
+                    // rho at n from Gauss' law before rhoold_ is available
+                    cplx rho0 = rho_old_available_ ? F[10] : I*( kx*E[0] + ky*E[1] + kz*E[2] );
+                    cplx rho1 = F[9];
+                    cplx coef_rho = I*( ( S_ov_kdt - 1. )*rho1 + ( C - S_ov_kdt )*rho0 )/k2;
+
+                    cplx ikxE[3] = { I*( ky*E[2] - kz*E[1] ), I*( kz*E[0] - kx*E[2] ), I*( kx*E[1] - ky*E[0] ) };
+                    cplx ikxB[3] = { I*( ky*B[2] - kz*B[1] ), I*( kz*B[0] - kx*B[2] ), I*( kx*B[1] - ky*B[0] ) };
+                    cplx ikxJ[3] = { I*( ky*J[2] - kz*J[1] ), I*( kz*J[0] - kx*J[2] ), I*( kx*J[1] - ky*J[0] ) };
+                    double kvec[3] = { kx, ky, kz };
+
+                    for ( unsigned int c=0 ; c<3 ; c++ ) {
+                        Enew[c] = C*E[c] + S/k*( ikxB[c] - J[c] ) + kvec[c]*coef_rho;
+                        Bnew[c] = C*B[c] - S/k*ikxE[c] + ( 1.-C )/k2*ikxJ[c];
+                    }
+                }
+
+                // Back to the staggered positions
+                for ( unsigned int c=0 ; c<3 ; c++ ) {
+                    reinterpret_cast<cplx*>( spectra_[c  ] )[idx] = Enew[c] * conj( phase[c  ] );
+                    reinterpret_cast<cplx*>( spectra_[c+3] )[idx] = Bnew[c] * conj( phase[c+3] );
+                }
+            }
+        }
+    }
+
+    for ( unsigned int ifield=0 ; ifield<6 ; ifield++ )
+        backward( spectra_[ifield], f[ifield] );
+
+    // rhoold_ is set to rho after each solve (see VectorPatch::save_old_rho)
+    rho_old_available_ = true;
+#endif
+}
+
@@ -0,0 +1,74 @@
+#ifndef PSATD_SOLVER_H
+#define PSATD_SOLVER_H
+
+#include <vector>
+
+#include "Solver.h"
+
+#ifdef _FFTW
+#include <fftw3.h>
+#endif
+
+class ElectroMagn;
+class Field;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PSATD_Solver
+//! Pseudo-spectral analytical time domain solver (2D & 3D cartesian), in place of the Maxwell-Ampere solver
+//! (the Maxwell-Faraday solver is a NullSolver). Applied to the field of the Domain owned by an MPI process: the FFTs
+//! cover the whole local grid, ghost cells included, which are then refreshed by the usual exchanges.
+//! The staggering of the Yee grid is accounted for by phase shifts in the spectral space, E and B are advanced from
+//! n to n+1 with J at n+1/2, the longitudinal part of E being corrected with rho at n and n+1.
+//! The derivatives are those of the staggered finite differences of order norder (modified wave numbers), whose
+//! stencil (norder/2 cells) fits in the ghost cells : the periodicity of the FFTs over the block only pollutes the
+//! ghost cells, which are then overwritten by the exchanges.
+//  --------------------------------------------------------------------------------------------------------------------
+class PSATD_Solver : public Solver
+{
+
+public:
+    PSATD_Solver(Params &params);
+    virtual ~PSATD_Solver();
+
+    //! Overloading of () operator
+    virtual void operator()( ElectroMagn* fields);
+
+protected:
+    //! Plans and spectral arrays are allocated at the first call (only the solver of the Domain is used)
+    void init( ElectroMagn* fields );
+
+    //! Modified wave number of k for the staggered finite differences of order p along a dimension of cell length dx
+    static double modifiedWaveNumber( double k, double dx, int p );
+
+    unsigned int nDim_;
+    double dt_;
+    std::vector<double> cell_length_;
+    //! Order of the finite differences per dimension (Main.norder)
+    std::vector<int> norder_;
+
+    bool initialized_;
+    //! rhoold_ holds rho at time n (set after the first solve)
+    bool rho_old_available_;
+
+    //! Size of the transforms (dual size of the fields, 1 for unused dimensions)
+    int n_[3];
+    unsigned int nreal_, ncomplex_;
+    //! Modified wave numbers, and phase shift exp(i k dx/2) of the dual positions, per dimension
+    std::vector<double> k_[3];
+    std::vector<double> cos_half_[3], sin_half_[3];
+
+#ifdef _FFTW
+    double* buffer_;
+    //! Spectra of Ex, Ey, Ez, Bx, By, Bz, Jx, Jy, Jz, rho, rhoold
+    std::vector<fftw_complex*> spectra_;
+    fftw_plan forward_;
+    fftw_plan backward_;
+
+    void forward( Field* field, fftw_complex* spectrum );
+    void backward( fftw_complex* spectrum, Field* field );
+#endif
+
+};//END class
+
+#endif
+
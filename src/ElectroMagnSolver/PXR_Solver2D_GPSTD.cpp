@@ -5,8 +5,8 @@
 #include "Field2D.h"
 #include "interface.h"
 
-PXR_Solver2D_GPSTD::PXR_Solver2D_GPSTD(Params &params)
-: Solver2D(params)
+PXR_Solver2D_GPSTD::PXR_Solver2D_GPSTD(Params &params, std::vector<unsigned int> n_space)
+: Solver2D(params, n_space)
 {
 }
 
@@ -22,8 +22,8 @@ void PXR_Solver2D_GPSTD::coupling( Params &params, ElectroMagn* EMfields )
     int ov0,ov1,ov2;
     // unable to convert unsigned int to an iso_c_binding supported type 
 
-    n0=(int) (1 +  params.n_space[0]*params.global_factor[0]);
-    n1=(int) (1 +  params.n_space[1]*params.global_factor[1]);
+    n0=(int) (1 +  n_space[0]);
+    n1=(int) (1 +  n_space[1]);
     n2=0;
     ov0=(int) params.oversize[0];
     ov1=(int) params.oversize[1];
@@ -11,7 +11,7 @@ class PXR_Solver2D_GPSTD : public Solver2D
 {
 
 public:
-    PXR_Solver2D_GPSTD(Params &params);
+    PXR_Solver2D_GPSTD(Params &params, std::vector<unsigned int> n_space);
     virtual ~PXR_Solver2D_GPSTD();
 
     void coupling( Params &params, ElectroMagn* EMfields ) override;
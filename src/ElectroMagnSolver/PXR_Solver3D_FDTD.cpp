@@ -5,8 +5,8 @@
 #include "Field3D.h"
 #include "interface.h"
 
-PXR_Solver3D_FDTD::PXR_Solver3D_FDTD(Params &params)
-: Solver3D(params)
+PXR_Solver3D_FDTD::PXR_Solver3D_FDTD(Params &params, std::vector<unsigned int> n_space)
+: Solver3D(params, n_space)
 {
 }
 
@@ -22,9 +22,9 @@ void PXR_Solver3D_FDTD::coupling( Params &params, ElectroMagn* EMfields )
     int ov0,ov1,ov2;
     // unable to convert unsigned int to an iso_c_binding supported type 
 
-    n0=(int) (1 +  params.n_space[0]*params.global_factor[0]);
-    n1=(int) (1 +  params.n_space[1]*params.global_factor[1]);
-    n2=(int) (1 +  params.n_space[2]*params.global_factor[2]);
+    n0=(int) (1 +  n_space[0]);
+    n1=(int) (1 +  n_space[1]);
+    n2=(int) (1 +  n_space[2]);
 
     ov0=(int) params.oversize[0];
     ov1=(int) params.oversize[1];
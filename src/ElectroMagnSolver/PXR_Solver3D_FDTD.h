@@ -12,7 +12,7 @@ class PXR_Solver3D_FDTD : public Solver3D
 {
 
 public:
-    PXR_Solver3D_FDTD(Params &params);
+    PXR_Solver3D_FDTD(Params &params, std::vector<unsigned int> n_space);
     virtual ~PXR_Solver3D_FDTD();
 
     void coupling( Params &params, ElectroMagn* EMfields ) override;
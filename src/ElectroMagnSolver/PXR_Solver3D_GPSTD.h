@@ -11,7 +11,7 @@ class PXR_Solver3D_GPSTD : public Solver3D
 {
 
 public:
-    PXR_Solver3D_GPSTD(Params &params);
+    PXR_Solver3D_GPSTD(Params &params, std::vector<unsigned int> n_space);
     virtual ~PXR_Solver3D_GPSTD();
 
     void coupling( Params &params, ElectroMagn* EMfields ) override;
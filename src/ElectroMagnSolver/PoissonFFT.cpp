@@ -0,0 +1,300 @@
+#include "PoissonFFT.h"
+
+#include <cmath>
+
+#include "Params.h"
+#include "SmileiMPI.h"
+#include "Patch.h"
+#include "Field.h"
+#include "Tools.h"
+
+using namespace std;
+
+PoissonFFT::PoissonFFT( Params& params, SmileiMPI* smpi, Patch* domain_patch )
+: nDim_( params.nDim_field ), nprocs_( smpi->getSize() ), rank_( smpi->getRank() ), comm_( smpi->getGlobalComm() ),
+  normalization_( 1. ), transposed_( false ), local_n1_( 0 ), local_1_start_( 0 ), data_( NULL )
+{
+#ifdef _FFTW
+    // Transform grid, and local block of the Domain
+    int own_min[3], own_max[3], ext_min[3];
+    for ( unsigned int i=0 ; i<3 ; i++ ) {
+        n_[i] = 1;
+        periodic_[i] = true;
+        shift_[i] = 0;
+        dim_[i] = 1;
+        own_min[i] = 0;
+        own_max[i] = 1;
+        ext_min[i] = 0;
+        if ( i>=nDim_ ) continue;
+
+        periodic_[i] = ( params.EM_BCs[i][0] == "periodic" );
+        int n_local  = domain_patch->n_space[i];
+        int nblocks  = params.n_space_global[i]/n_local;
+        int oversize = params.oversize[i];
+        int cell_start = domain_patch->Pcoordinates[i]*n_local;
+        dim_[i] = n_local+1+2*oversize;
+        if ( periodic_[i] ) {
+            n_[i]      = params.n_space_global[i];
+            own_min[i] = cell_start;
+            own_max[i] = cell_start+n_local;
+        } else {
+            // The unknowns of the CG solver include the ghost cells beyond the boundaries
+            n_[i]      = params.n_space_global[i]+1+2*oversize;
+            shift_[i]  = oversize;
+            own_min[i] = ( domain_patch->Pcoordinates[i]==0         ) ? 0     : cell_start+oversize;
+            own_max[i] = ( (int)domain_patch->Pcoordinates[i]==nblocks-1 ) ? n_[i] : cell_start+n_local+oversize;
+        }
+        ext_min[i] = cell_start-oversize+shift_[i];
+    }
+
+    own_min_.resize( 3*nprocs_ );
+    own_max_.resize( 3*nprocs_ );
+    ext_min_.resize( 3*nprocs_ );
+    MPI_Allgather( own_min, 3, MPI_INT, &own_min_[0], 3, MPI_INT, comm_ );
+    MPI_Allgather( own_max, 3, MPI_INT, &own_max_[0], 3, MPI_INT, comm_ );
+    MPI_Allgather( ext_min, 3, MPI_INT, &ext_min_[0], 3, MPI_INT, comm_ );
+
+    // Eigenvalues of the discrete laplacian in the basis of the transforms
+    for ( unsigned int i=0 ; i<3 ; i++ ) {
+        eigen_[i].resize( n_[i], 0. );
+        if ( i>=nDim_ ) continue;
+        double one_ov_dx_sq = 1./( params.cell_length[i]*params.cell_length[i] );
+        for ( int k=0 ; k<n_[i] ; k++ ) {
+            double s;
+            if ( periodic_[i] ) {
+                // halfcomplex : index k and N-k hold the real and imaginary parts of the same frequency
+                int m = min( k, n_[i]-k );
+                s = sin( M_PI*m/n_[i] );
+            } else {
+                s = sin( M_PI*(k+1)/(2.*(n_[i]+1)) );
+            }
+            eigen_[i][k] = -4.*one_ov_dx_sq*s*s;
+        }
+        normalization_ *= periodic_[i] ? (double)n_[i] : 2.*(n_[i]+1);
+    }
+
+    // Parallel transforms : slabs along the first dimension
+    // (FFTW does not provide 1D parallel real-to-real transforms, the 1D problem is solved by the process 0)
+    fftw_r2r_kind forward_kind[3], backward_kind[3];
+    for ( unsigned int i=0 ; i<nDim_ ; i++ ) {
+        forward_kind [i] = periodic_[i] ? FFTW_R2HC : FFTW_RODFT00;
+        backward_kind[i] = periodic_[i] ? FFTW_HC2R : FFTW_RODFT00;
+    }
+    int local_slab[2] = { 0, 0 };
+    forward_  = NULL;
+    backward_ = NULL;
+    if ( nDim_==1 ) {
+        if ( rank_==0 ) {
+            local_slab[1] = n_[0];
+            data_ = fftw_alloc_real( n_[0] );
+            forward_  = fftw_plan_r2r_1d( n_[0], data_, data_, forward_kind [0], FFTW_ESTIMATE );
+            backward_ = fftw_plan_r2r_1d( n_[0], data_, data_, backward_kind[0], FFTW_ESTIMATE );
+        }
+    } else {
+        static bool fftw_mpi_initialized = false;
+        if ( !fftw_mpi_initialized ) {
+            fftw_mpi_init();
+            fftw_mpi_initialized = true;
+        }
+        ptrdiff_t n[3] = { n_[0], n_[1], n_[2] };
+        ptrdiff_t local_n0, local_0_start;
+        ptrdiff_t alloc_local = fftw_mpi_local_size_transposed( nDim_, n, comm_,
+                                                                &local_n0, &local_0_start, &local_n1_, &local_1_start_ );
+        local_slab[0] = local_0_start;
+        local_slab[1] = local_n0;
+        transposed_ = true;
+        data_ = fftw_alloc_real( max( alloc_local, (ptrdiff_t)1 ) );
+        // The transposed output avoids the global transposition back, the inverse transform takes it as input
+        forward_  = fftw_mpi_plan_r2r( nDim_, n, data_, data_, comm_, forward_kind,
+                                       FFTW_ESTIMATE | FFTW_MPI_TRANSPOSED_OUT );
+        backward_ = fftw_mpi_plan_r2r( nDim_, n, data_, data_, comm_, backward_kind,
+                                       FFTW_ESTIMATE | FFTW_MPI_TRANSPOSED_IN );
+    }
+
+    vector<int> slabs( 2*nprocs_ );
+    MPI_Allgather( local_slab, 2, MPI_INT, &slabs[0], 2, MPI_INT, comm_ );
+    slab_min_ .resize( nprocs_ );
+    slab_size_.resize( nprocs_ );
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ ) {
+        slab_min_ [iproc] = slabs[2*iproc  ];
+        slab_size_[iproc] = slabs[2*iproc+1];
+    }
+#else
+    ERROR( "The FFT Poisson solver requires Smilei to be compiled with FFTW=TRUE" );
+#endif
+}
+
+PoissonFFT::~PoissonFFT()
+{
+#ifdef _FFTW
+    if ( forward_  ) fftw_destroy_plan( forward_  );
+    if ( backward_ ) fftw_destroy_plan( backward_ );
+    if ( data_ ) fftw_free( data_ );
+#endif
+}
+
+int PoissonFFT::toTransformIndex( int iproc, unsigned int idim, int l )
+{
+    int g = ext_min_[3*iproc+idim] + l;
+    if ( periodic_[idim] )
+        return ( g%n_[idim] + n_[idim] )%n_[idim];
+    else if ( g<0 || g>=n_[idim] )
+        return -1;
+    return g;
+}
+
+int PoissonFFT::slabOwner( int i0 )
+{
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ )
+        if ( i0>=slab_min_[iproc] && i0<slab_min_[iproc]+slab_size_[iproc] )
+            return iproc;
+    return -1;
+}
+
+void PoissonFFT::solve( Field* rho, Field* phi )
+{
+#ifdef _FFTW
+    vector<int> send_count( nprocs_, 0 ), recv_count( nprocs_, 0 );
+    vector<int> send_displ( nprocs_, 0 ), recv_displ( nprocs_, 0 );
+    vector<double> send_buffer, recv_buffer;
+    int *omin = &own_min_[3*rank_], *omax = &own_max_[3*rank_], *emin = &ext_min_[3*rank_];
+
+    // ----------------------------------------------
+    // rho : owned nodes of the Domain -> FFTW slabs
+    // ----------------------------------------------
+    int plane = ( omax[1]-omin[1] )*( omax[2]-omin[2] );
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ ) {
+        int imin = max( omin[0], slab_min_[iproc] );
+        int imax = min( omax[0], slab_min_[iproc]+slab_size_[iproc] );
+        send_count[iproc] = max( imax-imin, 0 )*plane;
+
+        int *rmin = &own_min_[3*iproc], *rmax = &own_max_[3*iproc];
+        imin = max( rmin[0], slab_min_[rank_] );
+        imax = min( rmax[0], slab_min_[rank_]+slab_size_[rank_] );
+        recv_count[iproc] = max( imax-imin, 0 )*( rmax[1]-rmin[1] )*( rmax[2]-rmin[2] );
+    }
+    for ( int iproc=1 ; iproc<nprocs_ ; iproc++ ) {
+        send_displ[iproc] = send_displ[iproc-1]+send_count[iproc-1];
+        recv_displ[iproc] = recv_displ[iproc-1]+recv_count[iproc-1];
+    }
+    send_buffer.resize( send_displ[nprocs_-1]+send_count[nprocs_-1] );
+    recv_buffer.resize( recv_displ[nprocs_-1]+recv_count[nprocs_-1] );
+
+    unsigned int ibuf = 0;
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ ) {
+        int imin = max( omin[0], slab_min_[iproc] );
+        int imax = min( omax[0], slab_min_[iproc]+slab_size_[iproc] );
+        for ( int i=imin ; i<imax ; i++ )
+            for ( int j=omin[1] ; j<omax[1] ; j++ )
+                for ( int k=omin[2] ; k<omax[2] ; k++ )
+                    send_buffer[ibuf++] = (*rho)( ( (i-emin[0])*dim_[1] + j-emin[1] )*dim_[2] + k-emin[2] );
+    }
+
+    MPI_Alltoallv( &send_buffer[0], &send_count[0], &send_displ[0], MPI_DOUBLE,
+                   &recv_buffer[0], &recv_count[0], &recv_displ[0], MPI_DOUBLE, comm_ );
+
+    ibuf = 0;
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ ) {
+        int *rmin = &own_min_[3*iproc], *rmax = &own_max_[3*iproc];
+        int imin = max( rmin[0], slab_min_[rank_] );
+        int imax = min( rmax[0], slab_min_[rank_]+slab_size_[rank_] );
+        for ( int i=imin ; i<imax ; i++ )
+            for ( int j=rmin[1] ; j<rmax[1] ; j++ )
+                for ( int k=rmin[2] ; k<rmax[2] ; k++ )
+                    data_[ ( (i-slab_min_[rank_])*n_[1] + j )*n_[2] + k ] = recv_buffer[ibuf++];
+    }
+
+    // ----------------------------------------------
+    // Solve in the spectral space : phi = -rho / k^2
+    // ----------------------------------------------
+    if ( forward_ ) fftw_execute( forward_ );
+
+    if ( transposed_ ) {
+        // slab along the second dimension, the two first dimensions are swapped
+        for ( int j=0 ; j<local_n1_ ; j++ )
+            for ( int i=0 ; i<n_[0] ; i++ )
+                for ( int k=0 ; k<n_[2] ; k++ ) {
+                    double lambda = eigen_[0][i] + eigen_[1][local_1_start_+j] + eigen_[2][k];
+                    unsigned int idx = ( j*n_[0] + i )*n_[2] + k;
+                    data_[idx] = ( lambda!=0. ) ? -data_[idx]/lambda/normalization_ : 0.;
+                }
+    } else {
+        for ( int i=0 ; i<slab_size_[rank_] ; i++ ) {
+            double lambda = eigen_[0][slab_min_[rank_]+i];
+            data_[i] = ( lambda!=0. ) ? -data_[i]/lambda/normalization_ : 0.;
+        }
+    }
+
+    if ( backward_ ) fftw_execute( backward_ );
+
+    // -----------------------------------------------------------------
+    // phi : FFTW slabs -> all nodes of the Domain (ghost cells included)
+    // -----------------------------------------------------------------
+    vector<int> g[3];
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ ) {
+        send_count[iproc] = 0;
+        for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+            g[idim].resize( dim_[idim] );
+            for ( int l=0 ; l<dim_[idim] ; l++ )
+                g[idim][l] = toTransformIndex( iproc, idim, l );
+        }
+        for ( int l0=0 ; l0<dim_[0] ; l0++ ) {
+            if ( g[0][l0]<0 || slabOwner( g[0][l0] )!=rank_ ) continue;
+            for ( int l1=0 ; l1<dim_[1] ; l1++ )
+                for ( int l2=0 ; l2<dim_[2] ; l2++ )
+                    if ( g[1][l1]>=0 && g[2][l2]>=0 ) send_count[iproc]++;
+        }
+    }
+    for ( unsigned int idim=0 ; idim<3 ; idim++ )
+        for ( int l=0 ; l<dim_[idim] ; l++ )
+            g[idim][l] = toTransformIndex( rank_, idim, l );
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ )
+        recv_count[iproc] = 0;
+    for ( int l0=0 ; l0<dim_[0] ; l0++ ) {
+        if ( g[0][l0]<0 ) continue;
+        int iproc = slabOwner( g[0][l0] );
+        for ( int l1=0 ; l1<dim_[1] ; l1++ )
+            for ( int l2=0 ; l2<dim_[2] ; l2++ )
+                if ( g[1][l1]>=0 && g[2][l2]>=0 ) recv_count[iproc]++;
+    }
+    for ( int iproc=1 ; iproc<nprocs_ ; iproc++ ) {
+        send_displ[iproc] = send_displ[iproc-1]+send_count[iproc-1];
+        recv_displ[iproc] = recv_displ[iproc-1]+recv_count[iproc-1];
+    }
+    send_buffer.resize( send_displ[nprocs_-1]+send_count[nprocs_-1] );
+    recv_buffer.resize( recv_displ[nprocs_-1]+recv_count[nprocs_-1] );
+
+    ibuf = 0;
+    for ( int iproc=0 ; iproc<nprocs_ ; iproc++ ) {
+        for ( unsigned int idim=0 ; idim<3 ; idim++ )
+            for ( int l=0 ; l<dim_[idim] ; l++ )
+                g[idim][l] = toTransformIndex( iproc, idim, l );
+        for ( int l0=0 ; l0<dim_[0] ; l0++ ) {
+            if ( g[0][l0]<0 || slabOwner( g[0][l0] )!=rank_ ) continue;
+            for ( int l1=0 ; l1<dim_[1] ; l1++ )
+                for ( int l2=0 ; l2<dim_[2] ; l2++ )
+                    if ( g[1][l1]>=0 && g[2][l2]>=0 )
+                        send_buffer[ibuf++] = data_[ ( (g[0][l0]-slab_min_[rank_])*n_[1] + g[1][l1] )*n_[2] + g[2][l2] ];
+        }
+    }
+
+    MPI_Alltoallv( &send_buffer[0], &send_count[0], &send_displ[0], MPI_DOUBLE,
+                   &recv_buffer[0], &recv_count[0], &recv_displ[0], MPI_DOUBLE, comm_ );
+
+    for ( unsigned int idim=0 ; idim<3 ; idim++ )
+        for ( int l=0 ; l<dim_[idim] ; l++ )
+            g[idim][l] = toTransformIndex( rank_, idim, l );
+    vector<int> cursor( recv_displ );
+    for ( int l0=0 ; l0<dim_[0] ; l0++ ) {
+        int iproc = ( g[0][l0]>=0 ) ? slabOwner( g[0][l0] ) : -1;
+        for ( int l1=0 ; l1<dim_[1] ; l1++ )
+            for ( int l2=0 ; l2<dim_[2] ; l2++ ) {
+                unsigned int idx = ( l0*dim_[1] + l1 )*dim_[2] + l2;
+                if ( iproc>=0 && g[1][l1]>=0 && g[2][l2]>=0 )
+                    (*phi)( idx ) = recv_buffer[ cursor[iproc]++ ];
+                else
+                    (*phi)( idx ) = 0.;
+            }
+    }
+#endif
+}
@@ -0,0 +1,81 @@
+#ifndef POISSONFFT_H
+#define POISSONFFT_H
+
+#include <vector>
+#include <cstddef>
+#include <mpi.h>
+
+#ifdef _FFTW
+#include <fftw3-mpi.h>
+#endif
+
+class Params;
+class SmileiMPI;
+class Patch;
+class Field;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PoissonFFT
+//! Direct solver of the discrete Poisson equation  Lap(phi) = -rho  on the whole simulation box, with periodic or
+//! homogeneous Dirichlet conditions (applied beyond the ghost cells, as in the conjugate gradient solver).
+//! rho and phi are fields of the Domain (one block of patches per MPI process). They are redistributed in the slabs
+//! of the parallel real-to-real FFTW transforms : DFT (halfcomplex) along periodic dimensions, DST-I along the
+//! others, in which the 5/7-point laplacian is diagonal.
+//  --------------------------------------------------------------------------------------------------------------------
+class PoissonFFT
+{
+
+public:
+    //! Creator for PoissonFFT, domain_patch is the patch of the Domain owned by this process
+    PoissonFFT( Params& params, SmileiMPI* smpi, Patch* domain_patch );
+    ~PoissonFFT();
+
+    //! Solve the Poisson equation, rho and phi may be the same field (phi overwrites rho, ghost cells included)
+    void solve( Field* rho, Field* phi );
+
+private:
+    unsigned int nDim_;
+    int nprocs_;
+    int rank_;
+    MPI_Comm comm_;
+
+    //! Number of nodes of the transform along each dimension (1 for unused dimensions)
+    int n_[3];
+    //! Periodic (DFT) or Dirichlet (DST) along each dimension
+    bool periodic_[3];
+    //! Global index of the node 0 of the transform (Dirichlet: the outermost ghost cell)
+    int shift_[3];
+    //! Dimension of the Domain fields (primal, ghost cells included)
+    int dim_[3];
+
+    //! Nodes of the transform owned by each process : [own_min_, own_max_[ per dimension
+    std::vector<int> own_min_, own_max_;
+    //! Transform index of the first node (ghost cell) of the Domain field of each process (before periodic wrapping)
+    std::vector<int> ext_min_;
+    //! Slab (along the first dimension) of the transform input held by each process
+    std::vector<int> slab_min_, slab_size_;
+
+    //! Eigenvalues of the 1D discrete laplacian along each dimension
+    std::vector<double> eigen_[3];
+    //! Normalization of the forward+backward transforms
+    double normalization_;
+
+    //! Output of the forward transform is transposed (slab along the second dimension)
+    bool transposed_;
+    std::ptrdiff_t local_n1_, local_1_start_;
+
+    //! Slab of the transform (in place)
+    double* data_;
+#ifdef _FFTW
+    fftw_plan forward_;
+    fftw_plan backward_;
+#endif
+
+    //! Transform index of the local node l of the Domain field of process iproc along idim (-1 if out of the box)
+    int toTransformIndex( int iproc, unsigned int idim, int l );
+    //! Process whose slab contains the transform index i0 along the first dimension
+    int slabOwner( int i0 );
+};
+
+#endif
+
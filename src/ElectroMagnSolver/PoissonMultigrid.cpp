@@ -0,0 +1,315 @@
+#include "PoissonMultigrid.h"
+
+#include <algorithm>
+
+using namespace std;
+
+PoissonMultigrid::PoissonMultigrid( vector<unsigned int> n, vector<double> coef, vector<int> bc, unsigned int smoothing )
+: smoothing_steps(smoothing), coarsest_steps(20), omega(0.8)
+{
+    Level lev;
+    for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+        lev.n   [idim] = ( idim<n.size()    ) ? max( n[idim], 1u ) : 1;
+        lev.coef[idim] = ( idim<coef.size() ) ? coef[idim]         : 0.;
+        lev.bc  [idim] = ( idim<bc.size()   ) ? bc[idim]           : MG_DIRICHLET;
+        lev.bfac[idim][0] = 1.;
+        lev.bfac[idim][1] = 1.;
+    }
+
+    // Build the hierarchy : a dimension is coarsened only if it is strongly coupled (semi-coarsening for anisotropic
+    // operators, as in the relativistic Poisson problem) and if its size allows it
+    while ( true ) {
+        initLevel( lev );
+        levels.push_back( lev );
+
+        double coef_max = 0.;
+        for ( unsigned int idim=0 ; idim<3 ; idim++ )
+            if ( lev.n[idim]>1 ) coef_max = max( coef_max, lev.coef[idim] );
+
+        Level coarse = lev;
+        bool is_coarsened = false;
+        for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+            levels.back().coarsened[idim] = false;
+            if ( lev.n[idim]<2 || lev.coef[idim] < 0.5*coef_max ) continue;
+            if ( lev.bc[idim]==MG_PERIODIC && lev.n[idim]%2!=0 ) continue;
+            levels.back().coarsened[idim] = true;
+            coarse.n   [idim] = lev.n[idim]/2;
+            coarse.coef[idim] = lev.coef[idim]*0.25;
+            // Dirichlet boundaries : the coarse boundary is not a fine node in general, the coupling with the
+            // boundary is chosen so that the coarse diagonal matches the Galerkin operator R A P
+            coarse.bfac[idim][0] = 0.5*( 1.+lev.bfac[idim][0] );
+            if ( lev.n[idim]%2==1 )
+                coarse.bfac[idim][1] = 0.5*( 1.+lev.bfac[idim][1] );
+            else
+                coarse.bfac[idim][1] = 2.*lev.bfac[idim][1];
+            is_coarsened = true;
+        }
+        if ( !is_coarsened || levels.size()>=20 ) break;
+        lev = coarse;
+    }
+
+    // Tabulate the prolongation weights along each dimension
+    for ( unsigned int ilevel=0 ; ilevel<levels.size() ; ilevel++ ) {
+        Level& fine = levels[ilevel];
+        for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+            for ( unsigned int a=0 ; a<2 ; a++ ) {
+                fine.pc[idim][a].resize( fine.n[idim] );
+                fine.pw[idim][a].resize( fine.n[idim] );
+            }
+            for ( unsigned int i=0 ; i<fine.n[idim] ; i++ ) {
+                int c[2];
+                double w[2];
+                prolongationWeights( fine, idim, i, c, w );
+                for ( unsigned int a=0 ; a<2 ; a++ ) {
+                    fine.pc[idim][a][i] = c[a];
+                    fine.pw[idim][a][i] = w[a];
+                }
+            }
+        }
+    }
+
+}
+
+void PoissonMultigrid::initLevel( Level& lev )
+{
+    unsigned int size = lev.n[0]*lev.n[1]*lev.n[2];
+    lev.u.resize( size, 0. );
+    lev.f.resize( size, 0. );
+    lev.r.resize( size, 0. );
+
+    for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+        int ni = lev.n[idim];
+        lev.im[idim].resize( ni );
+        lev.ip[idim].resize( ni );
+        for ( int i=0 ; i<ni ; i++ ) {
+            lev.im[idim][i] = i-1;
+            lev.ip[idim][i] = i+1;
+        }
+        if ( lev.bc[idim]==MG_PERIODIC ) {
+            lev.im[idim][0]    = ni-1;
+            lev.ip[idim][ni-1] = 0;
+        } else if ( lev.bc[idim]==MG_NEUMANN ) {
+            lev.im[idim][0]    = 0;
+            lev.ip[idim][ni-1] = ni-1;
+        } else {
+            lev.ip[idim][ni-1] = -1;
+        }
+    }
+
+    // Diagonal of the operator, reduced on Neumann boundaries where the ghost node mirrors the node itself,
+    // and modified on Dirichlet boundaries of the coarse levels (bfac)
+    for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+        lev.bdiag[idim].assign( lev.n[idim], -2.*lev.coef[idim] );
+        int ni = lev.n[idim];
+        for ( int i=0 ; i<ni ; i++ ) {
+            if ( lev.im[idim][i]==i ) lev.bdiag[idim][i] += lev.coef[idim];
+            if ( lev.ip[idim][i]==i ) lev.bdiag[idim][i] += lev.coef[idim];
+            if ( lev.im[idim][i]<0  ) lev.bdiag[idim][i] -= ( lev.bfac[idim][0]-1. )*lev.coef[idim];
+            if ( lev.ip[idim][i]<0  ) lev.bdiag[idim][i] -= ( lev.bfac[idim][1]-1. )*lev.coef[idim];
+        }
+    }
+    lev.diag.resize( size );
+    for ( unsigned int i=0 ; i<lev.n[0] ; i++ )
+        for ( unsigned int j=0 ; j<lev.n[1] ; j++ )
+            for ( unsigned int k=0 ; k<lev.n[2] ; k++ )
+                lev.diag[(i*lev.n[1]+j)*lev.n[2]+k] = lev.bdiag[0][i] + lev.bdiag[1][j] + lev.bdiag[2][k];
+}
+
+// r = f - A u
+void PoissonMultigrid::residual( Level& lev )
+{
+    unsigned int nx = lev.n[0], ny = lev.n[1], nz = lev.n[2];
+    double *u = &lev.u[0];
+    for ( unsigned int i=0 ; i<nx ; i++ ) {
+        int im = lev.im[0][i], ip = lev.ip[0][i];
+        for ( unsigned int j=0 ; j<ny ; j++ ) {
+            int jm = lev.im[1][j], jp = lev.ip[1][j];
+            for ( unsigned int k=0 ; k<nz ; k++ ) {
+                int km = lev.im[2][k], kp = lev.ip[2][k];
+                unsigned int idx = (i*ny+j)*nz+k;
+                double Au = lev.diag[idx]*u[idx];
+                if ( im>=0 && im!=(int)i ) Au += lev.coef[0]*u[(im*ny+j)*nz+k];
+                if ( ip>=0 && ip!=(int)i ) Au += lev.coef[0]*u[(ip*ny+j)*nz+k];
+                if ( jm>=0 && jm!=(int)j ) Au += lev.coef[1]*u[(i*ny+jm)*nz+k];
+                if ( jp>=0 && jp!=(int)j ) Au += lev.coef[1]*u[(i*ny+jp)*nz+k];
+                if ( km>=0 && km!=(int)k ) Au += lev.coef[2]*u[(i*ny+j)*nz+km];
+                if ( kp>=0 && kp!=(int)k ) Au += lev.coef[2]*u[(i*ny+j)*nz+kp];
+                lev.r[idx] = lev.f[idx] - Au;
+            }
+        }
+    }
+}
+
+// Weighted Jacobi : symmetric smoother, so that the V-cycle is a symmetric operator (required by the CG)
+void PoissonMultigrid::smooth( Level& lev, unsigned int nsteps )
+{
+    for ( unsigned int istep=0 ; istep<nsteps ; istep++ ) {
+        residual( lev );
+        for ( unsigned int idx=0 ; idx<lev.u.size() ; idx++ )
+            lev.u[idx] += omega*lev.r[idx]/lev.diag[idx];
+    }
+}
+
+void PoissonMultigrid::prolongationWeights( Level& fine, unsigned int idim, unsigned int ifine, int c[2], double w[2] )
+{
+    if ( !fine.coarsened[idim] ) {
+        c[0] = ifine; w[0] = 1.;
+        c[1] = -1;    w[1] = 0.;
+        return;
+    }
+    // Coarse node J sits on fine node 2J+1
+    int nc = fine.n[idim]/2;
+    if ( ifine%2==1 ) {
+        c[0] = (ifine-1)/2; w[0] = 1.;
+        c[1] = -1;          w[1] = 0.;
+        return;
+    }
+    c[0] = ifine/2-1; w[0] = 0.5;
+    c[1] = ifine/2;   w[1] = 0.5;
+    if ( fine.bc[idim]==MG_PERIODIC ) {
+        if ( c[0]<0 ) c[0] = nc-1;
+    } else if ( fine.bc[idim]==MG_NEUMANN ) {
+        if ( c[0]<0   ) c[0] = 0;
+        if ( c[1]>=nc ) c[1] = nc-1;
+    } else {
+        if ( c[0]<0   ) c[0] = -1;
+        if ( c[1]>=nc ) c[1] = -1;
+    }
+}
+
+// f_coarse = R r_fine, with R = P^T / 2^(number of coarsened dimensions)
+void PoissonMultigrid::restrict_residual( Level& fine, Level& coarse )
+{
+    double scale = 1.;
+    for ( unsigned int idim=0 ; idim<3 ; idim++ )
+        if ( fine.coarsened[idim] ) scale *= 0.5;
+
+    std::fill( coarse.f.begin(), coarse.f.end(), 0. );
+    unsigned int cny = coarse.n[1], cnz = coarse.n[2];
+    for ( unsigned int i=0 ; i<fine.n[0] ; i++ ) {
+        for ( unsigned int j=0 ; j<fine.n[1] ; j++ ) {
+            for ( unsigned int k=0 ; k<fine.n[2] ; k++ ) {
+                double r = scale*fine.r[(i*fine.n[1]+j)*fine.n[2]+k];
+                for ( int a=0 ; a<2 ; a++ ) {
+                    int ci = fine.pc[0][a][i];
+                    if ( ci<0 ) continue;
+                    for ( int b=0 ; b<2 ; b++ ) {
+                        int cj = fine.pc[1][b][j];
+                        if ( cj<0 ) continue;
+                        double wij = fine.pw[0][a][i]*fine.pw[1][b][j]*r;
+                        for ( int c=0 ; c<2 ; c++ ) {
+                            int ck = fine.pc[2][c][k];
+                            if ( ck<0 ) continue;
+                            coarse.f[(ci*cny+cj)*cnz+ck] += wij*fine.pw[2][c][k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// u_fine += P u_coarse
+void PoissonMultigrid::prolongate_and_correct( Level& coarse, Level& fine )
+{
+    unsigned int cny = coarse.n[1], cnz = coarse.n[2];
+    for ( unsigned int i=0 ; i<fine.n[0] ; i++ ) {
+        for ( unsigned int j=0 ; j<fine.n[1] ; j++ ) {
+            for ( unsigned int k=0 ; k<fine.n[2] ; k++ ) {
+                double corr = 0.;
+                for ( int a=0 ; a<2 ; a++ ) {
+                    int ci = fine.pc[0][a][i];
+                    if ( ci<0 ) continue;
+                    for ( int b=0 ; b<2 ; b++ ) {
+                        int cj = fine.pc[1][b][j];
+                        if ( cj<0 ) continue;
+                        double wij = fine.pw[0][a][i]*fine.pw[1][b][j];
+                        for ( int c=0 ; c<2 ; c++ ) {
+                            int ck = fine.pc[2][c][k];
+                            if ( ck<0 ) continue;
+                            corr += wij*fine.pw[2][c][k]*coarse.u[(ci*cny+cj)*cnz+ck];
+                        }
+                    }
+                }
+                fine.u[(i*fine.n[1]+j)*fine.n[2]+k] += corr;
+            }
+        }
+    }
+}
+
+void PoissonMultigrid::vcycle( unsigned int ilevel )
+{
+    Level& lev = levels[ilevel];
+    if ( ilevel==levels.size()-1 ) {
+        smooth( lev, coarsest_steps );
+        return;
+    }
+    Level& coarse = levels[ilevel+1];
+
+    smooth( lev, smoothing_steps );
+    residual( lev );
+    restrict_residual( lev, coarse );
+    std::fill( coarse.u.begin(), coarse.u.end(), 0. );
+    vcycle( ilevel+1 );
+    prolongate_and_correct( coarse, lev );
+    smooth( lev, smoothing_steps );
+}
+
+void PoissonMultigrid::solve( double* u, const double* f, unsigned int nb_cycles )
+{
+    Level& fine = levels[0];
+    std::copy( f, f+fine.f.size(), fine.f.begin() );
+    std::fill( fine.u.begin(), fine.u.end(), 0. );
+    for ( unsigned int icycle=0 ; icycle<nb_cycles ; icycle++ )
+        vcycle( 0 );
+    std::copy( fine.u.begin(), fine.u.end(), u );
+}
+
+
+// Conjugate gradient preconditioned by one V-cycle, used when a (nearly) exact solution is required
+void PoissonMultigrid::solve_pcg( double* u, const double* f, double relative_error, unsigned int max_iteration )
+{
+    Level& fine = levels[0];
+    unsigned int size = fine.u.size();
+    vector<double> x( size, 0. ), r( f, f+size ), z( size ), p( size ), Ap( size );
+
+    double f_norm2 = 0.;
+    for ( unsigned int idx=0 ; idx<size ; idx++ ) f_norm2 += r[idx]*r[idx];
+    if ( f_norm2==0. ) {
+        std::fill( u, u+size, 0. );
+        return;
+    }
+
+    solve( &z[0], &r[0], 1 );
+    p = z;
+    double r_dot_z = 0.;
+    for ( unsigned int idx=0 ; idx<size ; idx++ ) r_dot_z += r[idx]*z[idx];
+
+    for ( unsigned int iteration=0 ; iteration<max_iteration ; iteration++ ) {
+        // Ap = A p, obtained as minus the residual of p for a null source
+        std::copy( p.begin(), p.end(), fine.u.begin() );
+        std::fill( fine.f.begin(), fine.f.end(), 0. );
+        residual( fine );
+        double p_dot_Ap = 0.;
+        for ( unsigned int idx=0 ; idx<size ; idx++ ) {
+            Ap[idx] = -fine.r[idx];
+            p_dot_Ap += p[idx]*Ap[idx];
+        }
+        double alpha = r_dot_z/p_dot_Ap;
+        double r_norm2 = 0.;
+        for ( unsigned int idx=0 ; idx<size ; idx++ ) {
+            x[idx] += alpha*p [idx];
+            r[idx] -= alpha*Ap[idx];
+            r_norm2 += r[idx]*r[idx];
+        }
+        if ( r_norm2 <= relative_error*relative_error*f_norm2 ) break;
+
+        solve( &z[0], &r[0], 1 );
+        double rnew_dot_znew = 0.;
+        for ( unsigned int idx=0 ; idx<size ; idx++ ) rnew_dot_znew += r[idx]*z[idx];
+        double beta = rnew_dot_znew/r_dot_z;
+        r_dot_z = rnew_dot_znew;
+        for ( unsigned int idx=0 ; idx<size ; idx++ ) p[idx] = z[idx] + beta*p[idx];
+    }
+    std::copy( x.begin(), x.end(), u );
+}
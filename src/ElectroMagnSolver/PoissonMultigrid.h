@@ -0,0 +1,76 @@
+#ifndef POISSONMULTIGRID_H
+#define POISSONMULTIGRID_H
+
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PoissonMultigrid
+//! Geometric multigrid V-cycle for the discrete operator
+//!     (A u)_ijk = sum_d coef_d ( u_{i-e_d} + u_{i+e_d} - 2 u_i )
+//! on a structured box of up to 3 dimensions (unused dimensions have size 1 and coef 0).
+//! Used per patch as the local block of the Poisson preconditioner, and on the grid of patches
+//! as the agglomerated coarse level (see VectorPatch::solvePoisson).
+//  --------------------------------------------------------------------------------------------------------------------
+class PoissonMultigrid
+{
+
+public:
+    //! Boundary condition applied beyond the box, per dimension
+    enum { MG_DIRICHLET=0, MG_PERIODIC, MG_NEUMANN };
+
+    //! Creator for PoissonMultigrid: n = nb of nodes, coef = stencil coefficient, bc = boundary type (per dimension)
+    PoissonMultigrid( std::vector<unsigned int> n, std::vector<double> coef, std::vector<int> bc, unsigned int smoothing_steps=2 );
+    ~PoissonMultigrid() {};
+
+    //! Apply nb_cycles V-cycles to A u = f starting from u=0 (linear symmetric operator in f)
+    void solve( double* u, const double* f, unsigned int nb_cycles );
+
+    //! Solve A u = f with a V-cycle preconditioned conjugate gradient, down to the required relative residual
+    void solve_pcg( double* u, const double* f, double relative_error, unsigned int max_iteration );
+
+    //! Number of levels of the hierarchy
+    inline unsigned int nb_levels() { return levels.size(); }
+
+private:
+    struct Level {
+        unsigned int n[3];
+        double coef[3];
+        int bc[3];
+        //! Coupling with the Dirichlet boundary (lower & upper side), relative to coef
+        double bfac[3][2];
+        //! Neighbours along each dimension (-1 = Dirichlet zero)
+        std::vector<int> im[3], ip[3];
+        //! Is the next (coarser) level coarsened along each dimension
+        bool coarsened[3];
+        //! Prolongation from the next level : coarse indices and weights contributing to each fine index
+        std::vector<int> pc[3][2];
+        std::vector<double> pw[3][2];
+        std::vector<double> u, f, r;
+        //! Diagonal of the operator : contribution of each dimension, and total
+        std::vector<double> bdiag[3];
+        std::vector<double> diag;
+    };
+
+    //! Multigrid hierarchy, levels[0] is the finest
+    std::vector<Level> levels;
+
+    //! Number of (weighted Jacobi) pre- and post-smoothing steps
+    unsigned int smoothing_steps;
+    //! Number of smoothing steps on the coarsest level
+    unsigned int coarsest_steps;
+    //! Jacobi damping factor
+    double omega;
+
+    void initLevel( Level& lev );
+    void residual( Level& lev );
+    void smooth( Level& lev, unsigned int nsteps );
+    void restrict_residual( Level& fine, Level& coarse );
+    void prolongate_and_correct( Level& coarse, Level& fine );
+    void vcycle( unsigned int ilevel );
+
+    //! Coarse index (and weight) contributing to the fine index ifine along dimension idim of level lev
+    void prolongationWeights( Level& fine, unsigned int idim, unsigned int ifine, int c[2], double w[2] );
+};
+
+#endif
+
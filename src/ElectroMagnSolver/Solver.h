@@ -1,7 +1,10 @@
 #ifndef SOLVER_H
 #define SOLVER_H
 
+#include <algorithm>
+
 #include "Params.h"
+#include "Field.h"
 
 class ElectroMagn;
 
@@ -19,8 +22,41 @@ public:
     virtual void coupling( Params &params, ElectroMagn* EMfields ) {};
     //! Overloading of () operator
     virtual void operator()( ElectroMagn* fields) = 0;
+    //! Same as operator() on the rows [istart, iend) of the first dimension only (see SuperGrid::solveMaxwell),
+    //! for the solvers which compute each row from the other fields only
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend ) {
+        ERROR( "This Maxwell solver cannot be split in rows" );
+    };
+    
+    //! True if the (Maxwell-Faraday) solver writes all the points of B from the former B stored in B_m:
+    //! B_m is then saved by swapping the arrays of B and B_m instead of copying B (see saveMagneticFields)
+    virtual bool isOutOfPlace() { return false; };
 
 protected:
+    //! Copies B_m to B on the faces of B along its dual dimensions (the points of B that the Yee solvers do not update),
+    //! in the rows [istart, iend) of the first dimension
+    void copyDualFaces( Field* B, Field* B_m, unsigned int istart, unsigned int iend ) {
+        unsigned int n[3] = { 1, 1, 1 };
+        bool dual[3] = { false, false, false };
+        for (unsigned int d=0 ; d<B->dims_.size() ; d++) {
+            n   [d] = B->dims_[d];
+            dual[d] = B->isDual(d);
+        }
+        for (unsigned int i=istart ; i<std::min( iend, n[0] ) ; i++) {
+            bool face_i = dual[0] && ( i==0 || i==n[0]-1 );
+            for (unsigned int j=0 ; j<n[1] ; j++) {
+                field_t * b   = &B  ->data_[ (i*n[1]+j)*n[2] ];
+                field_t * b_m = &B_m->data_[ (i*n[1]+j)*n[2] ];
+                if ( face_i || ( dual[1] && ( j==0 || j==n[1]-1 ) ) ) {
+                    for (unsigned int k=0 ; k<n[2] ; k++)
+                        b[k] = b_m[k];
+                } else if ( dual[2] ) {
+                    b[0]      = b_m[0];
+                    b[n[2]-1] = b_m[n[2]-1];
+                }
+            }
+        }
+    };
 
 };//END class
 
@@ -11,9 +11,9 @@ class Solver1D : public Solver
 
 public:
     //! Creator for Solver
-    Solver1D(Params &params) : Solver(params) {
-        nx_p = params.n_space[0] * params.global_factor[0]+1+2*params.oversize[0];
-        nx_d = params.n_space[0] * params.global_factor[0]+2+2*params.oversize[0];
+    Solver1D(Params &params, std::vector<unsigned int> n_space) : Solver(params) {
+        nx_p = n_space[0]+1+2*params.oversize[0];
+        nx_d = n_space[0]+2+2*params.oversize[0];
         
         dt = params.timestep;
         dt_ov_dx = params.timestep / params.cell_length[0];
@@ -11,11 +11,11 @@ class Solver2D : public Solver
 
 public:
     //! Creator for Solver
-    Solver2D(Params &params) : Solver(params) {
-        nx_p = params.n_space[0] * params.global_factor[0]+1+2*params.oversize[0];
-        nx_d = params.n_space[0] * params.global_factor[0]+2+2*params.oversize[0];
-        ny_p = params.n_space[1] * params.global_factor[1]+1+2*params.oversize[1];
-        ny_d = params.n_space[1] * params.global_factor[1]+2+2*params.oversize[1];
+    Solver2D(Params &params, std::vector<unsigned int> n_space) : Solver(params) {
+        nx_p = n_space[0]+1+2*params.oversize[0];
+        nx_d = n_space[0]+2+2*params.oversize[0];
+        ny_p = n_space[1]+1+2*params.oversize[1];
+        ny_d = n_space[1]+2+2*params.oversize[1];
         
         dt = params.timestep;
         dt_ov_dx = params.timestep / params.cell_length[0];
@@ -1,6 +1,8 @@
 #ifndef SOLVER3D_H
 #define SOLVER3D_H
 
+#include <algorithm>
+
 #include "Solver.h"
 
 //  --------------------------------------------------------------------------------------------------------------------
@@ -11,19 +13,21 @@ class Solver3D : public Solver
 
 public:
     //! Creator for Solver
-    Solver3D(Params &params) : Solver(params) {
-	nx_p = params.n_space[0] * params.global_factor[0]+1+2*params.oversize[0];
-	nx_d = params.n_space[0] * params.global_factor[0]+2+2*params.oversize[0];
-	ny_p = params.n_space[1] * params.global_factor[1]+1+2*params.oversize[1];
-	ny_d = params.n_space[1] * params.global_factor[1]+2+2*params.oversize[1];
-	nz_p = params.n_space[2] * params.global_factor[2]+1+2*params.oversize[2];
-	nz_d = params.n_space[2] * params.global_factor[2]+2+2*params.oversize[2];
+    Solver3D(Params &params, std::vector<unsigned int> n_space) : Solver(params) {
+	nx_p = n_space[0]+1+2*params.oversize[0];
+	nx_d = n_space[0]+2+2*params.oversize[0];
+	ny_p = n_space[1]+1+2*params.oversize[1];
+	ny_d = n_space[1]+2+2*params.oversize[1];
+	nz_p = n_space[2]+1+2*params.oversize[2];
+	nz_d = n_space[2]+2+2*params.oversize[2];
 
         dt = params.timestep;
 	dt_ov_dx = params.timestep / params.cell_length[0];
 	dt_ov_dy = params.timestep / params.cell_length[1];
 	dt_ov_dz = params.timestep / params.cell_length[2];
 
+        // Rows along y of a block : about 16 kB per field
+        ny_block = std::max( 2048u/nz_d, 1u );
     };
     virtual ~Solver3D() {};
 
@@ -41,6 +45,8 @@ protected:
     double dt_ov_dx;
     double dt_ov_dy;
     double dt_ov_dz;
+    //! Number of rows along y processed together by the blocked solvers
+    unsigned int ny_block;
 
 };//END class
 
@@ -17,6 +17,7 @@
 #include "PXR_Solver2D_GPSTD.h"
 #include "PXR_Solver3D_FDTD.h"
 #include "PXR_Solver3D_GPSTD.h"
+#include "PSATD_Solver.h"
 
 #include "Params.h"
 
@@ -27,35 +28,36 @@ public:
     
     // create Maxwell-Ampere solver
     // -----------------------------
-    static Solver* createMA(Params& params) {
+    static Solver* createMA(Params& params, std::vector<unsigned int> n_space) {
         Solver* solver = NULL;
         DEBUG(params.maxwell_sol);
         
         if ( params.geometry == "1Dcartesian" ) {
-            solver = new MA_Solver1D_norm(params);
+            solver = new MA_Solver1D_norm(params, n_space);
         } else if ( params.geometry == "2Dcartesian" ) {
             if ( params.is_pxr == false ) {
                 if (params.is_spectral)
-                    WARNING( "PS solveur are not available without Picsar" );
-                if (params.Friedman_filter) {
-                    solver = new MA_Solver2D_Friedman(params);
+                    solver = new PSATD_Solver(params);
+                else if (params.Friedman_filter) {
+                    solver = new MA_Solver2D_Friedman(params, n_space);
                 } else {
-                    solver = new MA_Solver2D_norm(params);
+                    solver = new MA_Solver2D_norm(params, n_space);
                 }
             }
             else if ( params.is_spectral == true )
-                solver = new PXR_Solver2D_GPSTD(params);
+                solver = new PXR_Solver2D_GPSTD(params, n_space);
             
         } else if ( params.geometry == "3Dcartesian" ) {
             if ( params.is_pxr == false ) {
                 if (params.is_spectral)
-                    WARNING( "PS solveur are not available without Picsar" );
-                solver = new MA_Solver3D_norm(params);
+                    solver = new PSATD_Solver(params);
+                else
+                    solver = new MA_Solver3D_norm(params, n_space);
             }
             else if ( ( params.is_pxr == true ) && ( params.is_spectral == false ) )
-                solver = new PXR_Solver3D_FDTD(params);
+                solver = new PXR_Solver3D_FDTD(params, n_space);
             else if ( ( params.is_pxr == true ) && ( params.is_spectral == true ) )
-                solver = new PXR_Solver3D_GPSTD(params);                
+                solver = new PXR_Solver3D_GPSTD(params, n_space);                
         } 
         
         if (!solver)
@@ -66,7 +68,7 @@ public:
     
     // Create Maxwell-Faraday solver
     // -----------------------------
-    static Solver* createMF(Params& params) {
+    static Solver* createMF(Params& params, std::vector<unsigned int> n_space) {
         Solver* solver = NULL;
         DEBUG(params.maxwell_sol);
         
@@ -74,33 +76,33 @@ public:
         // -------------------------------------------------
         if ( params.geometry == "1Dcartesian" ) {
             if (params.maxwell_sol == "Yee") {
-                solver = new MF_Solver1D_Yee(params);
+                solver = new MF_Solver1D_Yee(params, n_space);
             }
         } else if ( params.geometry == "2Dcartesian" ) {
-            if ( params.is_pxr == false ) {
+            if ( ( params.is_pxr == false ) && ( params.is_spectral == false ) ) {
 
                 if (params.maxwell_sol == "Yee") {
-                    solver = new MF_Solver2D_Yee(params);
+                    solver = new MF_Solver2D_Yee(params, n_space);
                 } else if (params.maxwell_sol == "Grassi") {
-                    solver = new MF_Solver2D_Grassi(params);
+                    solver = new MF_Solver2D_Grassi(params, n_space);
                 } else if (params.maxwell_sol == "GrassiSpL") {
-                    solver = new MF_Solver2D_GrassiSpL(params);
+                    solver = new MF_Solver2D_GrassiSpL(params, n_space);
                 } else if (params.maxwell_sol == "Cowan") {
-                    solver = new MF_Solver2D_Cowan(params);
+                    solver = new MF_Solver2D_Cowan(params, n_space);
                 } else if(params.maxwell_sol == "Lehe" ){
-                    solver = new MF_Solver2D_Lehe(params);
+                    solver = new MF_Solver2D_Lehe(params, n_space);
                 }
             }
             else if ( params.is_spectral == true )
                 solver = new NullSolver(params);
 
         } else if ( params.geometry == "3Dcartesian" ) {
-            if ( params.is_pxr == false ) {
+            if ( ( params.is_pxr == false ) && ( params.is_spectral == false ) ) {
                 if (params.maxwell_sol == "Yee") {
-                    solver = new MF_Solver3D_Yee(params);
+                    solver = new MF_Solver3D_Yee(params, n_space);
                 }
                 else if(params.maxwell_sol == "Lehe" ){
-                    solver = new MF_Solver3D_Lehe(params);
+                    solver = new MF_Solver3D_Lehe(params, n_space);
                 }
             }
             else
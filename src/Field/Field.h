@@ -99,18 +99,20 @@ public:
     //! Linearized diags
     unsigned int globalDims_;
     //! pointer to the linearized array
-    double* data_;
+    field_t* data_;
+    //! True if data_ is a part of an array owned elsewhere (see setView), not freed with the Field
+    bool is_view_ = false;
     
-    inline double* data() {return data_;}
+    inline field_t* data() {return data_;}
     //! reference access to the linearized array (with check in DEBUG mode)
-    inline double& operator () (unsigned int i)
+    inline field_t& operator () (unsigned int i)
     {
         DEBUGEXEC(if (i>=globalDims_) ERROR(name << " Out of limits "<< i << " < " <<dims_[0] ));
         DEBUGEXEC(if (!std::isfinite(data_[i])) ERROR(name << " Not finite "<< i << " = " << data_[i]));
         return data_[i];
     };
     //! access to the linearized array (with check in DEBUG mode)
-    inline double operator () (unsigned int i) const
+    inline field_t operator () (unsigned int i) const
     {
         DEBUGEXEC(if (i>=globalDims_) ERROR(name << " Out of limits "<< i));
         DEBUGEXEC(if (!std::isfinite(data_[i])) ERROR(name << " Not finite "<< i << " = " << data_[i]));
@@ -132,7 +134,7 @@ public:
     
     
     //! 2D reference access to the linearized array (with check in DEBUG mode)
-    inline double& operator () (unsigned int i,unsigned int j)
+    inline field_t& operator () (unsigned int i,unsigned int j)
     {
         int unsigned idx = i*dims_[1]+j;
         DEBUGEXEC(if (idx>=globalDims_) ERROR("Out of limits & "<< i << " " << j));
@@ -140,7 +142,7 @@ public:
         return data_[idx];
     };
     //! 2D access to the linearized array (with check in DEBUG mode)
-    inline double operator () (unsigned int i, unsigned int j) const
+    inline field_t operator () (unsigned int i, unsigned int j) const
     {
         unsigned int idx = i*dims_[1]+j;
         DEBUGEXEC(if (idx>=globalDims_) ERROR("Out of limits "<< i << " " << j));
@@ -149,7 +151,7 @@ public:
     };
 
     //! 3D reference access to the linearized array (with check in DEBUG mode)
-    inline double& operator () (unsigned int i,unsigned int j, unsigned k)
+    inline field_t& operator () (unsigned int i,unsigned int j, unsigned k)
     {
 	unsigned int idx = i*dims_[1]*dims_[2]+j*dims_[2]+k;
         DEBUGEXEC(if (idx>=globalDims_) ERROR("Out of limits & "<< i << " " << j));
@@ -157,7 +159,7 @@ public:
         return data_[idx];
     };
     //! 3D access to the linearized array (with check in DEBUG mode)
-    inline double operator () (unsigned int i, unsigned int j, unsigned k) const
+    inline field_t operator () (unsigned int i, unsigned int j, unsigned k) const
     {
 	unsigned int idx = i*dims_[1]*dims_[2]+j*dims_[2]+k;
         DEBUGEXEC(if (idx>=globalDims_) ERROR("Out of limits "<< i << " " << j));
@@ -211,6 +213,12 @@ public:
         }
     }
     
+    //! Exchanges the arrays of two fields of the same dimensions (no copy)
+    virtual void swapData(Field *other) = 0;
+
+    //! Use the array data (owned elsewhere, see SuperGrid) instead of data_, which is freed (no copy)
+    virtual void setView(field_t* data) = 0;
+    
     virtual void put( Field* outField, Params &params, SmileiMPI* smpi, Patch* thisPatch, Patch*  outPatch ) = 0;
     virtual void get( Field*  inField, Params &params, SmileiMPI* smpi, Patch*   inPatch, Patch* thisPatch ) = 0;
 
@@ -57,7 +57,7 @@ Field1D::Field1D(string name, vector<unsigned int> dims) : Field(dims, name)
 // ---------------------------------------------------------------------------------------------------------------------
 Field1D::~Field1D()
 {
-    if (data_!=NULL) {
+    if (data_!=NULL && !is_view_) {
         delete [] data_;
     }
 }
@@ -73,7 +73,7 @@ void Field1D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[ dims_[0] ];
+    data_ = new field_t[ dims_[0] ];
     //! \todo{change to memset (JD)}
     for (unsigned int i=0; i<dims_[0]; i++) data_[i]=0.0;
     
@@ -117,7 +117,7 @@ void Field1D::allocateDims(unsigned int mainDim, bool isPrimal)
     for ( unsigned int j=0 ; j<dims_.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[ dims_[0] ];
+    data_ = new field_t[ dims_[0] ];
     //! \todo{change to memset (JD)}
     for (unsigned int i=0; i<dims_[0]; i++) data_[i]=0.0;
     
@@ -139,8 +139,8 @@ void Field1D::dump(vector<unsigned int> dims)
 // ---------------------------------------------------------------------------------------------------------------------
 void Field1D::shift_x(unsigned int delta)
 {
-    memmove( &(data_[0]), &(data_[delta]), (dims_[0]-delta)*sizeof(double) );
-    //memset ( &(data_[dims_[0]-delta]), 0, delta*sizeof(double));
+    memmove( &(data_[0]), &(data_[delta]), (dims_[0]-delta)*sizeof(field_t) );
+    //memset ( &(data_[dims_[0]-delta]), 0, delta*sizeof(field_t));
     for (int i=dims_[0]-delta;i<(int)dims_[0];i++) data_[i] = 0.;
 
 }
@@ -169,7 +169,7 @@ void Field1D::put( Field* outField, Params &params, SmileiMPI* smpi, Patch* this
 
     std::vector<unsigned int> dual =  this->isDual_;
 
-    int iout = thisPatch->Pcoordinates[0]*params.n_space[0] - outPatch->Pcoordinates[0]*params.n_space[0]*params.global_factor[0] ;
+    int iout = thisPatch->Pcoordinates[0]*params.n_space[0] - outPatch->Pcoordinates[0]*outPatch->n_space[0] ;
  
     for ( unsigned int i = 0 ; i < this->dims_[0] ; i++ ) {
         ( *out1D )( iout+i ) = ( *this )( i );
@@ -184,10 +184,29 @@ void Field1D::get( Field* inField, Params &params, SmileiMPI* smpi, Patch* inPat
 
     std::vector<unsigned int> dual =  in1D->isDual_;
 
-    int iin = thisPatch->Pcoordinates[0]*params.n_space[0] - inPatch->Pcoordinates[0]*params.n_space[0]*params.global_factor[0] ;
+    int iin = thisPatch->Pcoordinates[0]*params.n_space[0] - inPatch->Pcoordinates[0]*inPatch->n_space[0] ;
  
     for ( unsigned int i = 0 ; i < this->dims_[0] ; i++ ) {
         ( *this )( i ) = ( *in1D )( iin+i );
     }    
    
 }
+
+
+// Exchanges the arrays of two fields of the same dimensions
+void Field1D::swapData(Field *other)
+{
+    Field1D * other1D = static_cast<Field1D*>( other );
+    DEBUGEXEC(if (globalDims_!=other1D->globalDims_) ERROR("Field size do not match "<< name << " " << other1D->name));
+    std::swap( data_, other1D->data_ );
+    std::swap( is_view_, other1D->is_view_ );
+}
+
+
+// Use the array data (owned elsewhere, see SuperGrid) instead of data_
+void Field1D::setView(field_t* data)
+{
+    if (!is_view_) delete [] data_;
+    data_ = data;
+    is_view_ = true;
+}
@@ -59,9 +59,11 @@ public:
     
     //! Method to shift field in space
     void shift_x(unsigned int delta);
+    void swapData(Field *other);
+    void setView(field_t* data);
     
     //! Overloading of the () operator allowing to set a new value for the ith element of a Field1D
-    inline double& operator () (unsigned int i)
+    inline field_t& operator () (unsigned int i)
     {
         DEBUGEXEC(if (i>=dims_[0]) ERROR(name << "Out of limits & "<< i));
         DEBUGEXEC(if (!std::isfinite(data_[i])) ERROR(name << " not finite at i=" << i << " = " << data_[i]));
@@ -69,7 +71,7 @@ public:
     };
     
     //! Overloading of the () operator allowing to get the value of the ith element of a Field1D
-    inline double operator () (unsigned int i) const
+    inline field_t operator () (unsigned int i) const
     {
         DEBUGEXEC(if (i>=dims_[0]) ERROR(name << "Out of limits "<< i));
         DEBUGEXEC(if (!std::isfinite(data_[i])) ERROR(name << "Not finite "<< i << " = " << data_[i]));
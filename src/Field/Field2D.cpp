@@ -65,7 +65,7 @@ Field2D::~Field2D()
 {
 
     if (data_!=NULL) {
-        delete [] data_;
+        if (!is_view_) delete [] data_;
         delete [] data_2D;
     }
 }
@@ -82,10 +82,10 @@ void Field2D::allocateDims()
 
     isDual_.resize( dims_.size(), 0 );
 
-    data_ = new double[dims_[0]*dims_[1]];
+    data_ = new field_t[dims_[0]*dims_[1]];
     //! \todo{check row major order!!! (JD)}
 
-    data_2D= new double*[dims_[0]];
+    data_2D= new field_t*[dims_[0]];
     for (unsigned int i=0; i<dims_[0]; i++) {
         data_2D[i] = data_ + i*dims_[1];
         for (unsigned int j=0; j<dims_[1]; j++) data_2D[i][j] = 0.0;
@@ -133,10 +133,10 @@ void Field2D::allocateDims(unsigned int mainDim, bool isPrimal )
     for ( unsigned int j=0 ; j<dims_.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[dims_[0]*dims_[1]];
+    data_ = new field_t[dims_[0]*dims_[1]];
     //! \todo{check row major order!!! (JD)}
     
-    data_2D= new double*[dims_[0]];
+    data_2D= new field_t*[dims_[0]];
     for (unsigned int i=0; i<dims_[0]; i++)  {
         data_2D[i] = data_ + i*dims_[1];
         for (unsigned int j=0; j<dims_[1]; j++) data_2D[i][j] = 0.0;
@@ -161,8 +161,8 @@ void Field2D::dump(vector<unsigned int> dims)
 // ---------------------------------------------------------------------------------------------------------------------
 void Field2D::shift_x(unsigned int delta)
 {
-    memmove( &(data_2D[0][0]), &(data_2D[delta][0]), (dims_[1]*dims_[0]-delta*dims_[1])*sizeof(double) );
-    memset( &(data_2D[dims_[0]-delta][0]), 0, delta*dims_[1]*sizeof(double));
+    memmove( &(data_2D[0][0]), &(data_2D[delta][0]), (dims_[1]*dims_[0]-delta*dims_[1])*sizeof(field_t) );
+    memset( &(data_2D[dims_[0]-delta][0]), 0, delta*dims_[1]*sizeof(field_t));
     
 }
 
@@ -192,8 +192,8 @@ void Field2D::put( Field* outField, Params &params, SmileiMPI* smpi, Patch* this
 
     std::vector<unsigned int> dual =  this->isDual_;
 
-    int iout = thisPatch->Pcoordinates[0]*params.n_space[0] - outPatch->Pcoordinates[0]*params.n_space[0]*params.global_factor[0] ;
-    int jout = thisPatch->Pcoordinates[1]*params.n_space[1] - outPatch->Pcoordinates[1]*params.n_space[1]*params.global_factor[1] ;
+    int iout = thisPatch->Pcoordinates[0]*params.n_space[0] - outPatch->Pcoordinates[0]*outPatch->n_space[0] ;
+    int jout = thisPatch->Pcoordinates[1]*params.n_space[1] - outPatch->Pcoordinates[1]*outPatch->n_space[1] ;
  
     //for ( unsigned int i = params.oversize[0] ; i < this->dims_[0]-params.oversize[0] ; i++ ) {
     //    for ( unsigned int j = params.oversize[1] ; j < this->dims_[1]-params.oversize[1] ; j++ ) {
@@ -213,8 +213,8 @@ void Field2D::get( Field* inField, Params &params, SmileiMPI* smpi, Patch* inPat
 
     std::vector<unsigned int> dual =  in2D->isDual_;
 
-    int iin = thisPatch->Pcoordinates[0]*params.n_space[0] - inPatch->Pcoordinates[0]*params.n_space[0]*params.global_factor[0] ;
-    int jin = thisPatch->Pcoordinates[1]*params.n_space[1] - inPatch->Pcoordinates[1]*params.n_space[1]*params.global_factor[1] ;
+    int iin = thisPatch->Pcoordinates[0]*params.n_space[0] - inPatch->Pcoordinates[0]*inPatch->n_space[0] ;
+    int jin = thisPatch->Pcoordinates[1]*params.n_space[1] - inPatch->Pcoordinates[1]*inPatch->n_space[1] ;
  
     //for ( unsigned int i = params.oversize[0] ; i < out2D->dims_[0]-params.oversize[0] ; i++ ) {
     //    for ( unsigned int j = params.oversize[1] ; j < out2D->dims_[1]-params.oversize[1] ; j++ ) {
@@ -226,3 +226,25 @@ void Field2D::get( Field* inField, Params &params, SmileiMPI* smpi, Patch* inPat
     }    
    
 }
+
+
+// Exchanges the arrays of two fields of the same dimensions
+void Field2D::swapData(Field *other)
+{
+    Field2D * other2D = static_cast<Field2D*>( other );
+    DEBUGEXEC(if (globalDims_!=other2D->globalDims_) ERROR("Field size do not match "<< name << " " << other2D->name));
+    std::swap( data_, other2D->data_ );
+    std::swap( data_2D, other2D->data_2D );
+    std::swap( is_view_, other2D->is_view_ );
+}
+
+
+// Use the array data (owned elsewhere, see SuperGrid) instead of data_
+void Field2D::setView(field_t* data)
+{
+    if (!is_view_) delete [] data_;
+    data_ = data;
+    is_view_ = true;
+    for (unsigned int i=0; i<dims_[0]; i++)
+        data_2D[i] = data_ + i*dims_[1];
+}
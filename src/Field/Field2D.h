@@ -56,9 +56,11 @@ public:
     //! Method used to dump the data contained in a Field2D
     void dump(std::vector<unsigned int> dims);
     virtual void shift_x(unsigned int delta);
+    virtual void swapData(Field *other);
+    virtual void setView(field_t* data);
     
     //! Overloading of the () operator allowing to set a new value for the (i,j) element of a Field2D
-    inline double& operator () (unsigned int i,unsigned int j) {
+    inline field_t& operator () (unsigned int i,unsigned int j) {
         DEBUGEXEC(if (i>=dims_[0] || j>=dims_[1]) ERROR(name << "Out of limits ("<< i << "," << j << ")  > (" <<dims_[0] << "," <<dims_[1] << ")" ));
         DEBUGEXEC(if (!std::isfinite(data_2D[i][j])) ERROR(name << " Not finite "<< i << "," << j << " = " << data_2D[i][j]));
         return data_2D[i][j];
@@ -71,7 +73,7 @@ public:
     };*/
     
     //! Overloading of the () operator allowing to get the value of the (i,j) element of a Field2D
-    inline double operator () (unsigned int i,unsigned int j) const {
+    inline field_t operator () (unsigned int i,unsigned int j) const {
         DEBUGEXEC(if (i>=dims_[0] || j>=dims_[1]) ERROR(name << "Out of limits "<< i << " " << j));
         DEBUGEXEC(if (!std::isfinite(data_2D[i][j])) ERROR(name << "Not finite "<< i << "," << j << " = " << data_2D[i][j]));
         return data_2D[i][j];
@@ -92,7 +94,7 @@ public:
     //!\todo{Comment what are these stuffs (MG for JD)}
     //double *data_2D;
     //! this will present the data as a 2d matrix
-    double **data_2D;
+    field_t **data_2D;
     
 };
 
@@ -65,7 +65,7 @@ Field3D::Field3D(string name, vector<unsigned int> dims) : Field(dims, name)
 Field3D::~Field3D()
 {
     if (data_!=NULL) {
-        delete [] data_;
+        if (!is_view_) delete [] data_;
         for (unsigned int i=0; i<dims_[0]; i++) delete [] data_3D[i];
         delete [] data_3D;
     }
@@ -81,12 +81,12 @@ void Field3D::allocateDims() {
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    data_ = new field_t[dims_[0]*dims_[1]*dims_[2]];
     //! \todo{check row major order!!!}
-    data_3D= new double**[dims_[0]];
+    data_3D= new field_t**[dims_[0]];
     for (unsigned int i=0; i<dims_[0]; i++)
     {
-        data_3D[i]= new double*[dims_[1]];
+        data_3D[i]= new field_t*[dims_[1]];
         for (unsigned int j=0; j<dims_[1]; j++)
         {
             data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
@@ -139,12 +139,12 @@ void Field3D::allocateDims(unsigned int mainDim, bool isPrimal ) {
     for ( unsigned int j=0 ; j<dims_.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    data_ = new field_t[dims_[0]*dims_[1]*dims_[2]];
     //! \todo{check row major order!!!}
-    data_3D= new double**[dims_[0]*dims_[1]];
+    data_3D= new field_t**[dims_[0]*dims_[1]];
     for (unsigned int i=0; i<dims_[0]; i++)
     {
-        data_3D[i]= new double*[dims_[1]];
+        data_3D[i]= new field_t*[dims_[1]];
         for (unsigned int j=0; j<dims_[1]; j++)
         {
             data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
@@ -173,8 +173,8 @@ void Field3D::dump(vector<unsigned int> dims)
 // ---------------------------------------------------------------------------------------------------------------------
 void Field3D::shift_x(unsigned int delta)
 {
-    memmove( &(data_3D[0][0][0]), &(data_3D[delta][0][0]), (dims_[2]*dims_[1]*dims_[0]-delta*dims_[2]*dims_[1])*sizeof(double) );
-    memset( &(data_3D[dims_[0]-delta][0][0]), 0, delta*dims_[1]*dims_[2]*sizeof(double));
+    memmove( &(data_3D[0][0][0]), &(data_3D[delta][0][0]), (dims_[2]*dims_[1]*dims_[0]-delta*dims_[2]*dims_[1])*sizeof(field_t) );
+    memset( &(data_3D[dims_[0]-delta][0][0]), 0, delta*dims_[1]*dims_[2]*sizeof(field_t));
 
 }
 
@@ -245,9 +245,9 @@ void Field3D::put( Field* outField, Params &params, SmileiMPI* smpi, Patch* this
 
     std::vector<unsigned int> dual =  this->isDual_;
 
-    int iout = thisPatch->Pcoordinates[0]*params.n_space[0] - outPatch->Pcoordinates[0]*params.n_space[0]*params.global_factor[0] ;
-    int jout = thisPatch->Pcoordinates[1]*params.n_space[1] - outPatch->Pcoordinates[1]*params.n_space[1]*params.global_factor[1] ;
-    int kout = thisPatch->Pcoordinates[2]*params.n_space[2] - outPatch->Pcoordinates[2]*params.n_space[2]*params.global_factor[2] ;
+    int iout = thisPatch->Pcoordinates[0]*params.n_space[0] - outPatch->Pcoordinates[0]*outPatch->n_space[0] ;
+    int jout = thisPatch->Pcoordinates[1]*params.n_space[1] - outPatch->Pcoordinates[1]*outPatch->n_space[1] ;
+    int kout = thisPatch->Pcoordinates[2]*params.n_space[2] - outPatch->Pcoordinates[2]*outPatch->n_space[2] ;
 
     for ( unsigned int i = 0 ; i < this->dims_[0] ; i++ ) {
         for ( unsigned int j = 0 ; j < this->dims_[1] ; j++ ) {
@@ -266,9 +266,9 @@ void Field3D::get( Field* inField, Params &params, SmileiMPI* smpi, Patch* inPat
 
     std::vector<unsigned int> dual =  in3D->isDual_;
 
-    int iin = thisPatch->Pcoordinates[0]*params.n_space[0] - inPatch->Pcoordinates[0]*params.n_space[0]*params.global_factor[0] ;
-    int jin = thisPatch->Pcoordinates[1]*params.n_space[1] - inPatch->Pcoordinates[1]*params.n_space[1]*params.global_factor[1] ;
-    int kin = thisPatch->Pcoordinates[2]*params.n_space[2] - inPatch->Pcoordinates[2]*params.n_space[2]*params.global_factor[2] ;
+    int iin = thisPatch->Pcoordinates[0]*params.n_space[0] - inPatch->Pcoordinates[0]*inPatch->n_space[0] ;
+    int jin = thisPatch->Pcoordinates[1]*params.n_space[1] - inPatch->Pcoordinates[1]*inPatch->n_space[1] ;
+    int kin = thisPatch->Pcoordinates[2]*params.n_space[2] - inPatch->Pcoordinates[2]*inPatch->n_space[2] ;
     
     for ( unsigned int i = 0 ; i < this->dims_[0] ; i++ ) {
         for ( unsigned int j = 0 ; j < this->dims_[1] ; j++ ) {
@@ -279,3 +279,26 @@ void Field3D::get( Field* inField, Params &params, SmileiMPI* smpi, Patch* inPat
     }    
    
 }
+
+
+// Exchanges the arrays of two fields of the same dimensions
+void Field3D::swapData(Field *other)
+{
+    Field3D * other3D = static_cast<Field3D*>( other );
+    DEBUGEXEC(if (globalDims_!=other3D->globalDims_) ERROR("Field size do not match "<< name << " " << other3D->name));
+    std::swap( data_, other3D->data_ );
+    std::swap( data_3D, other3D->data_3D );
+    std::swap( is_view_, other3D->is_view_ );
+}
+
+
+// Use the array data (owned elsewhere, see SuperGrid) instead of data_
+void Field3D::setView(field_t* data)
+{
+    if (!is_view_) delete [] data_;
+    data_ = data;
+    is_view_ = true;
+    for (unsigned int i=0; i<dims_[0]; i++)
+        for (unsigned int j=0; j<dims_[1]; j++)
+            data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
+}
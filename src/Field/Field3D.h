@@ -57,9 +57,11 @@ public:
     //! Method used to dump the data contained in a Field3D
     void dump(std::vector<unsigned int> dims);
     virtual void shift_x(unsigned int delta);
+    virtual void swapData(Field *other);
+    virtual void setView(field_t* data);
     
     //! Overloading of the () operator allowing to set a new value for the (i,j,k) element of a Field3D
-    inline double& operator () (unsigned int i,unsigned int j,unsigned int k)
+    inline field_t& operator () (unsigned int i,unsigned int j,unsigned int k)
     {
         DEBUGEXEC(if (i>=dims_[0] || j>=dims_[1] || k >= dims_[2]) ERROR(name << "Out of limits & "<< i << " " << j << " " << k));
         return data_3D[i][j][k];
@@ -73,7 +75,7 @@ public:
     };*/
     
     //! Overloading of the () operator allowing to get the value for the (i,j,k) element of a Field3D
-    inline double operator () (unsigned int i,unsigned int j,unsigned int k) const {
+    inline field_t operator () (unsigned int i,unsigned int j,unsigned int k) const {
         DEBUGEXEC(if (i>=dims_[0] || j>=dims_[1] || k >= dims_[2]) ERROR(name << "Out of limits "<< i << " " << j << " " << k));
         return data_3D[i][j][k];
     };
@@ -96,7 +98,7 @@ public:
     //!\todo{Comment what are these stuffs (MG for JD)}
     //double *data_3D;
     //! this will present the data as a 3d matrix
-    double ***data_3D;
+    field_t ***data_3D;
     
 };
 
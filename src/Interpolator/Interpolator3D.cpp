@@ -4,6 +4,9 @@
 #include <iostream>
 
 #include "Patch.h"
+#include "ElectroMagn.h"
+#include "Field3D.h"
+#include "Particles.h"
 
 using namespace std;
 
@@ -16,3 +19,52 @@ Interpolator3D::Interpolator3D(Params &params, Patch* patch)
 
 }
 
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Stage E and B_m in a compact buffer before the interpolation of the particles of a bin :
+// the six components are read once per bin, contiguously, instead of from six arrays for each particle
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator3D::stageFields( ElectroMagn* EMfields, Particles &particles, int istart, int iend, int halo, vector<double> &tile )
+{
+    Field* F[6] = { EMfields->Ex_, EMfields->Ey_, EMfields->Ez_, EMfields->Bx_m, EMfields->By_m, EMfields->Bz_m };
+
+    // Nodes along x, y and z : central primal nodes of the particles, +1 for the dual nodes, +- halo for the stencil
+    int domain_begin[3] = { i_domain_begin, j_domain_begin, k_domain_begin };
+    double d_inv[3] = { dx_inv_, dy_inv_, dz_inv_ };
+    int n0[3], n1[3];
+    for ( int idim=0 ; idim<3 ; idim++ ) {
+        int nmin(0), nmax(-1);
+        for ( int ipart=istart ; ipart<iend ; ipart++ ) {
+            int np = round( particles.position(idim, ipart)*d_inv[idim] ) - domain_begin[idim];
+            if ( ipart==istart || np<nmin ) nmin = np;
+            if ( ipart==istart || np>nmax ) nmax = np;
+        }
+        // Number of dual nodes along idim : Ex along x, Ey along y, Ez along z
+        n0[idim] = max( nmin-halo, 0 );
+        n1[idim] = max( min( nmax+2+halo, (int)F[idim]->dims_[idim] ), n0[idim] );
+    }
+    tile_i0_ = n0[0];
+    tile_j0_ = n0[1];
+    tile_k0_ = n0[2];
+    tile_ny_ = n1[1]-n0[1];
+    tile_nz_ = n1[2]-n0[2];
+
+    tile.resize( (n1[0]-n0[0])*tile_ny_*tile_nz_*6 );
+    tile_ = tile.data();
+
+    for ( unsigned int icomp=0 ; icomp<6 ; icomp++ ) {
+        Field3D* f = static_cast<Field3D*>( F[icomp] );
+        int iend_comp = min( n1[0], (int)f->dims_[0] );
+        int jend_comp = min( n1[1], (int)f->dims_[1] );
+        int kend_comp = min( n1[2], (int)f->dims_[2] );
+        for ( int i=tile_i0_ ; i<iend_comp ; i++ ) {
+            for ( int j=tile_j0_ ; j<jend_comp ; j++ ) {
+                field_t* row = &(*f)( i, j, 0 );
+                double* t = &tileValue( icomp, i, j, tile_k0_ );
+                for ( int k=tile_k0_ ; k<kend_comp ; k++ )
+                    t[6*( k-tile_k0_ )] = row[k];
+            }
+        }
+    }
+}
@@ -19,6 +19,19 @@ public:
     virtual void operator()  (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int *istart, int *iend, int ithread) override = 0  ;
 
 protected:
+    //! Copies the six components of E and B_m around the particles [istart, iend[ in tile, interleaved node by node:
+    //! nodes along x, y and z reached by their stencil (halo nodes around the central node).
+    void stageFields( ElectroMagn* EMfields, Particles &particles, int istart, int iend, int halo, std::vector<double> &tile );
+
+    //! Value of the component icomp (Ex, Ey, Ez, Bx, By, Bz) at the node (i,j,k) of the patch, in the staged tile
+    inline double& tileValue( int icomp, int i, int j, int k ) {
+        return tile_[ ( ( (i-tile_i0_)*tile_ny_ + j-tile_j0_ )*tile_nz_ + k-tile_k0_ )*6 + icomp ];
+    };
+
+    //! Staged tile, its first node along x, y and z and its number of nodes along y and z
+    double* tile_;
+    int tile_i0_, tile_j0_, tile_k0_, tile_ny_, tile_nz_;
+
     //! Inverse of the spatial-step
     double dx_inv_;
     double dy_inv_;
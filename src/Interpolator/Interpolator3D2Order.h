@@ -34,7 +34,26 @@ public:
 	return interp_res;
     };  
 
+    //! Same as compute, from the fields staged by stageFields (icomp = 0..5 for Ex, Ey, Ez, Bx, By, Bz)
+    inline double computeTile( double* coeffx, double* coeffy, double* coeffz, int icomp, int idx, int idy, int idz) {
+        double interp_res(0.);
+        double* f = &tileValue(icomp, idx, idy, idz);
+        int stride_j = 6*tile_nz_;
+        int stride_i = stride_j*tile_ny_;
+        for (int iloc=-1 ; iloc<2 ; iloc++) {
+            for (int jloc=-1 ; jloc<2 ; jloc++) {
+                for (int kloc=-1 ; kloc<2 ; kloc++) {
+                    interp_res += *(coeffx+iloc) * *(coeffy+jloc) * *(coeffz+kloc) * f[iloc*stride_i+jloc*stride_j+6*kloc];
+                }
+            }
+        }
+        return interp_res;
+    };
+
 private:
+    //! Computes the interpolation coefficients and the central indexes for the particle ipart
+    void coefficients(Particles &particles, int ipart);
+
     // Last prim index computed
     int ip_, jp_, kp_;
     // Last dual index computed
@@ -36,19 +36,10 @@ Interpolator3D4Order::Interpolator3D4Order(Params &params, Patch *patch) : Inter
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
-// 2nd Order Interpolation of the fields at a the particle position (3 nodes are used)
+// Coefficients of the interpolation and indexes of the central nodes, for the particle ipart
 // ---------------------------------------------------------------------------------------------------------------------
-void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particles, int ipart, int nparts, double* ELoc, double* BLoc)
+void Interpolator3D4Order::coefficients(Particles &particles, int ipart)
 {
-    // Static cast of the electromagnetic fields
-    Field3D* Ex3D = static_cast<Field3D*>(EMfields->Ex_);
-    Field3D* Ey3D = static_cast<Field3D*>(EMfields->Ey_);
-    Field3D* Ez3D = static_cast<Field3D*>(EMfields->Ez_);
-    Field3D* Bx3D = static_cast<Field3D*>(EMfields->Bx_m);
-    Field3D* By3D = static_cast<Field3D*>(EMfields->By_m);
-    Field3D* Bz3D = static_cast<Field3D*>(EMfields->Bz_m);
-
-
     // Normalized particle position
     double xpn = particles.position(0, ipart)*dx_inv_;
     double ypn = particles.position(1, ipart)*dy_inv_;
@@ -136,6 +127,22 @@ void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particl
     jd_ = jd_ - j_domain_begin;
     kp_ = kp_ - k_domain_begin;
     kd_ = kd_ - k_domain_begin;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the fields at a the particle position (3 nodes are used)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particles, int ipart, int nparts, double* ELoc, double* BLoc)
+{
+    // Static cast of the electromagnetic fields
+    Field3D* Ex3D = static_cast<Field3D*>(EMfields->Ex_);
+    Field3D* Ey3D = static_cast<Field3D*>(EMfields->Ey_);
+    Field3D* Ez3D = static_cast<Field3D*>(EMfields->Ez_);
+    Field3D* Bx3D = static_cast<Field3D*>(EMfields->Bx_m);
+    Field3D* By3D = static_cast<Field3D*>(EMfields->By_m);
+    Field3D* Bz3D = static_cast<Field3D*>(EMfields->Bz_m);
+
+    coefficients(particles, ipart);
     
     // -------------------------
     // Interpolation of Ex^(d,p,p)
@@ -337,11 +344,20 @@ void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particl
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
 
+    // Stage the fields around the particles of the bin
+    stageFields(EMfields, particles, *istart, *iend, 2, smpi->dynamics_fieldtile[ithread]);
+
     //Loop on bin particles
     int nparts( particles.size() );
     for (int ipart=*istart ; ipart<*iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, nparts, &(*Epart)[ipart], &(*Bpart)[ipart]);
+        //Interpolation on current particle, from the staged fields
+        coefficients(particles, ipart);
+        (*Epart)[ipart+0*nparts] = computeTile( &coeffxd_[2], &coeffyp_[2], &coeffzp_[2], 0, id_, jp_, kp_);
+        (*Epart)[ipart+1*nparts] = computeTile( &coeffxp_[2], &coeffyd_[2], &coeffzp_[2], 1, ip_, jd_, kp_);
+        (*Epart)[ipart+2*nparts] = computeTile( &coeffxp_[2], &coeffyp_[2], &coeffzd_[2], 2, ip_, jp_, kd_);
+        (*Bpart)[ipart+0*nparts] = computeTile( &coeffxp_[2], &coeffyd_[2], &coeffzd_[2], 3, ip_, jd_, kd_);
+        (*Bpart)[ipart+1*nparts] = computeTile( &coeffxd_[2], &coeffyp_[2], &coeffzd_[2], 4, id_, jp_, kd_);
+        (*Bpart)[ipart+2*nparts] = computeTile( &coeffxd_[2], &coeffyd_[2], &coeffzp_[2], 5, id_, jd_, kp_);
         //Buffering of iol and delta
         (*iold)[ipart+0*nparts]  = ip_;
         (*iold)[ipart+1*nparts]  = jp_;
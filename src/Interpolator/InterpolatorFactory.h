@@ -20,6 +20,10 @@
 
 #include "Tools.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 class InterpolatorFactory {
 public:
     static Interpolator* create(Params& params, Patch *patch) {
@@ -68,6 +72,18 @@ public:
         return Interp;
     }
 
+    //! One interpolator per OpenMP thread, for the bins of a patch processed by several threads at the same time
+    static std::vector<Interpolator*> createPerThread(Params& params, Patch *patch) {
+#ifdef _OPENMP
+        std::vector<Interpolator*> Interps( omp_get_max_threads() );
+#else
+        std::vector<Interpolator*> Interps( 1 );
+#endif
+        for ( unsigned int ithread=0 ; ithread<Interps.size() ; ithread++ )
+            Interps[ithread] = create(params, patch);
+        return Interps;
+    }
+
 };
 
 #endif
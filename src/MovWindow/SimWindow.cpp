@@ -174,6 +174,7 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
             mypatch->EMfields->emBoundCond[0]->disableExternalFields();
 
         mypatch->finalizeMPIenvironment(params);
+        mypatch->updateParticleNeighbors(vecPatches.domain_decomposition_, smpi);
         //Position new patch
         vecPatches.patches_[patch_to_be_created[my_thread][j]] = mypatch ;
         //Receive Patch if necessary
@@ -217,6 +218,7 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
         }
 
         mypatch->updateTagenv(smpi);
+        mypatch->updateParticleNeighbors(vecPatches.domain_decomposition_, smpi);
         if ( mypatch->isXmin() ){
             for (unsigned int ispec=0 ; ispec<nSpecies ; ispec++)
                 mypatch->vecSpecies[ispec]->setXminBoundaryCondition();
@@ -453,8 +453,12 @@ void MultiphotonBreitWheelerTables::compute_T_table(SmileiMPI *smpi)
         // Get the number of ranks
         nb_ranks = smpi->getSize();
 
-        // Allocation of the array T_table
-        T_table.resize(T_dim);
+        // Allocation of the array T_table on the master MPI process,
+        // it is gathered on this process and then shared in each node
+        if (rank==0)
+        {
+            T_table.resize(T_dim);
+        }
 
         // Allocation of the table for load repartition
         imin_table = new int[nb_ranks];
@@ -510,9 +514,12 @@ void MultiphotonBreitWheelerTables::compute_T_table(SmileiMPI *smpi)
         }
 
         // Communication of the data
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &T_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        T_table.share(smpi);
 
         // flag computed at true
         T_computed = true;
@@ -585,11 +592,13 @@ void MultiphotonBreitWheelerTables::compute_xip_table(SmileiMPI *smpi)
         // Get the number of ranks
         nb_ranks = smpi->getSize();
 
-        // Allocation of the array xip_chiphmin_table
-        xip_chipamin_table.resize(xip_chiph_dim);
-
-        // Allocation of the array xip_table
-        xip_table.resize(xip_chipa_dim*xip_chiph_dim);
+        // Allocation of the arrays xip_chipamin_table and xip_table on the master MPI process,
+        // they are gathered on this process and then shared in each node
+        if (rank==0)
+        {
+            xip_chipamin_table.resize(xip_chiph_dim);
+            xip_table.resize(xip_chipa_dim*xip_chiph_dim);
+        }
 
         // Allocation of the table for load repartition
         imin_table = new int[nb_ranks];
@@ -680,9 +689,12 @@ void MultiphotonBreitWheelerTables::compute_xip_table(SmileiMPI *smpi)
         }
 
         // Communication of the xip_chipamin table
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &xip_chipamin_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        xip_chipamin_table.share(smpi);
 
         // _______________________________________________________________
         // 2. - Computation of the xip table
@@ -769,9 +781,12 @@ void MultiphotonBreitWheelerTables::compute_xip_table(SmileiMPI *smpi)
         }
 
         // Communication of the xip table
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &xip_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        xip_table.share(smpi);
 
         // flag computed at true
         xip_computed = true;
@@ -1376,9 +1391,6 @@ void MultiphotonBreitWheelerTables::bcast_T_table(SmileiMPI *smpi)
         buf_size = position;
         MPI_Pack_size(2, MPI_DOUBLE, smpi->getGlobalComm(), &position);
         buf_size += position;
-        MPI_Pack_size(T_dim, MPI_DOUBLE, smpi->getGlobalComm(),
-                      &position);
-        buf_size += position;
     }
 
     MESSAGE("            Buffer size: " << buf_size);
@@ -1399,15 +1411,14 @@ void MultiphotonBreitWheelerTables::bcast_T_table(SmileiMPI *smpi)
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
         MPI_Pack(&T_chiph_max,
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&T_table[0],T_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
     }
 
     // Bcast all parameters
     MPI_Bcast(&buffer[0], buf_size, MPI_PACKED, 0,smpi->getGlobalComm());
 
+    // Share the table in the memory of each node
+    T_table.share(smpi);
+
     // Other ranks unpack
     if (smpi->getRank() != 0)
     {
@@ -1418,13 +1429,6 @@ void MultiphotonBreitWheelerTables::bcast_T_table(SmileiMPI *smpi)
                    &T_chiph_min, 1, MPI_DOUBLE,smpi->getGlobalComm());
         MPI_Unpack(buffer, buf_size, &position,
                    &T_chiph_max, 1, MPI_DOUBLE,smpi->getGlobalComm());
-
-        // Resize table before unpacking values
-        T_table.resize(T_dim);
-
-        MPI_Unpack(buffer, buf_size, &position,&T_table[0],
-                    T_dim, MPI_DOUBLE,smpi->getGlobalComm());
-
     }
 
     T_log10_chiph_min = log10(T_chiph_min);
@@ -1461,12 +1465,6 @@ void MultiphotonBreitWheelerTables::bcast_xip_table(SmileiMPI *smpi)
         buf_size = position;
         MPI_Pack_size(2, MPI_DOUBLE, smpi->getGlobalComm(), &position);
         buf_size += position;
-        MPI_Pack_size(xip_chiph_dim, MPI_DOUBLE, smpi->getGlobalComm(),
-                      &position);
-        buf_size += position;
-        MPI_Pack_size(xip_chiph_dim*xip_chipa_dim, MPI_DOUBLE,
-                      smpi->getGlobalComm(), &position);
-        buf_size += position;
     }
 
     MESSAGE("            Buffer size for MPI exchange: " << buf_size);
@@ -1489,17 +1487,15 @@ void MultiphotonBreitWheelerTables::bcast_xip_table(SmileiMPI *smpi)
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
         MPI_Pack(&xip_chiph_max,
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&xip_chipamin_table[0],xip_chiph_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&xip_table[0],xip_chipa_dim*xip_chiph_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
     }
 
     // Bcast all parameters
     MPI_Bcast(&buffer[0], buf_size, MPI_PACKED, 0,smpi->getGlobalComm());
 
+    // Share the tables in the memory of each node
+    xip_chipamin_table.share(smpi);
+    xip_table.share(smpi);
+
     // Other ranks unpack
     if (smpi->getRank() != 0)
     {
@@ -1512,16 +1508,6 @@ void MultiphotonBreitWheelerTables::bcast_xip_table(SmileiMPI *smpi)
                    &xip_chiph_min, 1, MPI_DOUBLE,smpi->getGlobalComm());
         MPI_Unpack(buffer, buf_size, &position,
                    &xip_chiph_max, 1, MPI_DOUBLE,smpi->getGlobalComm());
-
-        // Resize tables before unpacking values
-        xip_chipamin_table.resize(xip_chiph_dim);
-        xip_table.resize(xip_chipa_dim*xip_chiph_dim);
-
-        MPI_Unpack(buffer, buf_size, &position,&xip_chipamin_table[0],
-                    xip_chiph_dim, MPI_DOUBLE,smpi->getGlobalComm());
-
-        MPI_Unpack(buffer, buf_size, &position,&xip_table[0],
-            xip_chipa_dim*xip_chiph_dim, MPI_DOUBLE,smpi->getGlobalComm());
     }
 
     // Log10 of xip_chiph_min for efficiency
@@ -20,6 +20,7 @@
 
 #include "Params.h"
 #include "H5.h"
+#include "NodeSharedTable.h"
 #include "userFunctions.h"
 
 //------------------------------------------------------------------------------
@@ -163,7 +164,7 @@ class MultiphotonBreitWheelerTables
         // ---------------------------------------------
 
         //! Array containing tabulated values of the function T
-        std::vector<double > T_table;
+        NodeSharedTable T_table;
 
         //! Minimum boundary of the table T
         double T_chiph_min;
@@ -193,7 +194,7 @@ class MultiphotonBreitWheelerTables
         //! Table containing the chipa min values
         //! Under this value, electron kinetic energy of the pair is
         //! considered negligible
-        std::vector<double > xip_chipamin_table;
+        NodeSharedTable xip_chipamin_table;
 
         // ---------------------------------------------
         // Table xip
@@ -203,7 +204,7 @@ class MultiphotonBreitWheelerTables
         //! that gives gives the probability for a photon to decay into pair
         //! with an electron of energy in the range \f$[0, \chi_{e^-}]\f$
         //! This enables to compute the energy repartition between the electron and the positron
-        std::vector<double> xip_table;
+        NodeSharedTable xip_table;
 
         //! Minimum boundary for chiph in the table xip and xip_chipamin
         double xip_chiph_min;
@@ -96,6 +96,9 @@ OpenPMDparams::OpenPMDparams(Params& p):
             } else if( params->EM_BCs[i][j] == "buneman" ) {
                 fieldBoundary          .addString( "open" );
                 fieldBoundaryParameters.addString( "buneman");
+            } else if( params->EM_BCs[i][j] == "PML" ) {
+                fieldBoundary          .addString( "open" );
+                fieldBoundaryParameters.addString( "PML");
             } else {
                 ERROR(" impossible boundary condition ");
             }
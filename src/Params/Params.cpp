@@ -189,6 +189,7 @@ namelist("")
 
     // communication pattern initialized as partial B exchange
     full_B_exchange = false;
+    has_pml = false;
 
     // --------------
     // Stop & Restart
@@ -286,7 +287,12 @@ namelist("")
         if (EM_BCs[iDim][0] == "silver-muller" || EM_BCs[iDim][1] == "silver-muller"){
             open_boundaries = true;
         }
+        if (EM_BCs[iDim][0] == "PML" || EM_BCs[iDim][1] == "PML"){
+            has_pml = true;
+            open_boundaries = true;
+        }
     }
+    PyTools::extract("number_of_pml_cells", number_of_pml_cells, "Main");
 
     PyTools::extract("EM_boundary_conditions_k", EM_BCs_k, "Main");
     if( EM_BCs_k.size() == 0 ) {
@@ -330,6 +336,9 @@ namelist("")
     PyTools::extract("solve_poisson", solve_poisson, "Main");
     PyTools::extract("poisson_max_iteration", poisson_max_iteration, "Main");
     PyTools::extract("poisson_max_error", poisson_max_error, "Main");
+    PyTools::extract("poisson_solver", poisson_solver, "Main");
+    if ( poisson_solver != "CG" && poisson_solver != "multigrid_CG" && poisson_solver != "multigrid" && poisson_solver != "FFT" )
+        ERROR("poisson_solver must be `CG`, `multigrid_CG`, `multigrid` or `FFT`");
     // Relativistic Poisson Solver
     PyTools::extract("solve_relativistic_poisson", solve_relativistic_poisson, "Main");
     PyTools::extract("relativistic_poisson_max_iteration", relativistic_poisson_max_iteration, "Main");
@@ -340,6 +349,20 @@ namelist("")
     if (is_spectral)
         full_B_exchange=true;
     PyTools::extract("is_pxr", is_pxr, "Main");
+#ifdef _PICSAR
+    uncoupled_grids = true;
+#else
+    if (is_pxr)
+        ERROR("is_pxr requires Smilei to be compiled with PICSAR=TRUE");
+    uncoupled_grids = is_spectral;
+#endif
+    if ( is_spectral && !is_pxr ) {
+#ifndef _FFTW
+        ERROR("is_spectral requires Smilei to be compiled with FFTW=TRUE (or PICSAR=TRUE with is_pxr)");
+#endif
+        if ( geometry != "2Dcartesian" && geometry != "3Dcartesian" )
+            ERROR("is_spectral is only available in 2Dcartesian and 3Dcartesian geometries");
+    }
 
     // Maxwell Solver
     PyTools::extract("maxwell_solver", maxwell_sol, "Main");
@@ -377,6 +400,17 @@ namelist("")
     }
 
 
+    if ( has_pml ) {
+        if ( geometry != "2Dcartesian" && geometry != "3Dcartesian" )
+            ERROR("PML boundary conditions are only available in 2Dcartesian and 3Dcartesian geometries");
+        if ( maxwell_sol != "Yee" || is_spectral || Friedman_filter )
+            ERROR("PML boundary conditions require the Yee solver (without FieldFilter)");
+        if ( number_of_pml_cells == 0 )
+            ERROR("number_of_pml_cells must be positive");
+        if ( PyTools::nComponents("MovingWindow") && ( EM_BCs[0][0] == "PML" || EM_BCs[0][1] == "PML" ) )
+            ERROR("PML boundary conditions along x are not compatible with a moving window");
+    }
+
     // testing the CFL condition
     //!\todo (MG) CFL cond. depends on the Maxwell solv. ==> HERE JUST DONE FOR YEE!!!
     double res_space2=0;
@@ -393,6 +427,15 @@ namelist("")
     // clrw
     PyTools::extract("clrw",clrw, "Main");
 
+    // bins processed as OpenMP tasks
+    PyTools::extract("cluster_tasks",cluster_tasks, "Main");
+
+    // aggregated messages sent by each thread
+    PyTools::extract("hybrid_communication",hybrid_communication, "Main");
+
+    // fields of the patches of each MPI process in one grid
+    PyTools::extract("supergrid",supergrid, "Main");
+
 
 
     // --------------------
@@ -420,9 +463,31 @@ namelist("")
 
     global_factor.resize( nDim_field, 1 );
     PyTools::extract( "global_factor", global_factor, "Main" );
+    if ( uncoupled_grids ) {
+        // The Domain gathers all the patches of an MPI process
+        unsigned int nblocks(1);
+        for ( unsigned int iDim=0 ; iDim<nDim_field ; iDim++ ) {
+            if ( number_of_patches[iDim] % global_factor[iDim] != 0 )
+                ERROR("global_factor["<<iDim<<"] must divide number_of_patches["<<iDim<<"]");
+            nblocks *= number_of_patches[iDim] / global_factor[iDim];
+        }
+        if ( nblocks != (unsigned int)(smpi->getSize()) )
+            ERROR("The number of blocks of global_factor patches ("<<nblocks<<") must be equal to the number of MPI processes");
+    }
     norder.resize(nDim_field,1);
     norder.resize(nDim_field,1);
-    PyTools::extract( "norder", norder, "Main" );
+    bool has_norder = PyTools::extract( "norder", norder, "Main" );
+    // PSATD solver : derivatives of the staggered finite differences of order norder (see PSATD_Solver),
+    // whose stencil must fit in the ghost cells (norder/2+1, see oversize)
+    if ( is_spectral && !is_pxr ) {
+        if ( !has_norder )
+            norder.assign( nDim_field, 16 );
+        if ( norder.size() != nDim_field )
+            ERROR("norder must have " << nDim_field << " elements with is_spectral");
+        for ( unsigned int iDim=0 ; iDim<nDim_field ; iDim++ )
+            if ( norder[iDim] < 2 || norder[iDim]%2 != 0 )
+                ERROR("norder["<<iDim<<"] must be an even number, at least 2, with is_spectral");
+    }
     //norderx=norder[0];
     //nordery=norder[1];
     //norderz=norder[2];
@@ -460,6 +525,55 @@ namelist("")
 
     has_load_balancing = (smpi->getSize()>1)  && (! load_balancing_time_selection->isEmpty());
 
+    // Grid of the patches of each MPI process : fields solved in place by the finite differences solvers only, patches
+    // never moved or exchanged
+    if ( supergrid ) {
+        if ( geometry != "1Dcartesian" && geometry != "2Dcartesian" && geometry != "3Dcartesian" )
+            ERROR("supergrid is not available in geometry " << geometry);
+        if ( is_spectral )
+            ERROR("supergrid is not compatible with is_spectral");
+        if ( uncoupled_grids )
+            ERROR("supergrid is not compatible with uncoupled_grids");
+        if ( maxwell_sol != "Yee" )
+            ERROR("supergrid requires maxwell_solver = `Yee`");
+        if ( full_B_exchange )
+            ERROR("supergrid is not compatible with the Buneman boundary conditions");
+        if ( has_pml )
+            ERROR("supergrid is not compatible with the PML boundary conditions");
+        if ( Friedman_filter )
+            ERROR("supergrid is not compatible with the Friedman filter");
+        if ( PyTools::nComponents("MovingWindow")>0 )
+            ERROR("supergrid is not compatible with the moving window");
+        if ( has_load_balancing )
+            ERROR("supergrid is not compatible with the load balancing");
+        if ( solve_relativistic_poisson )
+            ERROR("supergrid is not compatible with solve_relativistic_poisson");
+    }
+
+    // FFT Poisson solver : the patches of each MPI process are gathered in one block of the Domain,
+    // a slab along the first dimension for the cartesian decomposition
+    if ( solve_poisson && poisson_solver == "FFT" ) {
+#ifndef _FFTW
+        ERROR("poisson_solver = `FFT` requires Smilei to be compiled with FFTW=TRUE");
+#endif
+        if ( geometry == "3drz" )
+            ERROR("poisson_solver = `FFT` is not available in geometry " << geometry);
+        if ( patch_decomposition != "cartesian" || patch_orientation != "" )
+            ERROR("poisson_solver = `FFT` requires patch_decomposition = `cartesian` with the default patch_orientation");
+        if ( has_load_balancing && initial_balance )
+            ERROR("poisson_solver = `FFT` is not compatible with the initial load balancing");
+        if ( number_of_patches[0] % smpi->getSize() != 0 )
+            ERROR("poisson_solver = `FFT` : number_of_patches[0] must be a multiple of the number of MPI processes");
+        poisson_fft_factor = number_of_patches;
+        poisson_fft_factor[0] /= smpi->getSize();
+        unsigned int npatches_per_block(1);
+        for ( unsigned int iDim=0 ; iDim<nDim_field ; iDim++ )
+            npatches_per_block *= poisson_fft_factor[iDim];
+        double nppp_root = pow( npatches_per_block, 1./(double)nDim_field );
+        if ( fabs( (double)(int)( nppp_root+0.5 ) - nppp_root ) > 1.e-10 )
+            ERROR("poisson_solver = `FFT` : the number of patches per MPI process must be a power "<<nDim_field<<" of an integer");
+    }
+
 
     //mi.resize(nDim_field, 0);
     mi.resize(3, 0);
@@ -624,6 +738,9 @@ void Params::compute()
         n_space[i] /= number_of_patches[i];
         if(n_space_global[i]%number_of_patches[i] !=0) ERROR("ERROR in dimension " << i <<". Number of patches = " << number_of_patches[i] << " must divide n_space_global = " << n_space_global[i]);
         if ( n_space[i] <= 2*oversize[i]+1 ) ERROR ( "ERROR in dimension " << i <<". Patches length = "<<n_space[i] << " cells must be at least " << 2*oversize[i] +2 << " cells long. Increase number of cells or reduce number of patches in this direction. " );
+        // The PML must lie in the boundary patches, beyond the ghost cells of their neighbours
+        if ( ( EM_BCs[i][0] == "PML" || EM_BCs[i][1] == "PML" ) && ( number_of_pml_cells+oversize[i]+1 > n_space[i] ) )
+            ERROR("ERROR in dimension " << i <<". Patches length = "<<n_space[i] << " cells must be at least " << number_of_pml_cells+oversize[i]+1 << " cells long with " << number_of_pml_cells << " PML cells. Increase number of cells or reduce number of patches in this direction. ");
         patch_dimensions[i] = n_space[i] * cell_length[i];
         n_cell_per_patch *= n_space[i];
     }
@@ -847,7 +964,34 @@ void Params::runScript(string command, string name, PyObject * scope) {
     PyTools::checkPyError();
     namelist+=command;
     if (name.size()>0)  MESSAGE(1,"Parsing " << name);
-    PyObject* result = PyRun_String(command.c_str(), Py_file_input, scope, scope);
+    // The source is registered in python's line cache, so that the functions it defines can be
+    // inspected (tracebacks, compilation of the profiles)
+    string filename = name.size()>0 ? name : "<string>";
+    PyObject* linecache = PyImport_ImportModule("linecache");
+    PyObject* cache = linecache ? PyObject_GetAttrString(linecache, "cache") : NULL;
+    if (cache) {
+        PyObject* source = Py_BuildValue("s", command.c_str());
+        PyObject* lines = PyObject_CallMethod(source, const_cast<char *>("splitlines"), const_cast<char *>("(i)"), 1);
+        PyObject* entry = Py_BuildValue("(nOOs)", (Py_ssize_t)command.size(), Py_None, lines, filename.c_str());
+        PyDict_SetItemString(cache, filename.c_str(), entry);
+        Py_XDECREF(entry);
+        Py_XDECREF(lines);
+        Py_XDECREF(source);
+    }
+    Py_XDECREF(cache);
+    Py_XDECREF(linecache);
+    PyTools::checkPyError();
+    PyObject* code = Py_CompileString(command.c_str(), filename.c_str(), Py_file_input);
+    PyTools::checkPyError();
+    if (!code) {
+        ERROR("error parsing "<< name);
+    }
+#if PY_MAJOR_VERSION == 2
+    PyObject* result = PyEval_EvalCode((PyCodeObject*)code, scope, scope);
+#else
+    PyObject* result = PyEval_EvalCode(code, scope, scope);
+#endif
+    Py_DECREF(code);
     PyTools::checkPyError();
     if (!result) {
         ERROR("error parsing "<< name);
@@ -120,6 +120,10 @@ public:
     //! Are open boundaries used ?
     bool open_boundaries;
     bool save_magnectic_fields_for_SM;
+    //! Are PML (absorbing layers) used ?
+    bool has_pml;
+    //! Number of cells of the PML, inside the simulation box
+    unsigned int number_of_pml_cells;
     
     //Poisson solver
     //! Do we solve poisson
@@ -128,6 +132,10 @@ public:
     unsigned int poisson_max_iteration;
     //! Maxium poisson error tolerated
     double poisson_max_error;
+    //! Poisson solver : CG, multigrid_CG (multigrid preconditioned CG), multigrid (standalone multigrid) or FFT
+    std::string poisson_solver;
+    //! FFT Poisson solver : patches gathered per MPI process in the Domain (global_factor of this Domain)
+    std::vector<unsigned int> poisson_fft_factor;
 
     //"Relativistic" Poisson solver
     //! Do we solve "relativistic poisson problem" for relativistic species
@@ -155,6 +163,14 @@ public:
     //! Clusters width
     //unsigned int clrw;
     int clrw;
+
+    //! Particles of the bins processed as OpenMP tasks, projecting on private tiles (see Species::dynamicsTasks)
+    bool cluster_tasks;
+
+    //! Aggregated MPI messages of the fields split in 1 partition per thread, sent as soon as packed (see AggregatedMPIbuffers)
+    bool hybrid_communication;
+    //! E and B of the patches of each MPI process stacked along X in one grid, solved at once (see SuperGrid)
+    bool supergrid;
     //! Number of cells per cluster
     int n_cell_per_patch;
 
@@ -260,6 +276,8 @@ public:
     std::vector<unsigned int> global_factor;
     bool  is_spectral=false ;
     bool  is_pxr=false ;
+    //! Maxwell's equations solved on the Domain (one block of patches per MPI process) instead of the patches
+    bool  uncoupled_grids=false ;
     int   norderx = 2; 
     int   nordery = 2; 
     int   norderz = 2;
@@ -14,23 +14,26 @@
 #include "SimWindow.h"
 #include "Timers.h"
 #include "SyncCartesianPatch.h"
+#include "PoissonFFT.h"
 
-Domain::Domain( Params &params ) :
+Domain::Domain( Params &params, std::vector<unsigned int> global_factor ) :
     vecPatch_( params ),
     decomposition_(NULL),
     patch_(NULL),
-    diag_(NULL)
+    diag_(NULL),
+    global_factor_( global_factor )
 {
 }
 
 void Domain::build( Params &params, SmileiMPI* smpi, VectorPatch& vecPatches, OpenPMDparams& openPMD )
 {
-    decomposition_ = DomainDecompositionFactory::createGlobal( params );
+    decomposition_ = DomainDecompositionFactory::createGlobal( params, global_factor_ );
     patch_ = PatchesFactory::create( params, smpi, decomposition_, vecPatches.refHindex_ / vecPatches.size() );
     patch_->set( params, decomposition_, vecPatches );
     vecPatch_.patches_.push_back( patch_ );
 
     vecPatch_.refHindex_ = vecPatches.refHindex_ / vecPatches.size();
+    vecPatch_.updateNeighborsComm( smpi );
     vecPatch_.update_field_list();
 
     //vecPatch_.update_field_list(0);
@@ -94,6 +97,11 @@ void Domain::clean()
     }
     if (patch_!=NULL) delete patch_;
     if (decomposition_ !=NULL) delete decomposition_;
+    diag_ = NULL;
+    patch_ = NULL;
+    decomposition_ = NULL;
+    vecPatch_.patches_.clear();
+    vecPatch_.freeNeighborsComm();
 
 }
 
@@ -103,3 +111,13 @@ void Domain::solveMaxwell( Params& params, SimWindow* simWindow, int itime, doub
 
 }
 
+void Domain::solvePoisson( Params& params, SmileiMPI* smpi, VectorPatch& vecPatches )
+{
+    SyncCartesianPatch::patchedToCartesianRho( vecPatches, *this, params, smpi );
+
+    PoissonFFT poisson( params, smpi, patch_ );
+    poisson.solve( patch_->EMfields->rho_, patch_->EMfields->rho_ );
+
+    SyncCartesianPatch::cartesianToPatchesPhi( *this, vecPatches, params, smpi );
+
+}
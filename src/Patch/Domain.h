@@ -14,16 +14,20 @@ class Timers;
 class Domain
 {
 public:
-    Domain( Params& params );
+    //! Domain gathering global_factor patches along each dimension
+    Domain( Params& params, std::vector<unsigned int> global_factor );
     ~Domain();
 
     void build( Params& params, SmileiMPI* smpi, VectorPatch& vecPatches, OpenPMDparams& openPMD );
     void solveMaxwell( Params& params, SimWindow* simWindow, int itime, double time_dual, Timers& timers );
+    //! Solve the Poisson equation with FFTs on the Domain, the potential is set in phi_ of vecPatches
+    void solvePoisson( Params& params, SmileiMPI* smpi, VectorPatch& vecPatches );
     void clean();
     VectorPatch vecPatch_;
     DomainDecomposition* decomposition_;
     Patch* patch_;
     Diagnostic* diag_; 
+    std::vector<unsigned int> global_factor_;
    
 };
 
@@ -22,8 +22,11 @@
 #include <cstdlib>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 #include "Hilbert_functions.h"
+#include "DomainDecomposition.h"
+#include "GlobalDomainDecomposition.h"
 #include "PatchesFactory.h"
 #include "SpeciesFactory.h"
 #include "Particles.h"
@@ -65,6 +68,8 @@ Patch::Patch(Patch* patch, Params& params, SmileiMPI* smpi, DomainDecomposition*
 
 void Patch::initStep1(Params& params)
 {
+    is_empty = false;
+
     // for nDim_fields = 1 : bug if Pcoordinates.size = 1 !!
     //Pcoordinates.resize(nDim_fields_);
     Pcoordinates.resize( 2 );
@@ -90,6 +95,8 @@ void Patch::initStep1(Params& params)
     oversize.resize( nDim_fields_ );
     for ( int iDim = 0 ; iDim < nDim_fields_; iDim++ )
         oversize[iDim] = params.oversize[iDim];
+
+    n_space = params.n_space;
 }
 
 
@@ -129,6 +136,8 @@ void Patch::finishCreation( Params& params, SmileiMPI* smpi, DomainDecomposition
     
     // interpolation operator (virtual)
     Interp     = InterpolatorFactory::create(params, this); // + patchId -> idx_domain_begin (now = ref smpi)
+    if ( params.cluster_tasks )
+        Interp_threads = InterpolatorFactory::createPerThread(params, this);
     // projection operator (virtual)
     Proj       = ProjectorFactory::create(params, this);    // + patchId -> idx_domain_begin (now = ref smpi)
 
@@ -156,6 +165,8 @@ void Patch::finishCloning( Patch* patch, Params& params, SmileiMPI* smpi, bool w
 
     // interpolation operator (virtual)
     Interp     = InterpolatorFactory::create(params, this);
+    if ( params.cluster_tasks )
+        Interp_threads = InterpolatorFactory::createPerThread(params, this);
     // projection operator (virtual)
     Proj       = ProjectorFactory::create(params, this);
 
@@ -196,7 +207,6 @@ void Patch::finalizeMPIenvironment(Params& params) {
     for( unsigned int idiag=0; idiag<EMfields->allFields_avg.size(); idiag++) {
         nb_comms += EMfields->allFields_avg[idiag].size();
     }
-    nb_comms += EMfields->antennas.size();
 
     for (unsigned int bcId=0 ; bcId<EMfields->emBoundCond.size() ; bcId++ ) {
         if(EMfields->emBoundCond[bcId]) {
@@ -204,6 +214,9 @@ void Patch::finalizeMPIenvironment(Params& params) {
                 nb_comms += 4;
             }
         }
+        // Auxiliary fields of the PML : the same number of requests for all patches (tags are shifted by patch)
+        if ( params.EM_BCs[bcId/2][bcId%2] == "PML" )
+            nb_comms += 4;
         if ( EMfields->extFields.size()>0 ) {
             if (dynamic_cast<ElectroMagnBC1D_SM*>(EMfields->emBoundCond[bcId]) )
                 nb_comms += 4;
@@ -221,7 +234,9 @@ void Patch::finalizeMPIenvironment(Params& params) {
 void Patch::set( Params& params, DomainDecomposition* domain_decomposition, VectorPatch& vecPatch )
 {
     Pcoordinates.resize( params.nDim_field );
-    
+    GlobalDomainDecomposition* global = static_cast<GlobalDomainDecomposition*>( domain_decomposition );
+    for ( unsigned int i = 0 ; i<params.nDim_field ; i++ )
+        n_space[i] = params.n_space[i] * global->global_factor_[i];
 
     min_local = vecPatch(0)->min_local;
     max_local = vecPatch(0)->max_local;
@@ -254,7 +269,7 @@ void Patch::set( Params& params, DomainDecomposition* domain_decomposition, Vect
             if ( vecPatch(ipatch)->cell_starting_global_index[i] <= cell_starting_global_index[i] )
                 cell_starting_global_index[i] = vecPatch(ipatch)->cell_starting_global_index[i];
         }
-        Pcoordinates[i] = (cell_starting_global_index[i]+params.oversize[i]) / params.n_space[i] / params.global_factor[i];
+        Pcoordinates[i] = (cell_starting_global_index[i]+params.oversize[i]) / n_space[i];
         
         center[i] = (min_local[i]+max_local[i])*0.5;
         radius += pow(max_local[i] - center[i] + params.cell_length[i], 2);
@@ -319,6 +334,7 @@ Patch::~Patch() {
     if (partWalls!=NULL) delete partWalls;
     if (Proj     !=NULL) delete Proj;
     if (Interp   !=NULL) delete Interp;
+    for (unsigned int i=0; i<Interp_threads.size(); i++) delete Interp_threads[i];
     
     if (EMfields !=NULL) delete EMfields;
 
@@ -378,127 +394,172 @@ void Patch::updateMPIenv(SmileiMPI* smpi)
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Split particles Id to send in per direction and per patch neighbor dedicated buffers
-// Apply periodicity if necessary
+// Compute Hilbert index and MPI rank of the 3^ndim patches around the current one (faces, edges and corners)
+//   - the coordinate along iDim of a neighbor is the one of neighbor_[iDim] (periodicity already applied)
+//   - to call when patches are created, exchanged (load balancing) or moved (moving window)
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::updateParticleNeighbors(DomainDecomposition* domain_decomposition, SmileiMPI* smpi)
+{
+    int nneighbors = 1;
+    for (int iDim=0 ; iDim<nDim_fields_ ; iDim++)
+        nneighbors *= 3;
+    particle_neighbor_.resize(nneighbors);
+    MPI_particle_neighbor_.resize(nneighbors);
+
+    // Coordinates along iDim of the patches at -1, 0, +1
+    std::vector<unsigned int> coords = domain_decomposition->getDomainCoordinates( hindex );
+    std::vector< std::vector<int> > xneighbor( nDim_fields_, std::vector<int>(3,0) );
+    for (int iDim=0 ; iDim<nDim_fields_ ; iDim++) {
+        xneighbor[iDim][1] = coords[iDim];
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++)
+            if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL)
+                xneighbor[iDim][2*iNeighbor] = domain_decomposition->getDomainCoordinates( neighbor_[iDim][iNeighbor] )[iDim];
+    }
+
+    std::vector<int> xcall( nDim_fields_, 0 );
+    for (int ineighbor=0 ; ineighbor<nneighbors ; ineighbor++) {
+        bool exists = true;
+        int stride = 1;
+        for (int iDim=0 ; iDim<nDim_fields_ ; iDim++) {
+            int ix = (ineighbor/stride)%3;
+            if ( (ix!=1) && (neighbor_[iDim][ix/2]==MPI_PROC_NULL) )
+                exists = false;
+            xcall[iDim] = xneighbor[iDim][ix];
+            stride *= 3;
+        }
+        if (exists) {
+            particle_neighbor_[ineighbor] = domain_decomposition->getDomainId( xcall );
+            MPI_particle_neighbor_[ineighbor] = smpi->hrank( particle_neighbor_[ineighbor] );
+        }
+        else {
+            particle_neighbor_[ineighbor] = MPI_PROC_NULL;
+            MPI_particle_neighbor_[ineighbor] = MPI_PROC_NULL;
+        }
+    }
+
+} // END updateParticleNeighbors
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split particles Id to send in per patch neighbor (faces, edges and corners) dedicated buffers
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::initExchParticles(SmileiMPI* smpi, int ispec, Params& params)
 {
     Particles &cuParticles = (*vecSpecies[ispec]->particles);
     int ndim = params.nDim_field;
-    int idim,check;
+    int ineighbor, stride;
     std::vector<int>* indexes_of_particles_to_exchange = &vecSpecies[ispec]->indexes_of_particles_to_exchange;
-//    double xmax[3];
 
     for (int iDim=0 ; iDim < ndim ; iDim++){
         for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
             vecSpecies[ispec]->MPIbuff.partRecv[iDim][iNeighbor].clear();//resize(0,ndim);
-            vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor].clear();//resize(0,ndim);
-            vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor].resize(0);
             vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][iNeighbor] = 0;
         }
     }
+    int nneighbors = particle_neighbor_.size();
+    for (ineighbor=0 ; ineighbor<nneighbors ; ineighbor++) {
+        vecSpecies[ispec]->MPIbuff.partNeighborRecv[ineighbor].clear();
+        vecSpecies[ispec]->MPIbuff.part_index_neighbor_send[ineighbor].resize(0);
+        vecSpecies[ispec]->MPIbuff.part_neighbor_recv_sz[ineighbor] = 0;
+    }
 
     int n_part_send = (*indexes_of_particles_to_exchange).size();
 
     int iPart;
 
     // Define where particles are going
-    //Put particles in the send buffer it belongs to. Priority to lower dimensions.
+    //Put particles in the send buffer of the patch they arrive in, whatever the number of borders crossed.
     for (int i=0 ; i<n_part_send ; i++) {
         iPart = (*indexes_of_particles_to_exchange)[i];
-        check = 0;
-        idim = 0;
-        //Put indexes of particles in the first direction they will be exchanged and correct their position according to periodicity for the first exchange only.
-        while (check == 0 && idim<ndim){
-            if ( cuParticles.position(idim,iPart) < min_local[idim]){
-                if ( neighbor_[idim][0]!=MPI_PROC_NULL) {
-                    vecSpecies[ispec]->MPIbuff.part_index_send[idim][0].push_back( iPart );
-                }
-                //If particle is outside of the global domain (has no neighbor), it will not be put in a send buffer and will simply be deleted.
-                check = 1;
+        ineighbor = 0;
+        stride = 1;
+        for (int idim=0 ; idim<ndim ; idim++) {
+            if ( cuParticles.position(idim,iPart) >= min_local[idim] ) {
+                ineighbor += stride;
+                if ( cuParticles.position(idim,iPart) >= max_local[idim] )
+                    ineighbor += stride;
             }
-            else if ( cuParticles.position(idim,iPart) >= max_local[idim]){
-                if( neighbor_[idim][1]!=MPI_PROC_NULL) {
-                    vecSpecies[ispec]->MPIbuff.part_index_send[idim][1].push_back( iPart );
-                }
-                check = 1;
-            }
-            idim++;
+            stride *= 3;
         }
+        //If particle is outside of the global domain (has no neighbor), it will not be put in a send buffer and will simply be deleted.
+        if ( ( ineighbor != nneighbors/2 ) && ( particle_neighbor_[ineighbor]!=MPI_PROC_NULL ) )
+            vecSpecies[ispec]->MPIbuff.part_index_neighbor_send[ineighbor].push_back( iPart );
     }
 
-
-
-} // initExchParticles(... iDim)
+} // initExchParticles
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// For direction iDim, start exchange of number of particles
+// Set the number of particles to send to all neighbors
 //   - vecPatch : used for intra-MPI process comm (direct copy using Particels::cp_particles)
 //   - smpi     : inhereted from previous SmileiMPI::exchangeParticles()
+//   - species  : species exchanged, the numbers of particles of all species are sent to MPI neighbors at once for all
+//                patches by VectorPatch::particlesCountsMPIaggr
+// Particles moving of o are sent to the neighbor o (ineighbor) and received from the neighbor -o (nneighbors-1-ineighbor)
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
+void Patch::initCommParticles(SmileiMPI* smpi, std::vector<unsigned int>& species, Params& params, VectorPatch * vecPatch)
 {
     int h0 = (*vecPatch)(0)->hindex;
+    int nneighbors = particle_neighbor_.size();
+    int nspecies = vecSpecies.size();
+    if ( particlesMPIbuff.send_sz.size() != (unsigned int)nneighbors )
+        particlesMPIbuff.allocate( nneighbors, nspecies );
+
     /********************************************************************************/
-    // Exchange number of particles to exchange to establish or not a communication
+    // Number of particles to exchange to establish or not a communication
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
-            vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor] = (vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor]).size();
-
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
-                //If neighbour is MPI ==> I send him the number of particles I'll send later.
-                int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
-                      MPI_Isend( &(vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor]), 1, MPI_INT, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
+    for (int ineighbor=0 ; ineighbor<nneighbors ; ineighbor++) {
+        if (ineighbor == nneighbors/2) continue;
+
+        if (particle_neighbor_[ineighbor]!=MPI_PROC_NULL) {
+            if (MPI_particle_neighbor_[ineighbor]!=MPI_me_) {
+                //If neighbour is MPI ==> I will send him the number of particles of each species I'll send later.
+                std::vector<int>& send_sz = particlesMPIbuff.send_sz[ineighbor];
+                std::fill( send_sz.begin(), send_sz.end(), 0 );
+                for (unsigned int i=0 ; i<species.size() ; i++)
+                    send_sz[species[i]] = (vecSpecies[species[i]]->MPIbuff.part_index_neighbor_send[ineighbor]).size();
             }
             else {
                 //Else, I directly set the receive size to the correct value.
-                (*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2] = vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor];
+                Patch* neighbor = (*vecPatch)( particle_neighbor_[ineighbor]- h0 );
+                for (unsigned int i=0 ; i<species.size() ; i++)
+                    neighbor->vecSpecies[species[i]]->MPIbuff.part_neighbor_recv_sz[ineighbor] = (vecSpecies[species[i]]->MPIbuff.part_index_neighbor_send[ineighbor]).size();
             }
         } // END of Send
+    }//end loop on neighbors.
 
-        if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
-                //If other neighbour is MPI ==> I receive the number of particles I'll receive later.
-                int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1, iNeighbor+3 );
-                MPI_Irecv( &(vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2]), 1, MPI_INT, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
-            }
-        }
-    }//end loop on nb_neighbors.
-
-} // initCommParticles(... iDim)
+} // initCommParticles
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// For direction iDim, finalize receive of number of particles and really send particles
+// Really send particles to all neighbors, once the numbers of particles are received
 //   - vecPatch : used for intra-MPI process comm (direct copy using Particels::cp_particles)
 //   - smpi     : used smpi->periods_
+//   - species  : species exchanged, packed one after the other in one message per MPI neighbor
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
+void Patch::CommParticles(SmileiMPI* smpi, std::vector<unsigned int>& species, Params& params, VectorPatch * vecPatch)
 {
-    Particles &cuParticles = (*vecSpecies[ispec]->particles);
+    int ndim = params.nDim_field;
 
     int n_part_send, n_part_recv;
     int h0 = (*vecPatch)(0)->hindex;
-    double x_max = params.cell_length[iDim]*( params.n_space_global[iDim] );
+    int nneighbors = particle_neighbor_.size();
 
     /********************************************************************************/
-    // Wait for end of communications over number of particles
+    // Numbers of particles received from MPI neighbors (VectorPatch::particlesCountsMPIaggr)
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        MPI_Status sstat    [2];
-        MPI_Status rstat    [2];
-        if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor))
-                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
-        }
-        if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2))  {
-                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
-                if (vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2]!=0) {
-                    //If I receive particles over MPI, I initialize my receive buffer with the appropriate size.
-                    vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2].initialize( vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2], cuParticles);
+    for (int ineighbor=0 ; ineighbor<nneighbors ; ineighbor++) {
+        if (ineighbor == nneighbors/2) continue;
+        int jneighbor = nneighbors-1-ineighbor;
+        if (particle_neighbor_[jneighbor]!=MPI_PROC_NULL) {
+            if (MPI_particle_neighbor_[jneighbor]!=MPI_me_) {
+                for (unsigned int i=0 ; i<species.size() ; i++) {
+                    SpeciesMPIbuffers& MPIbuff = vecSpecies[species[i]]->MPIbuff;
+                    MPIbuff.part_neighbor_recv_sz[ineighbor] = particlesMPIbuff.recv_sz[ineighbor][species[i]];
+                    if (MPIbuff.part_neighbor_recv_sz[ineighbor]!=0) {
+                        //If I receive particles over MPI, I initialize my receive buffer with the appropriate size.
+                        MPIbuff.partNeighborRecv[ineighbor].initialize( MPIbuff.part_neighbor_recv_sz[ineighbor], *vecSpecies[species[i]]->particles );
+                    }
                 }
             }
         }
@@ -507,152 +568,195 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
     // Proceed to effective Particles' communications
     /********************************************************************************/
 
-    // Number of properties per particles = nDim_Particles + 3 + 1 + 1
-
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-
-        // n_part_send : number of particles to send to current neighbor
-        n_part_send = (vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor]).size();
-        if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (n_part_send!=0) ) {
-            // Enabled periodicity
-            if (smpi->periods_[iDim]==1) {
-                for (int iPart=0 ; iPart<n_part_send ; iPart++) {
-                    if ( ( iNeighbor==0 ) &&  (Pcoordinates[iDim] == 0 ) &&( cuParticles.position(iDim,vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart]) < 0. ) ) {
-                        cuParticles.position(iDim,vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart])     += x_max;
-                    }
-                    else if ( ( iNeighbor==1 ) &&  (Pcoordinates[iDim] == params.number_of_patches[iDim]-1 ) && ( cuParticles.position(iDim,vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart]) >= x_max ) ) {
-                        cuParticles.position(iDim,vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart])     -= x_max;
+    for (int ineighbor=0 ; ineighbor<nneighbors ; ineighbor++) {
+        if (ineighbor == nneighbors/2) continue;
+
+        if (particle_neighbor_[ineighbor]!=MPI_PROC_NULL) {
+            int n_bytes = 0;
+            for (unsigned int i=0 ; i<species.size() ; i++) {
+                SpeciesMPIbuffers& MPIbuff = vecSpecies[species[i]]->MPIbuff;
+                Particles &cuParticles = (*vecSpecies[species[i]]->particles);
+
+                // n_part_send : number of particles to send to current neighbor
+                n_part_send = (MPIbuff.part_index_neighbor_send[ineighbor]).size();
+                if (n_part_send==0) continue;
+
+                // Enabled periodicity, in all the directions crossed
+                int stride = 1;
+                for (int iDim=0 ; iDim<ndim ; iDim++) {
+                    int iNeighbor = (ineighbor/stride)%3 - 1;
+                    stride *= 3;
+                    if ( (smpi->periods_[iDim]!=1) || (iNeighbor==0) ) continue;
+                    double x_max = params.cell_length[iDim]*( params.n_space_global[iDim] );
+                    for (int iPart=0 ; iPart<n_part_send ; iPart++) {
+                        if ( ( iNeighbor==-1 ) &&  (Pcoordinates[iDim] == 0 ) &&( cuParticles.position(iDim,MPIbuff.part_index_neighbor_send[ineighbor][iPart]) < 0. ) ) {
+                            cuParticles.position(iDim,MPIbuff.part_index_neighbor_send[ineighbor][iPart])     += x_max;
+                        }
+                        else if ( ( iNeighbor==1 ) &&  (Pcoordinates[iDim] == params.number_of_patches[iDim]-1 ) && ( cuParticles.position(iDim,MPIbuff.part_index_neighbor_send[ineighbor][iPart]) >= x_max ) ) {
+                            cuParticles.position(iDim,MPIbuff.part_index_neighbor_send[ineighbor][iPart])     -= x_max;
+                        }
                     }
                 }
+                if (MPI_particle_neighbor_[ineighbor]!=MPI_me_) {
+                    n_bytes += cuParticles.packedBytes( n_part_send );
+                }
+                else {
+                    //If not MPI comm, copy particles directly in the receive buffer
+                    for (int iPart=0 ; iPart<n_part_send ; iPart++)
+                        cuParticles.cp_particle( MPIbuff.part_index_neighbor_send[ineighbor][iPart],((*vecPatch)( particle_neighbor_[ineighbor]- h0 )->vecSpecies[species[i]]->MPIbuff.partNeighborRecv[ineighbor]) );
+                }
             }
-            // Send particles
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
-                // If MPI comm, first copy particles in the sendbuffer
-                for (int iPart=0 ; iPart<n_part_send ; iPart++)
-                    cuParticles.cp_particle(vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart], vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]);
+
+            // Send particles of all species at once
+            if ( (MPI_particle_neighbor_[ineighbor]!=MPI_me_) && (n_bytes!=0) ) {
+                // If MPI comm, first pack particles in the sendbuffer, one species after the other
+                char* buffer = SpeciesMPIbuffers::growBuffer( particlesMPIbuff.packSend[ineighbor], n_bytes );
+                int offset = 0;
+                for (unsigned int i=0 ; i<species.size() ; i++) {
+                    Particles &cuParticles = (*vecSpecies[species[i]]->particles);
+                    std::vector<int>& indexes = vecSpecies[species[i]]->MPIbuff.part_index_neighbor_send[ineighbor];
+                    cuParticles.pack( indexes, buffer+offset );
+                    offset += cuParticles.packedBytes( indexes.size() );
+                }
                 // Then send particles
-                int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
-                vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor] = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]) );
-                MPI_Isend( &((vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]).position(0,0)), 1, vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
-            }
-            else {
-                //If not MPI comm, copy particles directly in the receive buffer
-                for (int iPart=0 ; iPart<n_part_send ; iPart++)
-                    cuParticles.cp_particle( vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart],((*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]) );
+                int tag = buildtag( hindex, 4, ineighbor+10 );
+                MPI_Isend( buffer, n_bytes, MPI_BYTE, MPI_particle_neighbor_[ineighbor], tag, MPI_COMM_WORLD, &(particlesMPIbuff.srequest[ineighbor]) );
             }
         } // END of Send
 
-        n_part_recv = vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2];
-        if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
-                // If MPI comm, receive particles in the recv buffer previously initialized.
-                vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor] = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]) );
-                int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1 ,iNeighbor+3 );
-                MPI_Irecv( &((vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).position(0,0)), 1, vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
+        int jneighbor = nneighbors-1-ineighbor;
+        if ( (particle_neighbor_[jneighbor]!=MPI_PROC_NULL) && (MPI_particle_neighbor_[jneighbor]!=MPI_me_) ) {
+            int n_bytes = 0;
+            for (unsigned int i=0 ; i<species.size() ; i++) {
+                n_part_recv = vecSpecies[species[i]]->MPIbuff.part_neighbor_recv_sz[ineighbor];
+                n_bytes += vecSpecies[species[i]]->particles->packedBytes( n_part_recv );
+            }
+            if (n_bytes!=0) {
+                // If MPI comm, receive packed particles, unpacked in the recv buffers previously initialized.
+                char* buffer = SpeciesMPIbuffers::growBuffer( particlesMPIbuff.packRecv[ineighbor], n_bytes );
+                int tag = buildtag( particle_neighbor_[jneighbor], 4, ineighbor+10 );
+                MPI_Irecv( buffer, n_bytes, MPI_BYTE, MPI_particle_neighbor_[jneighbor], tag, MPI_COMM_WORLD, &(particlesMPIbuff.rrequest[ineighbor]) );
             }
 
         } // END of Recv
 
-    } // END for iNeighbor
+    } // END for ineighbor
 
-} // END CommParticles(... iDim)
+} // END CommParticles
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// For direction iDim, finalize receive of particles, temporary store particles if diagonalParticles
-// And store recv particles at their definitive place.
-// Call Patch::cleanup_sent_particles
+// List the particles received with a displacement of o, o[iDim]!=0 and o[idim]=0 for idim>iDim, in the order they would
+// have arrived if particles were exchanged one dimension after the other, so that the sorting of particles (and the
+// results) do not depend on the exchange:
+//   - first the particles which only crossed the border along iDim,
+//   - then, for each lower dimension (-1 then +1), the particles which crossed it before, in reverse order
+// o is used as workspace and restored
+// ---------------------------------------------------------------------------------------------------------------------
+static void orderReceivedParticles( int iDim, std::vector<int>& o, std::vector<int>& part_neighbor_recv_sz, std::vector< std::pair<int,int> >& received )
+{
+    int ineighbor(0), stride(1);
+    for (unsigned int idim=0 ; idim<o.size() ; idim++) {
+        ineighbor += (o[idim]+1)*stride;
+        stride *= 3;
+    }
+    for (int iPart=0 ; iPart<part_neighbor_recv_sz[ineighbor] ; iPart++)
+        received.push_back( std::make_pair( ineighbor, iPart ) );
+
+    for (int idim=0 ; idim<iDim ; idim++) {
+        for (int iNeighbor=-1 ; iNeighbor<=1 ; iNeighbor+=2) {
+            o[idim] = iNeighbor;
+            unsigned int first = received.size();
+            orderReceivedParticles( idim, o, part_neighbor_recv_sz, received );
+            std::reverse( received.begin()+first, received.end() );
+        }
+        o[idim] = 0;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Finalize receive of particles, store them per direction of arrival and at their definitive place.
 //   - vecPatch : used for intra-MPI process comm (direct copy using Particels::cp_particles)
 //   - smpi     : used smpi->periods_
+//   - species  : species exchanged, unpacked one after the other from the message of each MPI neighbor
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
+void Patch::finalizeCommParticles(SmileiMPI* smpi, std::vector<unsigned int>& species, Params& params, VectorPatch * vecPatch)
 {
 
     int ndim = params.nDim_field;
-    int idim, check;
-
-    Particles &cuParticles = (*vecSpecies[ispec]->particles);
 
-    int n_part_send, n_part_recv;
+    int n_part_recv;
+    int nneighbors = particle_neighbor_.size();
 
     /********************************************************************************/
     // Wait for end of communications over Particles
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        MPI_Status sstat    [2];
-        MPI_Status rstat    [2];
-
-        n_part_send = vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor].size();
-        n_part_recv = vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2];
-
-
-
-        if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (n_part_send!=0) ) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
-                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
-                MPI_Type_free( &(vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor]) );
-            }
+    for (int ineighbor=0 ; ineighbor<nneighbors ; ineighbor++) {
+        if (ineighbor == nneighbors/2) continue;
+        MPI_Status sstat;
+        MPI_Status rstat;
+
+        // Requests of neighbors to which nothing was sent (or from which nothing is received) are MPI_REQUEST_NULL
+        if (particle_neighbor_[ineighbor]!=MPI_PROC_NULL) {
+            if (MPI_particle_neighbor_[ineighbor]!=MPI_me_)
+                MPI_Wait( &(particlesMPIbuff.srequest[ineighbor]), &sstat );
         }
-        if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
-                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
-                MPI_Type_free( &(vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor]) );
-            }
-
-            // Treat diagonalParticles
-            if (iDim < ndim-1){ // No need to treat diag particles at last dimension.
-                for (int iPart=n_part_recv-1 ; iPart>=0; iPart-- ) {
-                    check = 0;
-                    idim = iDim+1;//We check next dimension
-                    while (check == 0 && idim<ndim){
-                        //If particle not in the domain...
-                        if ( (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).position(idim,iPart) < min_local[idim] ){
-                            if (neighbor_[idim][0]!=MPI_PROC_NULL){ //if neighbour exists
-                                //... copy it at the back of the local particle vector ...
-                                (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).cp_particle(iPart, cuParticles);
-                                //...adjust bmax or cell_keys ...
-                                vecSpecies[ispec]->add_space_for_a_particle();
-                                //... and add its index to the particles to be sent later...
-                                vecSpecies[ispec]->MPIbuff.part_index_send[idim][0].push_back( cuParticles.size()-1 );
-                                //..without forgeting to add it to the list of particles to clean.
-                                vecSpecies[ispec]->addPartInExchList(cuParticles.size()-1);
-                            }
-                            //Remove it from receive buffer.
-                            (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).erase_particle(iPart);
-                            vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2]--;
-                            check = 1;
-                        }
-                        //Other side of idim
-                        else if ( (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).position(idim,iPart) >= max_local[idim]) {
-                            if (neighbor_[idim][1]!=MPI_PROC_NULL){ //if neighbour exists
-                                (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).cp_particle(iPart, cuParticles);
-                                //...adjust bmax or cell_keys ...
-                                vecSpecies[ispec]->add_space_for_a_particle();
-                                vecSpecies[ispec]->MPIbuff.part_index_send[idim][1].push_back( cuParticles.size()-1 );
-                                vecSpecies[ispec]->addPartInExchList(cuParticles.size()-1);
-                            }
-                            (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).erase_particle(iPart);
-                            vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2]--;
-                            check = 1;
-                        }
-                        idim++;
-                    }
+        int jneighbor = nneighbors-1-ineighbor;
+        if (particle_neighbor_[jneighbor]!=MPI_PROC_NULL) {
+            if (MPI_particle_neighbor_[jneighbor]!=MPI_me_) {
+                MPI_Wait( &(particlesMPIbuff.rrequest[ineighbor]), &rstat );
+                int offset = 0;
+                for (unsigned int i=0 ; i<species.size() ; i++) {
+                    SpeciesMPIbuffers& MPIbuff = vecSpecies[species[i]]->MPIbuff;
+                    n_part_recv = MPIbuff.part_neighbor_recv_sz[ineighbor];
+                    if (n_part_recv==0) continue;
+                    MPIbuff.partNeighborRecv[ineighbor].unpack( &(particlesMPIbuff.packRecv[ineighbor][offset]), 0, n_part_recv );
+                    offset += vecSpecies[species[i]]->particles->packedBytes( n_part_recv );
                 }
-            }//If not last dim for diagonal particles.
-
-        } //If received something
-    } //loop i Neighbor
-
-    //La recopie finale doit se faire au traitement de la dernière dimension seulement !!
-    if (iDim == ndim-1){
+            }
+        }
+    } //loop on neighbors
 
+    /********************************************************************************/
+    // Store received particles per direction of arrival (highest dimension crossed)
+    /********************************************************************************/
+    std::vector<int> o( ndim, 0 );
+    std::vector< std::pair<int,int> > received;
+    for (unsigned int i=0 ; i<species.size() ; i++) {
+        SpeciesMPIbuffers& MPIbuff = vecSpecies[species[i]]->MPIbuff;
+        for (int iDim=0 ; iDim<ndim ; iDim++) {
+            for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+                // Particles coming from Xmin go toward Xmax
+                o[iDim] = 1-2*iNeighbor;
+                received.clear();
+                orderReceivedParticles( iDim, o, MPIbuff.part_neighbor_recv_sz, received );
+                for (unsigned int iPart=0 ; iPart<received.size() ; iPart++)
+                    MPIbuff.partNeighborRecv[received[iPart].first].cp_particle( received[iPart].second, MPIbuff.partRecv[iDim][iNeighbor] );
+                MPIbuff.part_index_recv_sz[iDim][iNeighbor] = received.size();
+            }
+            o[iDim] = 0;
+        }
 
-        vecSpecies[ispec]->sort_part(params);
+        vecSpecies[species[i]]->sort_part(params);
+    }
 
-    }//End Recv_buffers ==> particles
+} // finalizeCommParticles
 
 
-} // finalizeCommParticles(... iDim)
+// ---------------------------------------------------------------------------------------------------------------------
+// A patch is empty if none of its species has particles
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::updateEmpty()
+{
+    is_empty = true;
+    for (unsigned int ispec=0 ; ispec<vecSpecies.size() ; ispec++) {
+        if ( vecSpecies[ispec]->getNbrOfParticles() > 0 ) {
+            is_empty = false;
+            break;
+        }
+    }
+}
 
 
 void Patch::cleanParticlesOverhead(Params& params)
@@ -665,19 +769,25 @@ void Patch::cleanParticlesOverhead(Params& params)
             for ( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
                 vecSpecies[ispec]->MPIbuff.partRecv[idim][iNeighbor].clear();
                 vecSpecies[ispec]->MPIbuff.partRecv[idim][iNeighbor].shrink_to_fit(ndim);
-                vecSpecies[ispec]->MPIbuff.partSend[idim][iNeighbor].clear();
-                vecSpecies[ispec]->MPIbuff.partSend[idim][iNeighbor].shrink_to_fit(ndim);
-                vecSpecies[ispec]->MPIbuff.part_index_send[idim][iNeighbor].clear();
-                vector<int>(vecSpecies[ispec]->MPIbuff.part_index_send[idim][iNeighbor]).swap(vecSpecies[ispec]->MPIbuff.part_index_send[idim][iNeighbor]);
             }
         }
+        for ( unsigned int ineighbor=0 ; ineighbor<vecSpecies[ispec]->MPIbuff.partNeighborRecv.size() ; ineighbor++ ) {
+            vecSpecies[ispec]->MPIbuff.partNeighborRecv[ineighbor].clear();
+            vecSpecies[ispec]->MPIbuff.partNeighborRecv[ineighbor].shrink_to_fit(ndim);
+            vecSpecies[ispec]->MPIbuff.part_index_neighbor_send[ineighbor].clear();
+            vector<int>(vecSpecies[ispec]->MPIbuff.part_index_neighbor_send[ineighbor]).swap(vecSpecies[ispec]->MPIbuff.part_index_neighbor_send[ineighbor]);
+        }
 
         cuParticles.shrink_to_fit(ndim);
     }
 
+    for ( unsigned int ineighbor=0 ; ineighbor<particlesMPIbuff.packSend.size() ; ineighbor++ ) {
+        vector<char>().swap(particlesMPIbuff.packSend[ineighbor]);
+        vector<char>().swap(particlesMPIbuff.packRecv[ineighbor]);
+    }
+
 }
 
-// ---------------------------------------------------------------------------------------------------------------------
 // Clear vecSpecies[]->indexes_of_particles_to_exchange, suppress particles send and manage memory
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::cleanup_sent_particles(int ispec, std::vector<int>* indexes_of_particles_to_exchange)
@@ -12,6 +12,7 @@
 #include "PartWall.h"
 #include "Interpolator.h"
 #include "Projector.h"
+#include "AsyncMPIbuffers.h"
 
 class DomainDecomposition;
 class Collisions;
@@ -29,6 +30,8 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class AggregatedMPIbuffers;
+    friend class AggregatedParticlesCounts;
 public:
     //! Constructor for Patch
     Patch(Params& params, SmileiMPI* smpi, DomainDecomposition* domain_decomposition, unsigned int ipatch, unsigned int n_moved);
@@ -69,6 +72,8 @@ public:
 
     //! Interpolator (used to push particles and for probes)
     Interpolator* Interp;
+    //! Interpolators of the bins processed as OpenMP tasks, one per thread (Main.cluster_tasks)
+    std::vector<Interpolator*> Interp_threads;
     //! Projector
     Projector* Proj;
 
@@ -85,19 +90,29 @@ public:
     //!Cartesian coordinates of the patch. X,Y,Z of the Patch according to its Hilbert index.
     std::vector<unsigned int> Pcoordinates;
 
+    //! Number of cells of the patch along each dimension : n_space, times the global_factor of the Domain
+    //! for the patch of a Domain (see Patch::set)
+    std::vector<unsigned int> n_space;
+
+    //! True if no species has particles in the patch: the particle dynamics and projections are then skipped.
+    //! Updated once the particles have been exchanged and imported (false for a new patch).
+    bool is_empty;
+    //! Update is_empty from the number of particles of all species
+    void updateEmpty();
+
 
     // MPI exchange/sum methods for particles/fields
     //   - fields communication specified per geometry (pure virtual)
     // --------------------------------------------------------------
 
-    //! manage Idx of particles per direction,
+    //! manage Idx of particles per neighbor (faces, edges and corners),
     void initExchParticles(SmileiMPI* smpi, int ispec, Params& params);
-    //!init comm  nbr of particles/
-    void initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
-    //! finalize comm / nbr of particles, init exch / particles
-    void CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
-    //! finalize exch / particles, manage particles suppr/introduce
-    void finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
+    //!init comm  nbr of particles/ (all species in species at once)
+    void initCommParticles(SmileiMPI* smpi, std::vector<unsigned int>& species, Params& params, VectorPatch* vecPatch);
+    //! finalize comm / nbr of particles, init exch / particles (all species in species at once)
+    void CommParticles(SmileiMPI* smpi, std::vector<unsigned int>& species, Params& params, VectorPatch* vecPatch);
+    //! finalize exch / particles, manage particles suppr/introduce (all species in species at once)
+    void finalizeCommParticles(SmileiMPI* smpi, std::vector<unsigned int>& species, Params& params, VectorPatch* vecPatch);
     //! clean memory resizing particles structure
     void cleanParticlesOverhead(Params& params);
     //! delete Particles included in the index of particles to exchange. Assumes indexes are sorted.
@@ -159,6 +174,8 @@ public:
     //! Compute MPI rank of neigbors patch regarding neigbors patch Ids
     void updateMPIenv(SmileiMPI *smpi);
     void updateTagenv(SmileiMPI *smpi);
+    //! Compute Ids and MPI ranks of the face, edge and corner neighbors patch from neighbor_
+    void updateParticleNeighbors(DomainDecomposition* domain_decomposition, SmileiMPI *smpi);
 
     // Test who is MPI neighbor of current patch
     inline bool is_a_MPI_neighbor(int iDim, int iNeighbor) {
@@ -277,6 +294,13 @@ protected:
     //! MPI rank of neighbors patch
     std::vector< std::vector<int> > MPI_neighbor_, tmp_MPI_neighbor_;
 
+    //! Hilbert index and MPI rank of the 3^ndim patches around the current one, to exchange particles in one step
+    //!   - the patch at Pcoordinates + o (o[iDim] = -1, 0 or 1) is stored at sum_iDim (o[iDim]+1)*3^iDim
+    //!   - MPI_PROC_NULL if one of the neighbor_[iDim] crossed to reach it does not exist
+    std::vector<int> particle_neighbor_, MPI_particle_neighbor_;
+    //! Messages of particles of all species exchanged with the particle_neighbor_
+    PatchParticlesMPIbuffers particlesMPIbuff;
+
     //! "Real" min limit of local sub-subdomain (ghost data not concerned)
     //!     - "0." on rank 0
     std::vector<double> min_local;
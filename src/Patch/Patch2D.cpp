@@ -177,7 +177,7 @@ void Patch2D::initSumField( Field* field, int iDim )
             //int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor, tagp );
             int tag = f2D->MPIbuff.recv_tags_[iDim][iNeighbor];
             //cout << hindex << " recv from " << neighbor_[iDim][(iNeighbor+1)%2] << " ; n_elements = " << tmp_elem << endl;
-            MPI_Irecv( &( f2D->MPIbuff.buf[iDim][(iNeighbor+1)%2][0]) , tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
+            MPI_Irecv( &( f2D->MPIbuff.buf[iDim][(iNeighbor+1)%2][0]) , tmp_elem, SMILEI_MPI_FIELD, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
 
         } // END of Recv
             
@@ -449,15 +449,15 @@ void Patch2D::createType( Params& params )
             
             // Standard Type
             ntype_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous(params.oversize[0]*ny, MPI_DOUBLE, &(ntype_[0][ix_isPrim][iy_isPrim]));    //line
+            MPI_Type_contiguous(params.oversize[0]*ny, SMILEI_MPI_FIELD, &(ntype_[0][ix_isPrim][iy_isPrim]));    //line
             MPI_Type_commit( &(ntype_[0][ix_isPrim][iy_isPrim]) );
             ntype_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_vector(nx, params.oversize[1], ny, MPI_DOUBLE, &(ntype_[1][ix_isPrim][iy_isPrim])); // column
+            MPI_Type_vector(nx, params.oversize[1], ny, SMILEI_MPI_FIELD, &(ntype_[1][ix_isPrim][iy_isPrim])); // column
             MPI_Type_commit( &(ntype_[1][ix_isPrim][iy_isPrim]) );
             
             // Still used ???
             ntype_[2][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous(ny*clrw, MPI_DOUBLE, &(ntype_[2][ix_isPrim][iy_isPrim]));   //clrw lines
+            MPI_Type_contiguous(ny*clrw, SMILEI_MPI_FIELD, &(ntype_[2][ix_isPrim][iy_isPrim]));   //clrw lines
             MPI_Type_commit( &(ntype_[2][ix_isPrim][iy_isPrim]) );
             
             ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
@@ -465,7 +465,7 @@ void Patch2D::createType( Params& params )
             //MPI_Type_contiguous(nline, ntype_[0][ix_isPrim][iy_isPrim], &(ntypeSum_[0][ix_isPrim][iy_isPrim]));    //line
             
             MPI_Datatype tmpType = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous(ny, MPI_DOUBLE, &(tmpType));    //line
+            MPI_Type_contiguous(ny, SMILEI_MPI_FIELD, &(tmpType));    //line
             MPI_Type_commit( &(tmpType) );
             
             MPI_Type_contiguous(nline, tmpType, &(ntypeSum_[0][ix_isPrim][iy_isPrim]));    //line
@@ -475,7 +475,7 @@ void Patch2D::createType( Params& params )
             
             ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ncol  = 1 + 2*params.oversize[1] + iy_isPrim;
-            MPI_Type_vector(nx, ncol, ny, MPI_DOUBLE, &(ntypeSum_[1][ix_isPrim][iy_isPrim])); // column
+            MPI_Type_vector(nx, ncol, ny, SMILEI_MPI_FIELD, &(ntypeSum_[1][ix_isPrim][iy_isPrim])); // column
             MPI_Type_commit( &(ntypeSum_[1][ix_isPrim][iy_isPrim]) );
             
         }
@@ -491,8 +491,8 @@ void Patch2D::createType2( Params& params )
     if (ntype_[0][0][0] != MPI_DATATYPE_NULL)
         return;
 
-    int nx0 = params.n_space[0]*params.global_factor[0] + 1 + 2*params.oversize[0];
-    int ny0 = params.n_space[1]*params.global_factor[1] + 1 + 2*params.oversize[1];
+    int nx0 = n_space[0] + 1 + 2*params.oversize[0];
+    int ny0 = n_space[1] + 1 + 2*params.oversize[1];
     unsigned int clrw = params.clrw;
     
     // MPI_Datatype ntype_[nDim][primDual][primDual]
@@ -506,15 +506,15 @@ void Patch2D::createType2( Params& params )
             
             // Standard Type
             ntype_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous(params.oversize[0]*ny, MPI_DOUBLE, &(ntype_[0][ix_isPrim][iy_isPrim]));    //line
+            MPI_Type_contiguous(params.oversize[0]*ny, SMILEI_MPI_FIELD, &(ntype_[0][ix_isPrim][iy_isPrim]));    //line
             MPI_Type_commit( &(ntype_[0][ix_isPrim][iy_isPrim]) );
             ntype_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_vector(nx, params.oversize[1], ny, MPI_DOUBLE, &(ntype_[1][ix_isPrim][iy_isPrim])); // column
+            MPI_Type_vector(nx, params.oversize[1], ny, SMILEI_MPI_FIELD, &(ntype_[1][ix_isPrim][iy_isPrim])); // column
             MPI_Type_commit( &(ntype_[1][ix_isPrim][iy_isPrim]) );
             
             // Still used ???
             ntype_[2][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous(ny*clrw, MPI_DOUBLE, &(ntype_[2][ix_isPrim][iy_isPrim]));   //clrw lines
+            MPI_Type_contiguous(ny*clrw, SMILEI_MPI_FIELD, &(ntype_[2][ix_isPrim][iy_isPrim]));   //clrw lines
             MPI_Type_commit( &(ntype_[2][ix_isPrim][iy_isPrim]) );
             
             ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
@@ -522,7 +522,7 @@ void Patch2D::createType2( Params& params )
             //MPI_Type_contiguous(nline, ntype_[0][ix_isPrim][iy_isPrim], &(ntypeSum_[0][ix_isPrim][iy_isPrim]));    //line
             
             MPI_Datatype tmpType = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous(ny, MPI_DOUBLE, &(tmpType));    //line
+            MPI_Type_contiguous(ny, SMILEI_MPI_FIELD, &(tmpType));    //line
             MPI_Type_commit( &(tmpType) );
             
             MPI_Type_contiguous(nline, tmpType, &(ntypeSum_[0][ix_isPrim][iy_isPrim]));    //line
@@ -532,7 +532,7 @@ void Patch2D::createType2( Params& params )
             
             ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ncol  = 1 + 2*params.oversize[1] + iy_isPrim;
-            MPI_Type_vector(nx, ncol, ny, MPI_DOUBLE, &(ntypeSum_[1][ix_isPrim][iy_isPrim])); // column
+            MPI_Type_vector(nx, ncol, ny, SMILEI_MPI_FIELD, &(ntypeSum_[1][ix_isPrim][iy_isPrim])); // column
             MPI_Type_commit( &(ntypeSum_[1][ix_isPrim][iy_isPrim]) );
             
         }
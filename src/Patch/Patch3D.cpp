@@ -206,7 +206,7 @@ void Patch3D::initSumField( Field* field, int iDim )
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
             int tmp_elem = f3D->MPIbuff.buf[iDim][(iNeighbor+1)%2].size();
             int tag = f3D->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( &( f3D->MPIbuff.buf[iDim][(iNeighbor+1)%2][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, 
+            MPI_Irecv( &( f3D->MPIbuff.buf[iDim][(iNeighbor+1)%2][0] ), tmp_elem, SMILEI_MPI_FIELD, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, 
                        MPI_COMM_WORLD, &(f3D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
         } // END of Recv
             
@@ -476,9 +476,9 @@ void Patch3D::createType2( Params& params ) {
     if (ntype_[0][0][0][0] != MPI_DATATYPE_NULL)
         return;
 
-    int nx0 = params.n_space[0]*params.global_factor[0] + 1 + 2*params.oversize[0];
-    int ny0 = params.n_space[1]*params.global_factor[1] + 1 + 2*params.oversize[1];
-    int nz0 = params.n_space[2]*params.global_factor[2] + 1 + 2*params.oversize[2];
+    int nx0 = n_space[0] + 1 + 2*params.oversize[0];
+    int ny0 = n_space[1] + 1 + 2*params.oversize[1];
+    int nz0 = n_space[2] + 1 + 2*params.oversize[2];
     
     // MPI_Datatype ntype_[nDim][primDual][primDual]
     int nx, ny, nz;
@@ -494,17 +494,17 @@ void Patch3D::createType2( Params& params ) {
                 // Standard Type
                 ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous(params.oversize[0]*ny*nz, 
-                                    MPI_DOUBLE, &(ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                    SMILEI_MPI_FIELD, &(ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim]) );
 
                 ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx, params.oversize[1]*nz, ny*nz, 
-                                MPI_DOUBLE, &(ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim]) );
 
                 ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx*ny, params.oversize[2], nz, 
-                                MPI_DOUBLE, &(ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim]) );
             
 
@@ -514,17 +514,17 @@ void Patch3D::createType2( Params& params ) {
 
                 ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous(nx_sum*ny*nz, 
-                                    MPI_DOUBLE, &(ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                    SMILEI_MPI_FIELD, &(ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim]) );
             
                 ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx, ny_sum*nz, ny*nz, 
-                                MPI_DOUBLE, &(ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim]) );
 
                 ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx*ny, nz_sum, nz, 
-                                MPI_DOUBLE, &(ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim]) );
             
             }
@@ -556,17 +556,17 @@ void Patch3D::createType( Params& params )
                 // Standard Type
                 ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous(params.oversize[0]*ny*nz, 
-                                    MPI_DOUBLE, &(ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                    SMILEI_MPI_FIELD, &(ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim]) );
 
                 ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx, params.oversize[1]*nz, ny*nz, 
-                                MPI_DOUBLE, &(ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim]) );
 
                 ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx*ny, params.oversize[2], nz, 
-                                MPI_DOUBLE, &(ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim]) );
             
 
@@ -576,17 +576,17 @@ void Patch3D::createType( Params& params )
 
                 ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous(nx_sum*ny*nz, 
-                                    MPI_DOUBLE, &(ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                    SMILEI_MPI_FIELD, &(ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim]) );
             
                 ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx, ny_sum*nz, ny*nz, 
-                                MPI_DOUBLE, &(ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim]) );
 
                 ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector(nx*ny, nz_sum, nz, 
-                                MPI_DOUBLE, &(ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
+                                SMILEI_MPI_FIELD, &(ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim]));
                 MPI_Type_commit( &(ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim]) );
             
             }
@@ -113,6 +113,9 @@ public:
 
         vecPatches.set_refHindex();
 
+        for (unsigned int ipatch = 0 ; ipatch < npatches ; ipatch++)
+            vecPatches.patches_[ipatch]->updateParticleNeighbors(vecPatches.domain_decomposition_, smpi);
+        vecPatches.updateNeighborsComm( smpi );
         vecPatches.update_field_list();
 
         TITLE("Creating Diagnostics, antennas, and external fields")
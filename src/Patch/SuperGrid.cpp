@@ -0,0 +1,189 @@
+#include "SuperGrid.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "VectorPatch.h"
+#include "DomainDecompositionFactory.h"
+#include "ElectroMagn1D.h"
+#include "ElectroMagn2D.h"
+#include "ElectroMagn3D.h"
+#include "ElectroMagnBC.h"
+#include "Solver.h"
+#include "Field.h"
+#include "Params.h"
+
+using namespace std;
+
+SuperGrid::SuperGrid() :
+    decomposition_( NULL ),
+    EMfields_( NULL ),
+    n_space_( 0 ),
+    oversize_( 0 )
+{
+}
+
+SuperGrid::~SuperGrid()
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Allocate the grid of the patches of vecPatches, copy their E, B, B_m in it and make them views of the grid
+//     - the grid is an ElectroMagn of global_factor = [number of patches, 1, 1] (see the Domain of uncoupled_grids)
+//     - the patch at position p along X starts at the row p*n_space[0] of the grid
+// ---------------------------------------------------------------------------------------------------------------------
+bool SuperGrid::build( Params& params, VectorPatch& vecPatches )
+{
+    unsigned int npatches = vecPatches.size();
+    if ( npatches < 2 )
+        return false;
+
+    // Patches sorted along X, all at the same coordinates along the other dimensions
+    vector< pair<unsigned int,unsigned int> > xOrder( npatches );
+    for ( unsigned int ipatch=0 ; ipatch<npatches ; ipatch++ )
+        xOrder[ipatch] = make_pair( vecPatches(ipatch)->Pcoordinates[0], ipatch );
+    sort( xOrder.begin(), xOrder.end() );
+    Patch* first = vecPatches(xOrder[0].second);
+    for ( unsigned int p=0 ; p<npatches ; p++ ) {
+        Patch* patch = vecPatches(xOrder[p].second);
+        if ( patch->Pcoordinates[0] != first->Pcoordinates[0]+p )
+            return false;
+        for ( unsigned int iDim=1 ; iDim<params.nDim_field ; iDim++ )
+            if ( patch->Pcoordinates[iDim] != first->Pcoordinates[iDim] )
+                return false;
+    }
+
+    patches_.resize( npatches );
+    position_.resize( npatches );
+    for ( unsigned int p=0 ; p<npatches ; p++ ) {
+        patches_[p] = xOrder[p].second;
+        position_[xOrder[p].second] = p;
+    }
+    n_space_  = params.n_space[0];
+    oversize_ = params.oversize[0];
+
+    // Fields and solvers sized for the whole grid
+    //     - no species : no current or density per species
+    //     - the boundary conditions and rho are released, they are those of the patches
+    //     - J is kept, the currents of the patches are copied in it for Maxwell-Ampere (see copyCurrents)
+    vector<unsigned int> global_factor( params.nDim_field, 1 );
+    global_factor[0] = npatches;
+    decomposition_ = DomainDecompositionFactory::createGlobal( params, global_factor );
+    vector<Species*> noSpecies;
+    if ( params.geometry == "1Dcartesian" )
+        EMfields_ = new ElectroMagn1D( params, decomposition_, noSpecies, first );
+    else if ( params.geometry == "2Dcartesian" )
+        EMfields_ = new ElectroMagn2D( params, decomposition_, noSpecies, first );
+    else
+        EMfields_ = new ElectroMagn3D( params, decomposition_, noSpecies, first );
+    for ( unsigned int i=0 ; i<EMfields_->emBoundCond.size() ; i++ )
+        if ( EMfields_->emBoundCond[i] != NULL )
+            delete EMfields_->emBoundCond[i];
+    EMfields_->emBoundCond.clear();
+    delete EMfields_->rho_;
+    EMfields_->rho_ = NULL;
+
+    for ( unsigned int p=0 ; p<npatches ; p++ ) {
+        ElectroMagn* patchFields = vecPatches(patches_[p])->EMfields;
+        Field* grids  [9] = { EMfields_->Ex_, EMfields_->Ey_, EMfields_->Ez_,
+                              EMfields_->Bx_, EMfields_->By_, EMfields_->Bz_,
+                              EMfields_->Bx_m, EMfields_->By_m, EMfields_->Bz_m };
+        Field* fields [9] = { patchFields->Ex_, patchFields->Ey_, patchFields->Ez_,
+                              patchFields->Bx_, patchFields->By_, patchFields->Bz_,
+                              patchFields->Bx_m, patchFields->By_m, patchFields->Bz_m };
+        for ( unsigned int ifield=0 ; ifield<9 ; ifield++ ) {
+            unsigned int rowsize = fields[ifield]->globalDims_ / fields[ifield]->dims_[0];
+            field_t* data = grids[ifield]->data_ + p*n_space_*rowsize;
+            unsigned int firstRow, lastRow;
+            ownedRows( patches_[p], fields[ifield], firstRow, lastRow );
+            memcpy( data + firstRow*rowsize, fields[ifield]->data_ + firstRow*rowsize,
+                    ( lastRow-firstRow )*rowsize*sizeof( field_t ) );
+            fields[ifield]->setView( data );
+        }
+    }
+
+    return true;
+}
+
+void SuperGrid::clean()
+{
+    if ( EMfields_ != NULL ) delete EMfields_;
+    if ( decomposition_ != NULL ) delete decomposition_;
+    EMfields_ = NULL;
+    decomposition_ = NULL;
+    patches_.clear();
+    position_.clear();
+}
+
+void SuperGrid::ownedRows( unsigned int ipatch, Field* field, unsigned int& first, unsigned int& last )
+{
+    first = 0;
+    last  = field->dims_[0];
+    if ( !isActive() )
+        return;
+
+    unsigned int p = position_[ipatch];
+    if ( p > 0 )
+        first = oversize_;
+    if ( p < patches_.size()-1 )
+        last = n_space_ + oversize_;
+}
+
+void SuperGrid::copyCurrents( unsigned int ipatch, ElectroMagn* EMfields )
+{
+    Field* grids  [3] = { EMfields_->Jx_, EMfields_->Jy_, EMfields_->Jz_ };
+    Field* fields [3] = { EMfields->Jx_, EMfields->Jy_, EMfields->Jz_ };
+    for ( unsigned int ifield=0 ; ifield<3 ; ifield++ ) {
+        unsigned int rowsize = fields[ifield]->globalDims_ / fields[ifield]->dims_[0];
+        field_t* data = grids[ifield]->data_ + position_[ipatch]*n_space_*rowsize;
+        unsigned int first, last;
+        ownedRows( ipatch, fields[ifield], first, last );
+        memcpy( data + first*rowsize, fields[ifield]->data_ + first*rowsize,
+                ( last-first )*rowsize*sizeof( field_t ) );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Same sequence as VectorPatch::solveMaxwell for a patch, called by all the threads
+//     - each solver computes a row from the other fields only : the grid is split in blocks of n_space[0] rows
+//       along X, shared between the threads
+//     - the out of place Faraday solvers swap the arrays of B and B_m (see saveMagneticFields) : the views of the
+//       patches are swapped the same way
+// ---------------------------------------------------------------------------------------------------------------------
+void SuperGrid::solveMaxwell( VectorPatch& vecPatches )
+{
+    unsigned int nblocks = nBlocks();
+    #pragma omp for schedule(static)
+    for ( unsigned int iblock=0 ; iblock<nblocks ; iblock++ )
+        (*EMfields_->MaxwellAmpereSolver_)( EMfields_, iblock*n_space_, ( iblock+1 )*n_space_ );
+
+    #pragma omp single
+    {
+        EMfields_->saveMagneticFields( false );
+        if ( EMfields_->MaxwellFaradaySolver_->isOutOfPlace() ) {
+            for ( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+                ElectroMagn* patchFields = vecPatches(ipatch)->EMfields;
+                patchFields->Bx_m->swapData( patchFields->Bx_ );
+                patchFields->By_m->swapData( patchFields->By_ );
+                patchFields->Bz_m->swapData( patchFields->Bz_ );
+            }
+        }
+    }
+
+    #pragma omp for schedule(static)
+    for ( unsigned int iblock=0 ; iblock<nblocks ; iblock++ )
+        (*EMfields_->MaxwellFaradaySolver_)( EMfields_, iblock*n_space_, ( iblock+1 )*n_space_ );
+}
+
+void SuperGrid::centerMagneticFields()
+{
+    unsigned int nblocks = nBlocks();
+    #pragma omp for schedule(static)
+    for ( unsigned int iblock=0 ; iblock<nblocks ; iblock++ )
+        EMfields_->centerMagneticFields( iblock*n_space_, ( iblock+1 )*n_space_ );
+}
+
+unsigned int SuperGrid::nBlocks()
+{
+    return ( EMfields_->dimDual[0] + n_space_-1 ) / n_space_;
+}
@@ -0,0 +1,74 @@
+#ifndef SUPERGRID_H
+#define SUPERGRID_H
+
+#include <vector>
+
+class Params;
+class VectorPatch;
+class DomainDecomposition;
+class ElectroMagn;
+class Field;
+
+//! Electromagnetic fields of all the patches of an MPI process in one contiguous grid (Main.supergrid)
+//!   - only if the patches of the MPI process are stacked along X (consecutive along X, same coordinates along the
+//!     other dimensions) : a patch is then a block of consecutive rows of the grid
+//!   - E, B and B_m of the patches become views of the grid, the ghost cells between neighbor patches are shared :
+//!     Maxwell is solved once on the grid, without local exchange of B along X
+//!   - J keeps the arrays of the patches (projected concurrently, ghost cells included), the rows owned by each patch
+//!     are copied in the grid before Maxwell-Ampere
+class SuperGrid {
+public:
+    SuperGrid();
+    ~SuperGrid();
+
+    //! Build the grid if the patches of vecPatches are stacked along X, returns false otherwise
+    bool build( Params& params, VectorPatch& vecPatches );
+    //! Delete the grid, the patches must have been deleted before
+    void clean();
+
+    inline bool isActive() const {
+        return EMfields_ != NULL;
+    }
+    //! Number of patches in the grid
+    inline unsigned int size() const {
+        return patches_.size();
+    }
+    //! Index (in VectorPatch) of the patch at position along X in the grid
+    inline unsigned int patch( unsigned int position ) const {
+        return patches_[position];
+    }
+    //! True if the ghost cells at Xmin of the patch ipatch are shared with its neighbor in the grid
+    inline bool sharesXmin( unsigned int ipatch ) const {
+        return isActive() && position_[ipatch] > 0;
+    }
+
+    //! Rows [first, last) along X of field, a component of the patch ipatch, written by this patch only
+    //!   - all rows if the grid is not active
+    //!   - the rows of the grid are shared between the patches, ghost cells at Xmin/Xmax only for the first/last patch
+    void ownedRows( unsigned int ipatch, Field* field, unsigned int& first, unsigned int& last );
+
+    //! Copy the rows of Jx, Jy, Jz owned by the patch ipatch in the grid
+    void copyCurrents( unsigned int ipatch, ElectroMagn* EMfields );
+
+    //! Maxwell-Ampere, save B in B_m and Maxwell-Faraday on the whole grid (all threads, blocks of rows along X)
+    void solveMaxwell( VectorPatch& vecPatches );
+
+    //! B_m = (B + B_m)/2 on the whole grid (all threads, blocks of rows along X)
+    void centerMagneticFields();
+
+private:
+    //! Number of blocks of n_space[0] rows along X in the grid, shared between the threads
+    unsigned int nBlocks();
+
+    DomainDecomposition* decomposition_;
+    //! Fields of the grid, E, B and B_m are shared with the patches, J is a copy of the currents of the patches
+    ElectroMagn* EMfields_;
+    //! Patches indexes by position along X in the grid
+    std::vector<unsigned int> patches_;
+    //! Position along X in the grid by patch index
+    std::vector<unsigned int> position_;
+    //! Number of cells and of ghost cells of a patch along X
+    unsigned int n_space_, oversize_;
+};
+
+#endif
@@ -65,3 +65,35 @@ void SyncCartesianPatch::cartesianToPatches( Domain& domain, VectorPatch& vecPat
 
 }
 
+
+void SyncCartesianPatch::patchedToCartesianFields( VectorPatch& vecPatches, Domain& domain, Params &params, SmileiMPI* smpi )
+{
+    for ( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches(ipatch)->EMfields->Ex_->put( domain.patch_->EMfields->Ex_, params, smpi, vecPatches(ipatch), domain.patch_ );
+        vecPatches(ipatch)->EMfields->Ey_->put( domain.patch_->EMfields->Ey_, params, smpi, vecPatches(ipatch), domain.patch_ );
+        vecPatches(ipatch)->EMfields->Ez_->put( domain.patch_->EMfields->Ez_, params, smpi, vecPatches(ipatch), domain.patch_ );
+
+        vecPatches(ipatch)->EMfields->Bx_->put( domain.patch_->EMfields->Bx_, params, smpi, vecPatches(ipatch), domain.patch_ );
+        vecPatches(ipatch)->EMfields->By_->put( domain.patch_->EMfields->By_, params, smpi, vecPatches(ipatch), domain.patch_ );
+        vecPatches(ipatch)->EMfields->Bz_->put( domain.patch_->EMfields->Bz_, params, smpi, vecPatches(ipatch), domain.patch_ );
+    }
+
+}
+
+
+void SyncCartesianPatch::patchedToCartesianRho( VectorPatch& vecPatches, Domain& domain, Params &params, SmileiMPI* smpi )
+{
+    for ( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ )
+        vecPatches(ipatch)->EMfields->rho_->put( domain.patch_->EMfields->rho_, params, smpi, vecPatches(ipatch), domain.patch_ );
+
+}
+
+
+// The potential is computed in place of the charge density of the Domain
+void SyncCartesianPatch::cartesianToPatchesPhi( Domain& domain, VectorPatch& vecPatches, Params &params, SmileiMPI* smpi )
+{
+    for ( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ )
+        vecPatches(ipatch)->EMfields->phi_->get( domain.patch_->EMfields->rho_, params, smpi, domain.patch_, vecPatches(ipatch) );
+
+}
+
@@ -16,6 +16,11 @@ public :
 
     static void patchedToCartesian( VectorPatch& vecPatches, Domain& domain, Params &params, SmileiMPI* smpi, Timers &timers, int itime );
     static void cartesianToPatches( Domain& domain, VectorPatch& vecPatches, Params &params, SmileiMPI* smpi, Timers &timers, int itime );
+    //! Electromagnetic fields of the patches on the Domain (initial fields, before the time loop)
+    static void patchedToCartesianFields( VectorPatch& vecPatches, Domain& domain, Params &params, SmileiMPI* smpi );
+    //! Charge density of the patches on the Domain, and potential of the Domain on the patches (FFT Poisson solver)
+    static void patchedToCartesianRho( VectorPatch& vecPatches, Domain& domain, Params &params, SmileiMPI* smpi );
+    static void cartesianToPatchesPhi( Domain& domain, VectorPatch& vecPatches, Params &params, SmileiMPI* smpi );
     static void sync( Field* inField, Field* outField, Params &params, SmileiMPI* smpi, Patch* inPatch, Patch* outPatch );
     static void syncBack( Field* inField, Field* outField, Params &params, SmileiMPI* smpi, Patch* inPatch, Patch* outPatch );
 
@@ -15,29 +15,22 @@ using namespace std;
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 
-void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, Timers &timers, int itime)
+// Exchange the particles of all the species in species at once (1 message per neighbor)
+void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, std::vector<unsigned int>& species, Params &params, SmileiMPI* smpi, Timers &timers, int itime)
 {
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        vecPatches(ipatch)->initExchParticles(smpi, ispec, params);
+        for (unsigned int i=0 ; i<species.size() ; i++)
+            vecPatches(ipatch)->initExchParticles(smpi, species[i], params);
     }
 
-    // Per direction
-    for (unsigned int iDim=0 ; iDim<1 ; iDim++) {
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->initCommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
-
-        //#pragma omp for schedule(runtime)
-        //for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        //    vecPatches(ipatch)->CommParticles(smpi, ispec, params, iDim, &vecPatches);
-        //}
-        //#pragma omp for schedule(runtime)
-        //for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        //    vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, iDim, &vecPatches);
-        //}
+    // All directions (faces, edges and corners) and all species at once
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+        vecPatches(ipatch)->initCommParticles(smpi, species, params, &vecPatches);
     }
+    // Numbers of particles of all patches sent to MPI neighbors at once
+    vecPatches.particlesCountsMPIaggr.init( vecPatches );
 
     //#pragma omp for schedule(runtime)
     //for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
@@ -45,32 +38,17 @@ void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Para
 }
 
 
-void SyncVectorPatch::finalize_and_sort_parts(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, Timers &timers, int itime)
+void SyncVectorPatch::finalize_and_sort_parts(VectorPatch& vecPatches, std::vector<unsigned int>& species, Params &params, SmileiMPI* smpi, Timers &timers, int itime)
 {
+    vecPatches.particlesCountsMPIaggr.finalize( vecPatches );
+
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        vecPatches(ipatch)->CommParticles(smpi, ispec, params, 0, &vecPatches);
+        vecPatches(ipatch)->CommParticles(smpi, species, params, &vecPatches);
     }
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, 0, &vecPatches);
-    }
-
-    // Per direction
-    for (unsigned int iDim=1 ; iDim<params.nDim_particle ; iDim++) {
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->initCommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
-
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->CommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
+        vecPatches(ipatch)->finalizeCommParticles(smpi, species, params, &vecPatches);
     }
 
     //#pragma omp for schedule(runtime)
@@ -139,188 +117,120 @@ void SyncVectorPatch::sumRhoJs(Params& params, VectorPatch& vecPatches, int ispe
 // timers and itime were here introduced for debugging
 void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches, Timers &timers, int itime )
 {
-    unsigned int nx_, ny_, nz_, h0, oversize[3], n_space[3], gsp[3];
-    double *pt1,*pt2;
-    h0 = vecPatches(0)->hindex;
-
     int nPatches( vecPatches.size() );
-
-    oversize[0] = vecPatches(0)->EMfields->oversize[0];
-    oversize[1] = vecPatches(0)->EMfields->oversize[1];
-    oversize[2] = vecPatches(0)->EMfields->oversize[2];
-
-    n_space[0] = vecPatches(0)->EMfields->n_space[0];
-    n_space[1] = vecPatches(0)->EMfields->n_space[1];
-    n_space[2] = vecPatches(0)->EMfields->n_space[2];
-
     unsigned int nComp = fields.size()/nPatches;
 
     // -----------------
     // Sum per direction :
+    for ( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
 
-    // iDim = 0, initialize comms : Isend/Irecv
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-        unsigned int ipatch = ifield%nPatches;
-        vecPatches(ipatch)->initSumField( fields[ifield], 0 );
-    }
-
-    //#pragma omp for schedule(static)
-    //for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-    //    unsigned int ipatch = ifield%nPatches;
-    //    vecPatches(ipatch)->testSumField( fields[ifield], 0 );
-    //}
-
-    // iDim = 0, local
-    for (unsigned int icomp=0 ; icomp<nComp ; icomp++) {
-        nx_ = fields[icomp*nPatches]->dims_[0];
-        ny_ = 1;
-        nz_ = 1;
-        if (fields[icomp*nPatches]->dims_.size()>1) {
-            ny_ = fields[icomp*nPatches]->dims_[1];
-            if (fields[icomp*nPatches]->dims_.size()>2)
-                nz_ = fields[icomp*nPatches]->dims_[2];
-        }
-        gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
-        #pragma omp for schedule(static) private(pt1,pt2)
-        for (unsigned int ifield=icomp*nPatches ; ifield<(icomp+1)*nPatches ; ifield++) {
-            unsigned int ipatch = ifield%nPatches;
-            if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
-                //The patch to the west belongs to the same MPI process than I.
-                pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0+icomp*nPatches])(n_space[0]*ny_*nz_);
-                pt2 = &(*fields[ifield])(0);
-                //Sum 2 ==> 1
-                for (unsigned int i = 0; i < gsp[0]* ny_*nz_ ; i++) pt1[i] += pt2[i];
-                //Copy back the results to 2
-                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof(double));
-            }
-        }
-    }
-
-    // iDim = 0, finalize (waitall)
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
-        unsigned int ipatch = ifield%nPatches;
-        vecPatches(ipatch)->finalizeSumField( fields[ifield], 0 );
-    }
-    // END iDim = 0 sync
-    // -----------------
-
-    if (fields[0]->dims_.size()>1) {
-        // -----------------
-        // Sum per direction :
-
-        // iDim = 1, initialize comms : Isend/Irecv
+        // initialize comms : Isend/Irecv
         #pragma omp for schedule(static)
         for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
             unsigned int ipatch = ifield%nPatches;
-            vecPatches(ipatch)->initSumField( fields[ifield], 1 );
+            vecPatches(ipatch)->initSumField( fields[ifield], iDim );
         }
 
-        //#pragma omp for schedule(static)
-        //for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-        //    unsigned int ipatch = ifield%nPatches;
-        //    vecPatches(ipatch)->testSumField( fields[ifield], 1 );
-        //}
-
-        // iDim = 1, local
+        // local
         for (unsigned int icomp=0 ; icomp<nComp ; icomp++) {
-            nx_ = fields[icomp*nPatches]->dims_[0];
-            ny_ = 1;
-            nz_ = 1;
-            if (fields[icomp*nPatches]->dims_.size()>1) {
-                ny_ = fields[icomp*nPatches]->dims_[1];
-                if (fields[icomp*nPatches]->dims_.size()>2)
-                    nz_ = fields[icomp*nPatches]->dims_[2];
-            }
-            gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
-            gsp[1] = 1+2*oversize[1]+fields[icomp*nPatches]->isDual_[1]; //Ghost size primal
-
-            #pragma omp for schedule(static) private(pt1,pt2)
-            for (unsigned int ifield=icomp*nPatches ; ifield<(icomp+1)*nPatches ; ifield++) {
-                unsigned int ipatch = ifield%nPatches;
-                if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[1][0]){
-                    //The patch to the south belongs to the same MPI process than I.
-                    pt1 = &(*fields[vecPatches(ipatch)->neighbor_[1][0]-h0+icomp*nPatches])(n_space[1]*nz_);
-                    pt2 = &(*fields[ifield])(0);
-                    for (unsigned int j = 0; j < nx_ ; j++){
-                        for (unsigned int i = 0; i < gsp[1]*nz_ ; i++) pt1[i] += pt2[i];
-                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof(double));
-                        pt1 += ny_*nz_;
-                        pt2 += ny_*nz_;
-                    }
-                }
-            }
+            #pragma omp for schedule(static)
+            for (unsigned int ifield=icomp*nPatches ; ifield<(icomp+1)*nPatches ; ifield++)
+                sumLocal( fields, vecPatches, ifield, iDim );
         }
 
-        // iDim = 1, finalize (waitall)
+        // finalize (waitall)
         #pragma omp for schedule(static)
         for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
             unsigned int ipatch = ifield%nPatches;
-            vecPatches(ipatch)->finalizeSumField( fields[ifield], 1 );
+            vecPatches(ipatch)->finalizeSumField( fields[ifield], iDim );
         }
-        // END iDim = 1 sync
-        // -----------------
 
-        if (fields[0]->dims_.size()>2) {
-            // -----------------
-            // Sum per direction :
+    } // End for iDim
 
-            // iDim = 2, initialize comms : Isend/Irecv
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-                unsigned int ipatch = ifield%nPatches;
-                vecPatches(ipatch)->initSumField( fields[ifield], 2 );
-            }
+}
 
-            // iDim = 2 local
-            for (unsigned int icomp=0 ; icomp<nComp ; icomp++) {
-                nx_ = fields[icomp*nPatches]->dims_[0];
-                ny_ = 1;
-                nz_ = 1;
-                if (fields[icomp*nPatches]->dims_.size()>1) {
-                    ny_ = fields[icomp*nPatches]->dims_[1];
-                    if (fields[icomp*nPatches]->dims_.size()>2)
-                        nz_ = fields[icomp*nPatches]->dims_[2];
-                }
-                gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
-                gsp[1] = 1+2*oversize[1]+fields[icomp*nPatches]->isDual_[1]; //Ghost size primal
-                gsp[2] = 1+2*oversize[2]+fields[icomp*nPatches]->isDual_[2]; //Ghost size primal
-                #pragma omp for schedule(static) private(pt1,pt2)
-                for (unsigned int ifield=icomp*nPatches ; ifield<(icomp+1)*nPatches ; ifield++) {
-                    unsigned int ipatch = ifield%nPatches;
-                    if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[2][0]){
-                        //The patch below me belongs to the same MPI process than I.
-                        pt1 = &(*fields[vecPatches(ipatch)->neighbor_[2][0]-h0+icomp*nPatches])(n_space[2]);
-                        pt2 = &(*fields[ifield])(0);
-                        for (unsigned int j = 0; j < nx_*ny_ ; j++){
-                            for (unsigned int i = 0; i < gsp[2] ; i++){
-                                pt1[i] += pt2[i];
-                                pt2[i] =  pt1[i];
-                            }
-                            pt1 += nz_;
-                            pt2 += nz_;
-                        }
-                    }
-                }
-            }
 
-            // iDim = 2, complete non local sync through MPIfinalize (waitall)
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
-                unsigned int ipatch = ifield%nPatches;
-                vecPatches(ipatch)->finalizeSumField( fields[ifield], 2 );
-            }
-            // END iDim = 2 sync
-            // -----------------
+// fields : contains a single field component for all patches of vecPatches
+// Same as sum, but can be called by a single thread (no worksharing construct)
+void SyncVectorPatch::sum_noomp( std::vector<Field*> fields, VectorPatch& vecPatches )
+{
+    for ( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
 
-        } // End if dims_.size()>2
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
+            vecPatches(ipatch)->initSumField( fields[ipatch], iDim );
 
-    } // End if dims_.size()>1
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
+            sumLocal( fields, vecPatches, ipatch, iDim );
+
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
+            vecPatches(ipatch)->finalizeSumField( fields[ipatch], iDim );
+
+    } // End for iDim
 
 }
 
 
+// Sum the ghost cells along iDim of fields[ifield] with those of the previous patch, if it belongs to the same MPI
+// process, and copy back the result in both
+void SyncVectorPatch::sumLocal( std::vector<Field*>& fields, VectorPatch& vecPatches, unsigned int ifield, unsigned int iDim )
+{
+    unsigned int nPatches = vecPatches.size();
+    unsigned int ipatch = ifield%nPatches;
+    if (vecPatches(ipatch)->MPI_me_ != vecPatches(ipatch)->MPI_neighbor_[iDim][0])
+        return;
+
+    unsigned int icomp = ifield/nPatches;
+    unsigned int h0 = vecPatches(0)->hindex;
+    unsigned int oversize = vecPatches(0)->EMfields->oversize[iDim];
+    unsigned int n_space  = vecPatches(0)->EMfields->n_space[iDim];
+
+    unsigned int nx_, ny_(1), nz_(1), gsp;
+    nx_ = fields[ifield]->dims_[0];
+    if (fields[ifield]->dims_.size()>1) {
+        ny_ = fields[ifield]->dims_[1];
+        if (fields[ifield]->dims_.size()>2)
+            nz_ = fields[ifield]->dims_[2];
+    }
+    gsp = 1+2*oversize+fields[ifield]->isDual_[iDim]; //Ghost size primal
+
+    field_t *pt1,*pt2;
+    Field* previous = fields[vecPatches(ipatch)->neighbor_[iDim][0]-h0+icomp*nPatches];
+    if (iDim==0) {
+        //The patch to the west belongs to the same MPI process than I.
+        pt1 = &(*previous)(n_space*ny_*nz_);
+        pt2 = &(*fields[ifield])(0);
+        //Sum 2 ==> 1
+        for (unsigned int i = 0; i < gsp*ny_*nz_ ; i++) pt1[i] += pt2[i];
+        //Copy back the results to 2
+        memcpy( pt2, pt1, gsp*ny_*nz_*sizeof(field_t));
+    }
+    else if (iDim==1) {
+        //The patch to the south belongs to the same MPI process than I.
+        pt1 = &(*previous)(n_space*nz_);
+        pt2 = &(*fields[ifield])(0);
+        for (unsigned int j = 0; j < nx_ ; j++){
+            for (unsigned int i = 0; i < gsp*nz_ ; i++) pt1[i] += pt2[i];
+            memcpy( pt2, pt1, gsp*nz_*sizeof(field_t));
+            pt1 += ny_*nz_;
+            pt2 += ny_*nz_;
+        }
+    }
+    else {
+        //The patch below me belongs to the same MPI process than I.
+        pt1 = &(*previous)(n_space);
+        pt2 = &(*fields[ifield])(0);
+        for (unsigned int j = 0; j < nx_*ny_ ; j++){
+            for (unsigned int i = 0; i < gsp ; i++){
+                pt1[i] += pt2[i];
+                pt2[i] =  pt1[i];
+            }
+            pt1 += nz_;
+            pt2 += nz_;
+        }
+    }
+
+}
+
 // The idea is to minimize the number of implicit barriers and maximize the workload between barriers
 // fields : contains all (Jx then Jy then Jz) components of a field for all patches of vecPatches
 //     - fields is not directly used in the exchange process, just to find local neighbor's field
@@ -333,7 +243,7 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
 void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPatch& vecPatches, Timers &timers, int itime )
 {
     unsigned int h0, oversize[3], n_space[3];
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     int nPatches( vecPatches.size() );
@@ -352,14 +262,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
     // Sum per direction :
 
     // iDim = 0, initialize comms : Isend/Irecv
-    unsigned int nPatchMPIx = vecPatches.MPIxIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0 ); // Jy
-        vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
-    }
+    vecPatches.densitiesMPIaggr[0].init(); // Jx, Jy, Jz
     // iDim = 0, local
     int nFieldLocalx = vecPatches.densitiesLocalx.size()/3;
     for ( int icomp=0 ; icomp<3 ; icomp++ ) {
@@ -387,19 +290,13 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
                 //Sum 2 ==> 1
                 for (unsigned int i = 0; i < gsp[0]* ny_*nz_ ; i++) pt1[i] += pt2[i];
                 //Copy back the results to 2
-                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof(double));
+                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof(field_t));
             }
         }
     }
 
     // iDim = 0, finalize (waitall)
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
-        vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
-    }
+    vecPatches.densitiesMPIaggr[0].finalize(); // Jx, Jy, Jz
     // END iDim = 0 sync
     // -----------------
 
@@ -408,14 +305,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
         // Sum per direction :
 
         // iDim = 1, initialize comms : Isend/Irecv
-        unsigned int nPatchMPIy = vecPatches.MPIyIdx.size();
-        #pragma omp for schedule(static)
-        for (unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield++) {
-            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
-        }
+        vecPatches.densitiesMPIaggr[1].init(); // Jx, Jy, Jz
 
         // iDim = 1,
         int nFieldLocaly = vecPatches.densitiesLocaly.size()/3;
@@ -445,7 +335,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
                     pt2 = &(vecPatches.densitiesLocaly[ifield]->data_[0]);
                     for (unsigned int j = 0; j < nx_ ; j++){
                         for (unsigned int i = 0; i < gsp[1]*nz_ ; i++) pt1[i] += pt2[i];
-                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof(double));
+                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof(field_t));
                         pt1 += ny_*nz_;
                         pt2 += ny_*nz_;
                     }
@@ -454,13 +344,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
         }
 
         // iDim = 1, finalize (waitall)
-        #pragma omp for schedule(static)
-        for (unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1) {
-            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
-        }
+        vecPatches.densitiesMPIaggr[1].finalize(); // Jx, Jy, Jz
         // END iDim = 1 sync
         // -----------------
 
@@ -469,14 +353,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
             // Sum per direction :
 
             // iDim = 2, initialize comms : Isend/Irecv
-            unsigned int nPatchMPIz = vecPatches.MPIzIdx.size();
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield++) {
-                unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
-            }
+            vecPatches.densitiesMPIaggr[2].init(); // Jx, Jy, Jz
 
             // iDim = 2 local
             int nFieldLocalz = vecPatches.densitiesLocalz.size()/3;
@@ -518,13 +395,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
             }
 
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1) {
-                unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
-            }
+            vecPatches.densitiesMPIaggr[2].finalize(); // Jx, Jy, Jz
             // END iDim = 2 sync
             // -----------------
 
@@ -679,7 +550,7 @@ void SyncVectorPatch::exchange_along_all_directions( std::vector<Field*> fields,
 
 
     unsigned int nx_, ny_(1), nz_(1), h0, oversize[3], n_space[3], gsp[3];
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize[0] = vecPatches(0)->EMfields->oversize[0];
@@ -706,8 +577,8 @@ void SyncVectorPatch::exchange_along_all_directions( std::vector<Field*> fields,
         if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
             pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])((n_space[0])*ny_*nz_);
             pt2 = &(*fields[ipatch])(0);
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof(double));
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof(double));
+            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof(field_t));
+            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof(field_t));
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
 
         if (fields[0]->dims_.size()>1) {
@@ -766,7 +637,7 @@ void SyncVectorPatch::exchange_along_all_directions_noomp( std::vector<Field*> f
 
 
     unsigned int nx_, ny_(1), nz_(1), h0, oversize[3], n_space[3], gsp[3];
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize[0] = vecPatches(0)->EMfields->oversize[0];
@@ -792,8 +663,8 @@ void SyncVectorPatch::exchange_along_all_directions_noomp( std::vector<Field*> f
         if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
             pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])((n_space[0])*ny_*nz_);
             pt2 = &(*fields[ipatch])(0);
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof(double));
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof(double));
+            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof(field_t));
+            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof(field_t));
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
 
         if (fields[0]->dims_.size()>1) {
@@ -847,7 +718,7 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field*> f
 {
 
     unsigned int nx_, ny_(1), nz_(1), h0, oversize[3], n_space[3], gsp[3];
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize[0] = vecPatches(0)->EMfields->oversize[0];
@@ -948,8 +819,8 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field*> f
         if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
             pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])((n_space[0])*ny_*nz_);
             pt2 = &(*fields[ipatch])(0);
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof(double));
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof(double));
+            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof(field_t));
+            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof(field_t));
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
 
     } // End for( ipatch )
@@ -966,17 +837,11 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field*> f
 //     - These fields are identified with lists of index MPIxIdx and LocalxIdx
 void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
-    unsigned int nMPIx = vecPatches.MPIxIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->initExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches(ipatch)->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
-    }
+    vecPatches.B_MPIaggr[0].init(); // By, Bz
 
 
     unsigned int h0, oversize, n_space;
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize = vecPatches(0)->EMfields->oversize[0];
@@ -1004,12 +869,15 @@ void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field*>& fiel
         for (unsigned int ifield=istart ; ifield<iend ; ifield++) {
             int ipatch = vecPatches.LocalxIdx[ ifield-icomp*nFieldLocalx ];
 
+            // Ghost cells shared with the neighbor in the grid of the MPI process (Main.supergrid)
+            if ( vecPatches.supergrid_.sharesXmin( ipatch ) )
+                continue;
             if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
                 pt1 = &(fields[vecPatches(ipatch)->neighbor_[0][0]-h0+icomp*nPatches]->data_[n_space*ny_*nz_]);
                 pt2 = &(vecPatches.B_localx[ifield]->data_[0]);
                 //for filter
-                memcpy( pt2, pt1, oversize*ny_*nz_*sizeof(double));
-                memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof(double));
+                memcpy( pt2, pt1, oversize*ny_*nz_*sizeof(field_t));
+                memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof(field_t));
             } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
 
         } // End for( ipatch )
@@ -1020,13 +888,7 @@ void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field*>& fiel
 // MPI_Wait for all communications initialised in exchange_all_components_along_X
 void SyncVectorPatch::finalize_exchange_all_components_along_X( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
-    unsigned int nMPIx = vecPatches.MPIxIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
-    }
+    vecPatches.B_MPIaggr[0].finalize(); // By, Bz
 }
 
 
@@ -1039,16 +901,10 @@ void SyncVectorPatch::finalize_exchange_all_components_along_X( std::vector<Fiel
 //     - These fields are identified with lists of index MPIyIdx and LocalyIdx
 void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
-    unsigned int nMPIy = vecPatches.MPIyIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIy ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches(ipatch)->initExchange( vecPatches.B1_MPIy[ifield], 1 );   // Bx
-        vecPatches(ipatch)->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
-    }
+    vecPatches.B_MPIaggr[1].init(); // Bx, Bz
 
     unsigned int h0, oversize, n_space;
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize = vecPatches(0)->EMfields->oversize[1];
@@ -1061,8 +917,7 @@ void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field*>& fiel
     for ( int icomp=0 ; icomp<2 ; icomp++ ) {
         if (nFieldLocaly==0) continue;
 
-        unsigned int nx_, ny_, nz_(1), gsp;
-        nx_ = vecPatches.B1_localy[icomp*nFieldLocaly]->dims_[0];
+        unsigned int ny_, nz_(1), gsp;
         ny_ = vecPatches.B1_localy[icomp*nFieldLocaly]->dims_[1];
         if (nDim>2)
             nz_ = vecPatches.B1_localy[icomp*nFieldLocaly]->dims_[2];
@@ -1078,7 +933,10 @@ void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field*>& fiel
             if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[1][0]){
                 pt1 = &(fields[vecPatches(ipatch)->neighbor_[1][0]-h0+icomp*nPatches]->data_[n_space*nz_]);
                 pt2 = &(vecPatches.B1_localy[ifield]->data_[0]);
-                for (unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_){
+                // Rows shared with the neighbors in the grid of the MPI process written by their owner only
+                unsigned int first, last;
+                vecPatches.supergrid_.ownedRows( ipatch, vecPatches.B1_localy[ifield], first, last );
+                for (unsigned int i = first*ny_*nz_ ; i < last*ny_*nz_ ; i += ny_*nz_){
                     // for filter
                     for (unsigned int j = 0 ; j < oversize*nz_ ; j++ ){
                         pt2[i+j] = pt1[i+j] ;
@@ -1095,13 +953,7 @@ void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field*>& fiel
 // MPI_Wait for all communications initialised in exchange_all_components_along_Y
 void SyncVectorPatch::finalize_exchange_all_components_along_Y( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
-    unsigned int nMPIy = vecPatches.MPIyIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIy ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
-    }
+    vecPatches.B_MPIaggr[1].finalize(); // Bx, Bz
 
 
 }
@@ -1116,16 +968,10 @@ void SyncVectorPatch::finalize_exchange_all_components_along_Y( std::vector<Fiel
 //     - These fields are identified with lists of index MPIzIdx and LocalzIdx
 void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
-    unsigned int nMPIz = vecPatches.MPIzIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIz ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches(ipatch)->initExchange( vecPatches.B2_MPIz[ifield],       2 ); // Bx
-        vecPatches(ipatch)->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
-    }
+    vecPatches.B_MPIaggr[2].init(); // Bx, By
 
     unsigned int h0, oversize, n_space;
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize = vecPatches(0)->EMfields->oversize[2];
@@ -1137,8 +983,7 @@ void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field*> field
     for ( int icomp=0 ; icomp<2 ; icomp++ ) {
         if (nFieldLocalz==0) continue;
 
-        unsigned int nx_, ny_, nz_, gsp;
-        nx_ = vecPatches.B2_localz[icomp*nFieldLocalz]->dims_[0];
+        unsigned int ny_, nz_, gsp;
         ny_ = vecPatches.B2_localz[icomp*nFieldLocalz]->dims_[1];
         nz_ = vecPatches.B2_localz[icomp*nFieldLocalz]->dims_[2];
         //for filter
@@ -1153,7 +998,10 @@ void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field*> field
             if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[2][0]){
                 pt1 = &(fields[vecPatches(ipatch)->neighbor_[2][0]-h0+icomp*nPatches]->data_[n_space]);
                 pt2 = &(vecPatches.B2_localz[ifield]->data_[0]);
-                for (unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_){
+                // Rows shared with the neighbors in the grid of the MPI process written by their owner only
+                unsigned int first, last;
+                vecPatches.supergrid_.ownedRows( ipatch, vecPatches.B2_localz[ifield], first, last );
+                for (unsigned int i = first*ny_*nz_ ; i < last*ny_*nz_ ; i += ny_*nz_){
                     for (unsigned int j = 0 ; j < ny_*nz_ ; j += nz_){
                         for (unsigned int k = 0 ; k < oversize ; k++ ){
                             pt2[i+j+k] = pt1[i+j+k] ;
@@ -1170,13 +1018,7 @@ void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field*> field
 // MPI_Wait for all communications initialised in exchange_all_components_along_Z
 void SyncVectorPatch::finalize_exchange_all_components_along_Z( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
-    unsigned int nMPIz = vecPatches.MPIzIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIz ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
-    }
+    vecPatches.B_MPIaggr[2].finalize(); // Bx, By
 
 }
 
@@ -1194,7 +1036,7 @@ void SyncVectorPatch::exchange_along_X( std::vector<Field*> fields, VectorPatch&
         vecPatches(ipatch)->initExchange( fields[ipatch], 0 );
 
     unsigned int ny_(1), nz_(1), h0, oversize, n_space, gsp;
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize = vecPatches(0)->EMfields->oversize[0];
@@ -1217,11 +1059,11 @@ void SyncVectorPatch::exchange_along_X( std::vector<Field*> fields, VectorPatch&
         if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
             pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])(n_space*ny_*nz_);
             pt2 = &(*fields[ipatch])(0);
-            //memcpy( pt2, pt1, ny_*sizeof(double));
-            //memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, ny_*sizeof(double));
+            //memcpy( pt2, pt1, ny_*sizeof(field_t));
+            //memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, ny_*sizeof(field_t));
             //for filter
-            memcpy( pt2, pt1, oversize*ny_*nz_*sizeof(double));
-            memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof(double));
+            memcpy( pt2, pt1, oversize*ny_*nz_*sizeof(field_t));
+            memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof(field_t));
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
 
 
@@ -1244,7 +1086,7 @@ void SyncVectorPatch::exchange_along_Y( std::vector<Field*> fields, VectorPatch&
         vecPatches(ipatch)->initExchange( fields[ipatch], 1 );
 
     unsigned int nx_, ny_, nz_(1), h0, oversize, n_space, gsp;
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize = vecPatches(0)->EMfields->oversize[1];
@@ -1293,7 +1135,7 @@ void SyncVectorPatch::exchange_along_Z( std::vector<Field*> fields, VectorPatch&
         vecPatches(ipatch)->initExchange( fields[ipatch], 2 );
 
     unsigned int nx_, ny_, nz_, h0, oversize, n_space, gsp;
-    double *pt1,*pt2;
+    field_t *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
     oversize = vecPatches(0)->EMfields->oversize[2];
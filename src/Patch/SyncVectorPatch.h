@@ -14,13 +14,16 @@ class SyncVectorPatch {
 public :
 
     //! Particles synchronization
-    static void exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, Timers &timers, int itime);
-    static void finalize_and_sort_parts(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, Timers &timers, int itime);
+    static void exchangeParticles(VectorPatch& vecPatches, std::vector<unsigned int>& species, Params &params, SmileiMPI* smpi, Timers &timers, int itime);
+    static void finalize_and_sort_parts(VectorPatch& vecPatches, std::vector<unsigned int>& species, Params &params, SmileiMPI* smpi, Timers &timers, int itime);
 
     //! Densities synchronization
     static void sumRhoJ  ( Params& params, VectorPatch& vecPatches, Timers &timers, int itime );
     static void sumRhoJs ( Params& params, VectorPatch& vecPatches, int ispec, Timers &timers, int itime );
     static void sum      ( std::vector<Field*> fields, VectorPatch& vecPatches, Timers &timers, int itime );
+    static void sum_noomp( std::vector<Field*> fields, VectorPatch& vecPatches );
+    //! Local part of sum and sum_noomp : ghost cells of fields[ifield] along iDim summed with the previous patch
+    static void sumLocal ( std::vector<Field*>& fields, VectorPatch& vecPatches, unsigned int ifield, unsigned int iDim );
     static void sum_all_components ( std::vector<Field*>& fields, VectorPatch& vecPatches, Timers &timers, int itime );
 
     //! Fields synchronization
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <cstring>
 #include <math.h>
+#include <set>
 //#include <string>
 
 #include "Collisions.h"
@@ -19,6 +20,8 @@
 #include "DiagnosticFactory.h"
 
 #include "SyncVectorPatch.h"
+#include "PoissonMultigrid.h"
+#include "Domain.h"
 #include "interface.h"
 #include "Timers.h"
 
@@ -28,12 +31,18 @@ using namespace std;
 VectorPatch::VectorPatch()
 {
     domain_decomposition_ = NULL ;
+    aggr_comm_ = MPI_COMM_NULL;
+    particles_comm_ = MPI_COMM_NULL;
+    hybrid_communication_ = false;
 }
 
 
 VectorPatch::VectorPatch( Params& params )
 {
     domain_decomposition_ = DomainDecompositionFactory::create( params );
+    aggr_comm_ = MPI_COMM_NULL;
+    particles_comm_ = MPI_COMM_NULL;
+    hybrid_communication_ = params.hybrid_communication;
 }
 
 
@@ -74,6 +83,65 @@ void VectorPatch::close(SmileiMPI * smpiData)
         delete patches_[ipatch];
 
     patches_.clear();
+    // After the patches, whose fields may be views of the grid
+    supergrid_.clean();
+
+    freeNeighborsComm();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create the graph communicators of the MPI processes owning a neighbor (face, edge or corner) of a local patch
+//   - called by all MPI processes when patches are created or exchanged (load balancing), before update_field_list
+//   - the moving window does not change the MPI neighbors of the patches
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::updateNeighborsComm(SmileiMPI* smpi)
+{
+    freeNeighborsComm();
+
+    set<int> ranks;
+    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++) {
+        Patch* patch = (*this)(ipatch);
+        for (unsigned int iDim=0 ; iDim<patch->MPI_neighbor_.size() ; iDim++)
+            for (int iNeighbor=0 ; iNeighbor<patch->nbNeighbors_ ; iNeighbor++)
+                if ( patch->is_a_MPI_neighbor( iDim, iNeighbor ) )
+                    ranks.insert( patch->MPI_neighbor_[iDim][iNeighbor] );
+        for (unsigned int ineighbor=0 ; ineighbor<patch->MPI_particle_neighbor_.size() ; ineighbor++)
+            if ( ( patch->MPI_particle_neighbor_[ineighbor] != MPI_PROC_NULL )
+              && ( patch->MPI_particle_neighbor_[ineighbor] != patch->MPI_me_ ) )
+                ranks.insert( patch->MPI_particle_neighbor_[ineighbor] );
+    }
+    vector<int> neighbors( ranks.begin(), ranks.end() );
+
+    aggr_comm_ = smpi->createNeighborsComm( neighbors );
+    MPI_Comm_dup( aggr_comm_, &particles_comm_ );
+
+    // 1 communicator per thread, as many on all MPI processes so that they agree on the partitions of the messages
+    if ( hybrid_communication_ ) {
+        int nthreads = smpi->getOMPMaxThreads();
+        MPI_Allreduce( MPI_IN_PLACE, &nthreads, 1, MPI_INT, MPI_MAX, smpi->getGlobalComm() );
+        thread_comms_.resize( nthreads );
+        for ( int ithread=0 ; ithread<nthreads ; ithread++ )
+            MPI_Comm_dup( aggr_comm_, &thread_comms_[ithread] );
+    }
+
+} // END updateNeighborsComm
+
+
+void VectorPatch::freeNeighborsComm()
+{
+    for ( unsigned int iDim=0 ; iDim<3 ; iDim++ ) {
+        densitiesMPIaggr[iDim].clear();
+        B_MPIaggr[iDim].clear();
+    }
+    particlesCountsMPIaggr.clear();
+    if ( aggr_comm_ != MPI_COMM_NULL )
+        MPI_Comm_free( &aggr_comm_ );
+    if ( particles_comm_ != MPI_COMM_NULL )
+        MPI_Comm_free( &particles_comm_ );
+    for ( unsigned int ithread=0 ; ithread<thread_comms_.size() ; ithread++ )
+        MPI_Comm_free( &thread_comms_[ithread] );
+    thread_comms_.clear();
 }
 
 void VectorPatch::createDiags(Params& params, SmileiMPI* smpi, OpenPMDparams& openPMD)
@@ -107,6 +175,9 @@ void VectorPatch::createDiags(Params& params, SmileiMPI* smpi, OpenPMDparams& op
                 (*this)(ipatch)->EMfields->rho_s[ifield]=NULL;
             }
         }
+        // The others are allocated only on the timesteps where a diagnostic needs them
+        if( !diag_flag )
+            (*this)(ipatch)->EMfields->deallocateRhoJs();
     }
 
     for ( unsigned int idiag = 0 ;  idiag < globalDiags.size() ; idiag++ )
@@ -143,32 +214,53 @@ void VectorPatch::dynamics(Params& params,
     #pragma omp single
     diag_flag = needsRhoJsNow(itime);
 
+    // Currents are summed along X as soon as the patches with an MPI neighbor along X are computed,
+    // the other patches are computed while messages are in flight (not if computeTotalRhoJ still modifies J)
+    bool early_sum = ( !diag_flag ) && ( someSpeciesAreProjected( time_dual, simWindow ) );
+
     timers.particles.restart();
     ostringstream t;
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
-        (*this)(ipatch)->EMfields->restartRhoJ();
-        for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
-            if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
-                species(ipatch, ispec)->dynamics(time_dual, ispec,
-                                                 emfields(ipatch), interp(ipatch), proj(ipatch),
-                                                 params, diag_flag, partwalls(ipatch),
-                                                 (*this)(ipatch), smpi,
-                                                 RadiationTables,
-                                                 MultiphotonBreitWheelerTables,
-                                                 localDiags);
+    for (unsigned int ipass=0 ; ipass<2 ; ipass++) {
+        std::vector<int>& patches = ( ipass==0 ? MPIxIdx : InnerxIdx );
+        #pragma omp for schedule(runtime)
+        for (unsigned int ip=0 ; ip<patches.size() ; ip++) {
+            unsigned int ipatch = patches[ip];
+            (*this)(ipatch)->EMfields->restartRhoJ();
+            // Fields per species only live on the timesteps where a diagnostic needs them
+            if( diag_flag )
+                (*this)(ipatch)->EMfields->allocateRhoJs();
+            else
+                (*this)(ipatch)->EMfields->deallocateRhoJs();
+            // Only the fields are at work in a patch without particles
+            if ( (*this)(ipatch)->is_empty )
+                continue;
+            for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
+                if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
+                    species(ipatch, ispec)->dynamics(time_dual, ispec,
+                                                     emfields(ipatch), interp(ipatch), proj(ipatch),
+                                                     params, diag_flag, partwalls(ipatch),
+                                                     (*this)(ipatch), smpi,
+                                                     RadiationTables,
+                                                     MultiphotonBreitWheelerTables,
+                                                     localDiags);
+                }
             }
-        }
 
+        }
+        if ( ipass==0 && early_sum )
+            densitiesMPIaggr[0].init();
     }
     timers.particles.update( params.printNow( itime ) );
 
     timers.syncPart.restart();
+    // All species exchanged at once, one message per neighbor
+    std::vector<unsigned int> exchanged_species;
     for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size(); ispec++) {
-        if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) ){
-            SyncVectorPatch::exchangeParticles((*this), ispec, params, smpi, timers, itime ); // Included sort_part
-        }
+        if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) )
+            exchanged_species.push_back( ispec );
     }
+    if ( exchanged_species.size() )
+        SyncVectorPatch::exchangeParticles((*this), exchanged_species, params, smpi, timers, itime );
     timers.syncPart.update( params.printNow( itime ) );
 
 } // END dynamics
@@ -180,26 +272,32 @@ void VectorPatch::finalize_and_sort_parts(Params& params, SmileiMPI* smpi, SimWi
                            double time_dual, Timers &timers, int itime)
 {
     timers.syncPart.restart();
+    std::vector<unsigned int> exchanged_species;
     for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size(); ispec++) {
-        if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) ){
-            SyncVectorPatch::finalize_and_sort_parts((*this), ispec, params, smpi, timers, itime ); // Included sort_part
-        }
+        if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) )
+            exchanged_species.push_back( ispec );
     }
+    if ( exchanged_species.size() )
+        SyncVectorPatch::finalize_and_sort_parts((*this), exchanged_species, params, smpi, timers, itime ); // Included sort_part
 
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
         // Particle importation for all species
-        for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
-            if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
-
-                species(ipatch, ispec)->dynamics_import_particles(time_dual, ispec,
-                                                                  params,
-                                                                  (*this)(ipatch), smpi,
-                                                                  RadiationTables,
-                                                                  MultiphotonBreitWheelerTables,
-                                                                  localDiags);
+        if ( !(*this)(ipatch)->is_empty ) {
+            for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
+                if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
+
+                    species(ipatch, ispec)->dynamics_import_particles(time_dual, ispec,
+                                                                      params,
+                                                                      (*this)(ipatch), smpi,
+                                                                      RadiationTables,
+                                                                      MultiphotonBreitWheelerTables,
+                                                                      localDiags);
+                }
             }
         }
+        // Particles may have been received from the neighbours or imported
+        (*this)(ipatch)->updateEmpty();
     }
 
     if (itime%params.every_clean_particles_overhead==0) {
@@ -218,6 +316,8 @@ void VectorPatch::computeCharge()
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
         (*this)(ipatch)->EMfields->restartRhoJ();
+        if ( (*this)(ipatch)->is_empty )
+            continue;
         for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
             species(ipatch, ispec)->computeCharge(ispec, emfields(ipatch), proj(ipatch) );
         }
@@ -254,12 +354,7 @@ void VectorPatch::resetRhoJ()
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::sumDensities(Params &params, double time_dual, Timers &timers, int itime, SimWindow* simWindow )
 {
-    bool some_particles_are_moving = false;
-    unsigned int n_species( (*this)(0)->vecSpecies.size() );
-    for ( unsigned int ispec=0 ; ispec < n_species ; ispec++ ) {
-        if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) )
-            some_particles_are_moving = true;
-    }
+    bool some_particles_are_moving = someSpeciesAreProjected( time_dual, simWindow );
     if ( !some_particles_are_moving  && !diag_flag )
         return;
 
@@ -267,6 +362,7 @@ void VectorPatch::sumDensities(Params &params, double time_dual, Timers &timers,
     if  (diag_flag){
         #pragma omp for schedule(static)
         for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
+            (*this)(ipatch)->EMfields->allocateRhoJs();
              // Per species in global, Attention if output -> Sync / per species fields
             (*this)(ipatch)->EMfields->computeTotalRhoJ();
         }
@@ -306,19 +402,45 @@ void VectorPatch::solveMaxwell(Params& params, SimWindow* simWindow, int itime,
         SyncVectorPatch::finalizeexchangeJ( params, (*this) );
     }
 
-    #pragma omp for schedule(static)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
-        if (!params.is_spectral) {
-            // Saving magnetic fields (to compute centered fields used in the particle pusher)
-            // Stores B at time n in B_m.
-            (*this)(ipatch)->EMfields->saveMagneticFields(params.is_spectral);
+    // B is exchanged along X as soon as the patches with an MPI neighbor along X are computed,
+    // the other patches are computed while messages are in flight (exchange_all_components_along_X)
+    bool early_exchange = ( listBx_[0]->dims_.size()==1 ) || ( !params.full_B_exchange );
+
+    if ( supergrid_.isActive() ) {
+        // Maxwell solved once on the grid of the patches, their currents are copied in the grid before
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
+            supergrid_.copyCurrents( ipatch, (*this)(ipatch)->EMfields );
+        supergrid_.solveMaxwell( *this );
+        if ( early_exchange )
+            B_MPIaggr[0].init();
+    }
+    else {
+        for (unsigned int ipass=0 ; ipass<2 ; ipass++) {
+            std::vector<int>& patches = ( ipass==0 ? MPIxIdx : InnerxIdx );
+            #pragma omp for schedule(static)
+            for (unsigned int ip=0 ; ip<patches.size() ; ip++){
+                unsigned int ipatch = patches[ip];
+                // Computes Ex_, Ey_, Ez_ on all points.
+                // E is already synchronized because J has been synchronized before.
+                (*(*this)(ipatch)->EMfields->MaxwellAmpereSolver_)((*this)(ipatch)->EMfields);
+                if (params.has_pml)
+                    (*this)(ipatch)->EMfields->applyPML_E((*this)(ipatch));
+                if (!params.is_spectral) {
+                    // Saving magnetic fields (to compute centered fields used in the particle pusher)
+                    // Stores B at time n in B_m (after Maxwell-Ampere, which reads B, as B may be swapped with B_m)
+                    (*this)(ipatch)->EMfields->saveMagneticFields(params.is_spectral);
+                }
+                // Computes Bx_, By_, Bz_ at time n+1 on interior points.
+                //for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
+                (*(*this)(ipatch)->EMfields->MaxwellFaradaySolver_)((*this)(ipatch)->EMfields);
+                // PML corrections before the synchronization of B
+                if (params.has_pml)
+                    (*this)(ipatch)->EMfields->applyPML_B((*this)(ipatch));
+            }
+            if ( ipass==0 && early_exchange )
+                B_MPIaggr[0].init();
         }
-        // Computes Ex_, Ey_, Ez_ on all points.
-        // E is already synchronized because J has been synchronized before.
-        (*(*this)(ipatch)->EMfields->MaxwellAmpereSolver_)((*this)(ipatch)->EMfields);
-        // Computes Bx_, By_, Bz_ at time n+1 on interior points.
-        //for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
-        (*(*this)(ipatch)->EMfields->MaxwellFaradaySolver_)((*this)(ipatch)->EMfields);
     }
 
     //Synchronize B fields between patches.
@@ -330,9 +452,8 @@ void VectorPatch::solveMaxwell(Params& params, SimWindow* simWindow, int itime,
     SyncVectorPatch::exchangeB( params, (*this) );
     timers.syncField.update(  params.printNow( itime ) );
 
-    #ifdef _PICSAR
     //if ( (params.is_spectral) && (itime!=0) && ( time_dual > params.time_fields_frozen ) ) {
-    if (                           (itime!=0) && ( time_dual > params.time_fields_frozen ) ) {
+    if ( (params.uncoupled_grids) && (itime!=0) && ( time_dual > params.time_fields_frozen ) ) {
         timers.syncField.restart();
         if (params.is_spectral)
             SyncVectorPatch::finalizeexchangeE( params, (*this) );
@@ -353,7 +474,6 @@ void VectorPatch::solveMaxwell(Params& params, SimWindow* simWindow, int itime,
         if (params.is_spectral)
             save_old_rho( params );
     }
-    #endif
 
 
 } // END solveMaxwell
@@ -362,25 +482,55 @@ void VectorPatch::solveMaxwell(Params& params, SimWindow* simWindow, int itime,
 void VectorPatch::finalize_sync_and_bc_fields(Params& params, SmileiMPI* smpi, SimWindow* simWindow,
                            double time_dual, Timers &timers, int itime)
 {
-    #ifndef _PICSAR
-    if ( (!params.is_spectral) && (itime!=0) && ( time_dual > params.time_fields_frozen ) ) {
+    if ( (!params.uncoupled_grids) && (!params.is_spectral) && (itime!=0) && ( time_dual > params.time_fields_frozen ) ) {
         timers.syncField.restart();
         SyncVectorPatch::finalizeexchangeB( params, (*this) );
         timers.syncField.update(  params.printNow( itime ) );
 
-        #pragma omp for schedule(static)
-        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
-            // Applies boundary conditions on B
-            (*this)(ipatch)->EMfields->boundaryConditions(itime, time_dual, (*this)(ipatch), params, simWindow);
-            // Computes B at time n using B and B_m.
-            (*this)(ipatch)->EMfields->centerMagneticFields();
+        if ( supergrid_.isActive() ) {
+            // Neighbor patches of the grid share ghost cells : boundary conditions applied on every other patch at
+            // a time, B centered once on the grid
+            for (unsigned int parity=0 ; parity<2 ; parity++) {
+                #pragma omp for schedule(static)
+                for (unsigned int ip=parity ; ip<supergrid_.size() ; ip+=2){
+                    unsigned int ipatch = supergrid_.patch( ip );
+                    (*this)(ipatch)->EMfields->boundaryConditions(itime, time_dual, (*this)(ipatch), params, simWindow);
+                }
+            }
+            supergrid_.centerMagneticFields();
+        }
+        else {
+            #pragma omp for schedule(static)
+            for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
+                // Applies boundary conditions on B
+                (*this)(ipatch)->EMfields->boundaryConditions(itime, time_dual, (*this)(ipatch), params, simWindow);
+                // Computes B at time n using B and B_m.
+                (*this)(ipatch)->EMfields->centerMagneticFields();
+            }
         }
     }
-    #endif
 
 } // END finalize_sync_and_bc_fields
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Gather E and B of the patches in one grid per MPI process (Main.supergrid)
+//   - after the initialization of the fields (Poisson, external fields, restart), before the PIC loop
+//   - the lists of fields are updated : the exchanges along Y and Z write only the rows owned by each patch
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::buildSuperGrid( Params& params, SmileiMPI* smpi )
+{
+    int active = supergrid_.build( params, *this ) ? 1 : 0;
+    update_field_list();
+
+    int nactive( 0 );
+    MPI_Reduce( &active, &nactive, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD );
+    MESSAGE(1,"Fields gathered in one grid by " << nactive << " MPI processes out of " << smpi->getSize());
+    if ( nactive < smpi->getSize() )
+        MESSAGE(1,"The patches of the other MPI processes are not stacked along X (see number_of_patches)");
+}
+
+
 void VectorPatch::initExternals(Params& params)
 {
     // Init all lasers
@@ -398,7 +548,11 @@ void VectorPatch::initExternals(Params& params)
         }
     }
 
-    // Init all antennas
+    // Init all antennas (in parallel if no profile calls python)
+    bool python = false;
+    for( unsigned int iAntenna=0; iAntenna<(*this)(0)->EMfields->antennas.size(); iAntenna++ )
+        python = python || (*this)(0)->EMfields->antennas[iAntenna].space_profile->usesPython();
+    #pragma omp parallel for schedule(dynamic) if( !python )
     for( unsigned int ipatch=0; ipatch<size(); ipatch++ ) {
         (*this)(ipatch)->EMfields->initAntennas((*this)(ipatch));
     }
@@ -527,7 +681,7 @@ bool VectorPatch::isRhoNull( SmileiMPI* smpi )
 // Solve Poisson to initialize E
 //   - all steps are done locally, sync per patch, sync per MPI process
 // ---------------------------------------------------------------------------------------------------------------------
-void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
+void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi, Domain* domain )
 {
     Timer ptimer("global");
     ptimer.init(smpi);
@@ -547,6 +701,12 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
     }
     MPI_Allreduce(&rnew_dot_rnew_local, &rnew_dot_rnew, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
+    // Direct solver : phi is computed with FFTs on the Domain, no iteration
+    if ( domain ) {
+        domain->solvePoisson( params, smpi, *this );
+        iteration_max = 0;
+    }
+
     std::vector<Field*> Ex_;
     std::vector<Field*> Ap_;
 
@@ -555,6 +715,23 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
         Ap_.push_back( (*this)(ipatch)->EMfields->Ap_ );
     }
 
+    // Multigrid preconditioner : the first direction is p = z = M^-1 r
+    bool preconditioned = ( params.poisson_solver == "multigrid_CG" || params.poisson_solver == "multigrid" );
+    PoissonMultigrid* coarse_mg = NULL;
+    std::vector<Field*> z_;
+    double r_dot_z(0.);
+    if ( preconditioned ) {
+        vector<double> coef( params.nDim_field );
+        for (unsigned int i=0 ; i<params.nDim_field ; i++)
+            coef[i] = 1.0/(params.cell_length[i]*params.cell_length[i]);
+        coarse_mg = initPoissonPreconditioner( params, coef );
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            z_.push_back( (*this)(ipatch)->EMfields->z_ );
+        r_dot_z = applyPoissonPreconditioner( params, coarse_mg, z_ );
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            (*this)(ipatch)->EMfields->update_p_preconditioned( 0., r_dot_z );
+    }
+
     unsigned int nx_p2_global = (params.n_space_global[0]+1);
     if ( Ex_[0]->dims_.size()>1 ) {
         nx_p2_global *= (params.n_space_global[1]+1);
@@ -595,7 +772,7 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
 
         // compute new potential and residual
         for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            (*this)(ipatch)->EMfields->update_pand_r( r_dot_r, p_dot_Ap );
+            (*this)(ipatch)->EMfields->update_pand_r( preconditioned ? r_dot_z : r_dot_r, p_dot_Ap );
         }
 
         // compute new residual norm
@@ -608,8 +785,19 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
         if (smpi->isMaster()) DEBUG("new residual norm: rnew_dot_rnew = " << rnew_dot_rnew);
 
         // compute new directio
-        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            (*this)(ipatch)->EMfields->update_p( rnew_dot_rnew, r_dot_r );
+        if ( preconditioned ) {
+            double rnew_dot_znew = applyPoissonPreconditioner( params, coarse_mg, z_ );
+            // standalone multigrid : no conjugation, each iteration is an optimally damped multigrid correction
+            double beta_numerator = ( params.poisson_solver == "multigrid" ) ? 0. : rnew_dot_znew;
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                (*this)(ipatch)->EMfields->update_p_preconditioned( beta_numerator, r_dot_z );
+            }
+            r_dot_z = rnew_dot_znew;
+        }
+        else {
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                (*this)(ipatch)->EMfields->update_p( rnew_dot_rnew, r_dot_r );
+            }
         }
 
         // compute control parameter
@@ -618,11 +806,18 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
 
     }//End of the iterative loop
 
+    if ( preconditioned )
+        deletePoissonPreconditioner( coarse_mg );
+
 
     // --------------------------------
     // Status of the solver convergence
     // --------------------------------
-    if (iteration_max>0 && iteration == iteration_max) {
+    if ( domain ) {
+        if (smpi->isMaster())
+            MESSAGE(1,"Poisson equation solved with FFTs");
+    }
+    else if (iteration_max>0 && iteration == iteration_max) {
         if (smpi->isMaster())
             WARNING("Poisson solver did not converge: reached maximum iteration number: " << iteration
                     << ", relative err is ctrl = " << 1.0e14*ctrl << " x 1e-14");
@@ -865,6 +1060,24 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI* smpi, dou
         Ap_.push_back( (*this)(ipatch)->EMfields->Ap_ );
     }
 
+    // Multigrid preconditioner : the first direction is p = z = M^-1 r
+    bool preconditioned = ( params.poisson_solver == "multigrid_CG" || params.poisson_solver == "multigrid" );
+    PoissonMultigrid* coarse_mg = NULL;
+    std::vector<Field*> z_;
+    double r_dot_z(0.);
+    if ( preconditioned ) {
+        vector<double> coef( params.nDim_field );
+        for (unsigned int i=0 ; i<params.nDim_field ; i++)
+            coef[i] = 1.0/(params.cell_length[i]*params.cell_length[i]);
+        coef[0] /= gamma_mean*gamma_mean;
+        coarse_mg = initPoissonPreconditioner( params, coef );
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            z_.push_back( (*this)(ipatch)->EMfields->z_ );
+        r_dot_z = applyPoissonPreconditioner( params, coarse_mg, z_ );
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            (*this)(ipatch)->EMfields->update_p_preconditioned( 0., r_dot_z );
+    }
+
     unsigned int nx_p2_global = (params.n_space_global[0]+1);
     //if ( Ex_[0]->dims_.size()>1 ) {
     if ( Ex_rel_[0]->dims_.size()>1 ) {
@@ -914,7 +1127,7 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI* smpi, dou
 
         // compute new potential and residual
         for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            (*this)(ipatch)->EMfields->update_pand_r( r_dot_r, p_dot_Ap );
+            (*this)(ipatch)->EMfields->update_pand_r( preconditioned ? r_dot_z : r_dot_r, p_dot_Ap );
         }
 
         // compute new residual norm
@@ -927,8 +1140,19 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI* smpi, dou
         if (smpi->isMaster()) DEBUG("new residual norm: rnew_dot_rnew = " << rnew_dot_rnew);
 
         // compute new directio
-        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            (*this)(ipatch)->EMfields->update_p( rnew_dot_rnew, r_dot_r );
+        if ( preconditioned ) {
+            double rnew_dot_znew = applyPoissonPreconditioner( params, coarse_mg, z_ );
+            // standalone multigrid : no conjugation, each iteration is an optimally damped multigrid correction
+            double beta_numerator = ( params.poisson_solver == "multigrid" ) ? 0. : rnew_dot_znew;
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                (*this)(ipatch)->EMfields->update_p_preconditioned( beta_numerator, r_dot_z );
+            }
+            r_dot_z = rnew_dot_znew;
+        }
+        else {
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                (*this)(ipatch)->EMfields->update_p( rnew_dot_rnew, r_dot_r );
+            }
         }
 
         // compute control parameter
@@ -940,6 +1164,9 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI* smpi, dou
 
     }//End of the iterative loop
 
+    if ( preconditioned )
+        deletePoissonPreconditioner( coarse_mg );
+
 
     // --------------------------------
     // Status of the solver convergence
@@ -1152,6 +1379,91 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI* smpi, dou
 } // END solveRelativisticPoisson
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Multigrid preconditioner of the Poisson solvers
+//     - fine levels : V-cycle inside each patch (ElectroMagn::applyPoissonPreconditioner), the overlapping
+//       local solutions are summed on ghost cells as densities are
+//     - coarse level : the patches are agglomerated in a grid with one node per patch, this small problem
+//       is solved by the master MPI process : its residual is reduced and its correction broadcast, 1 value per
+//       patch of the whole simulation (2 collectives of number_of_patches doubles per application)
+// ---------------------------------------------------------------------------------------------------------------------
+PoissonMultigrid* VectorPatch::initPoissonPreconditioner( Params &params, std::vector<double> coef )
+{
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+        (*this)(ipatch)->EMfields->initPoissonPreconditioner( (*this)(ipatch), coef );
+    
+    // Coarse operator = R A R^T, with R the sum over the nodes owned by a patch :
+    // the coupling between 2 patches is the fine coupling times the number of nodes on their interface
+    vector<unsigned int> n( params.nDim_field );
+    vector<double> coarse_coef( params.nDim_field );
+    vector<int> bc( params.nDim_field );
+    for (unsigned int i=0 ; i<params.nDim_field ; i++) {
+        n[i] = params.number_of_patches[i];
+        coarse_coef[i] = coef[i];
+        for (unsigned int j=0 ; j<params.nDim_field ; j++)
+            if (j!=i) coarse_coef[i] *= params.n_space[j];
+        // same boundary conditions as compute_Ap
+        if ( params.EM_BCs[i][0] == "periodic" )
+            bc[i] = PoissonMultigrid::MG_PERIODIC;
+        else
+            bc[i] = PoissonMultigrid::MG_DIRICHLET;
+    }
+    
+    return new PoissonMultigrid( n, coarse_coef, bc );
+}
+
+double VectorPatch::applyPoissonPreconditioner( Params &params, PoissonMultigrid* coarse_mg, std::vector<Field*>& z )
+{
+    unsigned int ncoarse = 1;
+    vector<int> number_of_patches( 3, 1 );
+    vector<bool> periodic( 3, false );
+    for (unsigned int i=0 ; i<params.nDim_field ; i++) {
+        ncoarse *= params.number_of_patches[i];
+        number_of_patches[i] = params.number_of_patches[i];
+        periodic[i] = ( params.EM_BCs[i][0] == "periodic" );
+    }
+    
+    // Local V-cycles and restriction of the residual on the coarse grid
+    vector<double> coarse_residual_local( ncoarse, 0. ), coarse_residual( ncoarse, 0. ), coarse_correction( ncoarse, 0. );
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+        Patch* patch = (*this)(ipatch);
+        patch->EMfields->applyPoissonPreconditioner();
+        unsigned int icoarse = 0;
+        for (unsigned int i=0 ; i<params.nDim_field ; i++)
+            icoarse = icoarse*number_of_patches[i] + patch->Pcoordinates[i];
+        coarse_residual_local[icoarse] = patch->EMfields->restrictPoissonResidual();
+    }
+    MPI_Reduce(&coarse_residual_local[0], &coarse_residual[0], ncoarse, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+    
+    // Coarse problem, solved (almost) exactly by the master so that the preconditioner remains a fixed linear operator
+    int rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+    if ( rank == 0 )
+        coarse_mg->solve_pcg( &coarse_correction[0], &coarse_residual[0], 1.e-12, 1000 );
+    MPI_Bcast(&coarse_correction[0], ncoarse, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    
+    // Sum the local contributions on ghost cells (intra & extra MPI)
+    SyncVectorPatch::sum_noomp( z, *this );
+    
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+        (*this)(ipatch)->EMfields->addPoissonCoarseCorrection( (*this)(ipatch), coarse_correction, number_of_patches, periodic );
+    
+    double r_dot_z_local(0.), r_dot_z(0.);
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+        r_dot_z_local += (*this)(ipatch)->EMfields->compute_rz();
+    MPI_Allreduce(&r_dot_z_local, &r_dot_z, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    
+    return r_dot_z;
+}
+
+void VectorPatch::deletePoissonPreconditioner( PoissonMultigrid* coarse_mg )
+{
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+        (*this)(ipatch)->EMfields->deletePoissonPreconditioner();
+    delete coarse_mg;
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------    BALANCING METHODS    ----------------------------------------------
@@ -1318,12 +1630,14 @@ void VectorPatch::exchangePatches(SmileiMPI* smpi, Params& params)
 
     for (unsigned int ipatch=0 ; ipatch<patches_.size() ; ipatch++ ) {
         (*this)(ipatch)->updateMPIenv(smpi);
+        (*this)(ipatch)->updateParticleNeighbors(domain_decomposition_, smpi);
         if ((*this)(ipatch)->has_an_MPI_neighbor())
             (*this)(ipatch)->createType(params);
          else
             (*this)(ipatch)->cleanType();
     }
     (*this).set_refHindex() ;
+    updateNeighborsComm(smpi);
     update_field_list() ;
 
 } // END exchangePatches
@@ -1379,6 +1693,7 @@ void VectorPatch::update_field_list()
     MPIxIdx.clear();
     MPIyIdx.clear();
     MPIzIdx.clear();
+    InnerxIdx.clear();
 
     listJx_.resize( size() ) ;
     listJy_.resize( size() ) ;
@@ -1436,6 +1751,9 @@ void VectorPatch::update_field_list()
         if ( (*this)(ipatch)->has_an_MPI_neighbor( 0 ) ) {
             MPIxIdx.push_back(ipatch);
         }
+        else {
+            InnerxIdx.push_back(ipatch);
+        }
         if ( (*this)(ipatch)->has_an_local_neighbor( 0 ) ) {
             LocalxIdx.push_back(ipatch);
         }
@@ -1555,6 +1873,19 @@ void VectorPatch::update_field_list()
 
         listrho_[ifields]->MPIbuff.defineTags( patches_[ifields], 4 );
     }
+
+    // Communicators created by updateNeighborsComm
+    densitiesMPIaggr[0].build( *this, densitiesMPIx, MPIxIdx, 3, 0, true,  aggr_comm_, thread_comms_ );
+    B_MPIaggr       [0].build( *this, B_MPIx,        MPIxIdx, 2, 0, false, aggr_comm_, thread_comms_ );
+    if (nDim>1) {
+        densitiesMPIaggr[1].build( *this, densitiesMPIy, MPIyIdx, 3, 1, true,  aggr_comm_, thread_comms_ );
+        B_MPIaggr       [1].build( *this, B1_MPIy,       MPIyIdx, 2, 1, false, aggr_comm_, thread_comms_ );
+        if (nDim>2) {
+            densitiesMPIaggr[2].build( *this, densitiesMPIz, MPIzIdx, 3, 2, true,  aggr_comm_, thread_comms_ );
+            B_MPIaggr       [2].build( *this, B2_MPIz,       MPIzIdx, 2, 2, false, aggr_comm_, thread_comms_ );
+        }
+    }
+    particlesCountsMPIaggr.build( *this, particles_comm_ );
 }
 
 
@@ -1658,6 +1989,11 @@ void VectorPatch::applyCollisions(Params& params, int itime, Timers & timers)
 // For each patch, apply external fields
 void VectorPatch::applyExternalFields()
 {
+    // Profiles evaluated without python (built-in or compiled) may be evaluated by several threads at once
+    bool python = false;
+    for (unsigned int iext=0 ; iext<patches_[0]->EMfields->extFields.size() ; iext++)
+        python = python || patches_[0]->EMfields->extFields[iext].profile->usesPython();
+    #pragma omp parallel for schedule(dynamic) if( !python )
     for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++)
         patches_[ipatch]->EMfields->applyExternalFields( (*this)(ipatch) ); // Must be patch
 }
@@ -1702,6 +2038,22 @@ void VectorPatch::check_memory_consumption(SmileiMPI* smpi)
     MPI_Reduce( smpi->isMaster()?MPI_IN_PLACE:&fieldsMem, &fieldsMem, 1, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD );
     MESSAGE( 1, "Max Fields part = " << (int)( (double)fieldsMem / 1024./1024.) << " MB" );
 
+    // Fields per species, allocated only on the timesteps where a diagnostic needs them
+    long int rhoJsMem(0);
+    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++)
+        rhoJsMem += patches_[ipatch]->EMfields->getRhoJsMemFootPrint();
+
+    long double dRhoJsMem = (double)rhoJsMem / 1024./1024./1024.;
+    MPI_Reduce( smpi->isMaster()?MPI_IN_PLACE:&dRhoJsMem, &dRhoJsMem, 1, MPI_LONG_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+    if (dRhoJsMem>0.) {
+        MESSAGE( 1, "(Master) Fields per species (diagnostic timesteps only) = " << (int)( (double)rhoJsMem / 1024./1024.) << " MB" );
+        MESSAGE( 1, setprecision(3) << "Global Fields per species (diagnostic timesteps only) = " << dRhoJsMem << " GB" );
+    }
+
+    MPI_Reduce( smpi->isMaster()?MPI_IN_PLACE:&rhoJsMem, &rhoJsMem, 1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD );
+    if (dRhoJsMem>0.)
+        MESSAGE( 1, "Max Fields per species (diagnostic timesteps only) = " << (int)( (double)rhoJsMem / 1024./1024.) << " MB" );
+
 
     for (unsigned int idiags=0 ; idiags<globalDiags.size() ; idiags++) {
         // fieldsMem contains field per species
@@ -1749,7 +2101,7 @@ void VectorPatch::save_old_rho(Params &params)
         for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
         n =  (*this)(ipatch)->EMfields->rhoold_->dims_[0]*(*this)(ipatch)->EMfields->rhoold_->dims_[1];//*(*this)(ipatch)->EMfields->rhoold_->dims_[2];
         if(params.nDim_field ==3) n*=(*this)(ipatch)->EMfields->rhoold_->dims_[2];
-                std::memcpy((*this)(ipatch)->EMfields->rhoold_->data_,(*this)(ipatch)->EMfields->rho_->data_,sizeof(double)*n);
+                std::memcpy((*this)(ipatch)->EMfields->rhoold_->data_,(*this)(ipatch)->EMfields->rho_->data_,sizeof(field_t)*n);
         }
 }
         
@@ -19,8 +19,12 @@
 #include "SimWindow.h"
 #include "Timers.h"
 #include "RadiationTables.h"
+#include "AggregatedMPIbuffers.h"
+#include "SuperGrid.h"
 
 class Field;
+class PoissonMultigrid;
+class Domain;
 class Timer;
 class SimWindow; 
 class DomainDecomposition;
@@ -65,6 +69,10 @@ public :
     inline void set_refHindex() {
         refHindex_ = patches_[0]->Hindex();
     }
+    //! Create the graph communicators of the neighboring MPI processes (patches created or exchanged)
+    void updateNeighborsComm(SmileiMPI* smpi);
+    //! Free the graph communicators
+    void freeNeighborsComm();
     //! Resize vector of field*
     void update_field_list();
     void update_field_list(int ispec);
@@ -88,6 +96,13 @@ public :
         return false;
     }
 
+    //! True if any species projects its currents at time_dual (else sumDensities has nothing to sum)
+    bool someSpeciesAreProjected( double time_dual, SimWindow* simWindow ) {
+        for( unsigned int ispec=0; ispec<(*this)(0)->vecSpecies.size(); ispec++ )
+            if( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) ) return true;
+        return false;
+    }
+
     // Interfaces between main programs & main PIC operators
     // -----------------------------------------------------
 
@@ -121,6 +136,9 @@ public :
     //! For all patch, update E and B (Ampere, Faraday, boundary conditions, exchange B and center B)
     void solveMaxwell(Params& params, SimWindow* simWindow, int itime, double time_dual,
                       Timers & timers);
+
+    //! Gather E and B of the patches in the grid supergrid_, if they are stacked along X (Main.supergrid)
+    void buildSuperGrid( Params& params, SmileiMPI* smpi );
     
     //! For all patch, Compute and Write all diags (Scalars, Probes, Phases, TrackParticles, Fields, Average fields)
     void runAllDiags(Params& params, SmileiMPI* smpi, unsigned int itime, Timers & timers, SimWindow* simWindow);
@@ -131,12 +149,18 @@ public :
     //! Check if rho is null (MPI & patch sync)
     bool isRhoNull( SmileiMPI* smpi );
 
-    //! Solve Poisson to initialize E
-    void solvePoisson( Params &params, SmileiMPI* smpi );
+    //! Solve Poisson to initialize E (with FFTs on the Domain if provided, else iteratively)
+    void solvePoisson( Params &params, SmileiMPI* smpi, Domain* domain = NULL );
 
     //! Solve relativistic Poisson problem to initialize E and B of a relativistic bunch
     void solveRelativisticPoisson( Params &params, SmileiMPI* smpi, double time_primal );
 
+    //! Init the multigrid preconditioner of the Poisson solvers in all patches, returns the agglomerated coarse grid
+    PoissonMultigrid* initPoissonPreconditioner( Params &params, std::vector<double> coef );
+    //! Compute z = M^-1 r in all patches (local V-cycles + coarse grid correction), returns the global r.z
+    double applyPoissonPreconditioner( Params &params, PoissonMultigrid* coarse_mg, std::vector<Field*>& z );
+    void deletePoissonPreconditioner( PoissonMultigrid* coarse_mg );
+
     //! For all patch initialize the externals (lasers, fields, antennas)
     void initExternals(Params& params);
 
@@ -185,6 +209,8 @@ public :
     std::vector<int> MPIxIdx;
     std::vector<int> MPIyIdx;
     std::vector<int> MPIzIdx;
+    //! Patches without MPI neighbor along X, computed after those of MPIxIdx to overlap their communications
+    std::vector<int> InnerxIdx;
 
     std::vector<Field*> B_localx;
     std::vector<Field*> B_MPIx;
@@ -195,6 +221,22 @@ public :
     std::vector<Field*> B2_localz;
     std::vector<Field*> B2_MPIz;
 
+    //! MPI sums of densitiesMPI and exchanges of B_MPI along each dimension, 1 message per MPI neighbor
+    AggregatedMPIbuffers densitiesMPIaggr[3];
+    AggregatedMPIbuffers B_MPIaggr[3];
+    //! Numbers of particles exchanged with MPI neighbors, 1 message per MPI neighbor
+    AggregatedParticlesCounts particlesCountsMPIaggr;
+    //! Graph communicator of the MPI processes owning a neighbor of a patch (see SmileiMPI::createNeighborsComm)
+    //!   - aggr_comm_ for the fields, particles_comm_ (duplicate) for the particles : a neighborhood collective of
+    //!     the fields may be started before or after those of the particles, depending on the MPI process
+    MPI_Comm aggr_comm_, particles_comm_;
+    //! Duplicates of aggr_comm_, 1 per thread (Main.hybrid_communication), empty otherwise
+    std::vector<MPI_Comm> thread_comms_;
+    bool hybrid_communication_;
+
+    //! E and B of all patches in one grid (Main.supergrid), inactive if the patches are not stacked along X
+    SuperGrid supergrid_;
+
     std::vector<Field*> listJx_;
     std::vector<Field*> listJy_;
     std::vector<Field*> listJz_;
@@ -44,9 +44,230 @@ PyArrayObject* Function_Python2D::valueAt(std::vector<PyArrayObject*> x) {
 PyArrayObject* Function_Python3D::valueAt(std::vector<PyArrayObject*> x) {
     return (PyArrayObject*)PyObject_CallFunctionObjArgs(py_profile, x[0], x[1], x[2], NULL);
 }
+PyArrayObject* Function_Python2D::valueAt(std::vector<PyArrayObject*> x, double time) {
+    PyObject* t = PyFloat_FromDouble(time);
+    PyArrayObject* ret = (PyArrayObject*)PyObject_CallFunctionObjArgs(py_profile, x[0], t, NULL);
+    Py_DECREF(t);
+    return ret;
+}
+PyArrayObject* Function_Python3D::valueAt(std::vector<PyArrayObject*> x, double time) {
+    PyObject* t = PyFloat_FromDouble(time);
+    PyArrayObject* ret = (PyArrayObject*)PyObject_CallFunctionObjArgs(py_profile, x[0], x[1], t, NULL);
+    Py_DECREF(t);
+    return ret;
+}
 #endif
 
 
+// Python functions compiled in a bytecode
+Function_Bytecode::Function_Bytecode(PyObject *program, unsigned int nvariables) :
+    nvariables(nvariables),
+    stack_size(0)
+{
+    const char* names[] = { "const", "arg", "neg", "not", "exp", "log", "log10", "sqrt", "sin", "cos", "tan", "asin", "acos", "atan", "sinh", "cosh", "tanh",
+        "fabs", "floor", "ceil", "add", "sub", "mul", "div", "pow", "mod", "floordiv", "atan2", "min", "max", "lt", "le", "gt", "ge", "eq", "ne", "where" };
+    unsigned int noperations = sizeof(names)/sizeof(names[0]);
+    
+    vector<PyObject*> instructions;
+    if( !PyTools::convert(program, instructions) ) return;
+    int depth = 0, max_depth = 0;
+    for( unsigned int i=0; i<instructions.size(); i++ ) {
+        string name;
+        double value;
+        if( !PyTuple_Check(instructions[i]) || PyTuple_Size(instructions[i]) != 2
+         || !PyTools::convert(PyTuple_GetItem(instructions[i], 0), name)
+         || !PyTools::convert(PyTuple_GetItem(instructions[i], 1), value) ) return;
+        unsigned int op = 0;
+        while( op<noperations && name != names[op] ) op++;
+        if( op == noperations || ( op == ARG && ( value < 0. || value >= nvariables ) ) ) return;
+        operations.push_back( op );
+        values.push_back( value );
+        // Change of the stack depth
+        if     ( op <= ARG  ) depth++;
+        else if( op <  ADD  ) {}
+        else if( op <  WHERE) depth--;
+        else                  depth -= 2;
+        if( depth < 1 ) return;
+        max_depth = max( max_depth, depth );
+    }
+    if( depth == 1 ) stack_size = max_depth;
+}
+
+bool Function_Bytecode::isValid(PyObject *py_profile) {
+    if( stack_size == 0 ) return false;
+    // Compare to the python function at a few points : the python function must not raise an error there, the
+    // program could otherwise return a value (e.g. inf for 1/x at x=0) where python would stop the simulation
+    double points[3][3] = { {0., 0., 0.}, {1.3, -0.7, 2.9}, {-4.1, 3.3, 0.55} };
+    for( unsigned int ipoint=0; ipoint<3; ipoint++ ) {
+        PyObject* args = PyTuple_New(nvariables);
+        for( unsigned int i=0; i<nvariables; i++ )
+            PyTuple_SetItem(args, i, PyFloat_FromDouble(points[ipoint][i]));
+        PyObject* ret = PyObject_CallObject(py_profile, args);
+        Py_DECREF(args);
+        if( !ret || !PyNumber_Check(ret) ) {
+            PyErr_Clear();
+            Py_XDECREF(ret);
+            return false;
+        }
+        double expected = PyFloat_AsDouble(ret);
+        Py_DECREF(ret);
+        PyErr_Clear();
+        vector<double> x(points[ipoint], points[ipoint]+nvariables);
+        double value = valueAt(x);
+        if( std::isnan(value) && std::isnan(expected) ) continue;
+        if( !( abs(value-expected) <= 1e-12*( abs(value)+abs(expected) ) ) ) return false;
+    }
+    return true;
+}
+
+double Function_Bytecode::valueAt(double time) {
+    const double* x[1] = { &time };
+    unsigned int stride[1] = { 0 };
+    double ret;
+    evaluate(x, stride, 1, &ret);
+    return ret;
+}
+double Function_Bytecode::valueAt(vector<double> x_cell, double time) {
+    if( nvariables == 1 ) return valueAt(time);
+    x_cell.resize(nvariables);
+    x_cell[nvariables-1] = time;
+    return valueAt(x_cell);
+}
+double Function_Bytecode::valueAt(vector<double> x_cell) {
+    const double* x[3];
+    unsigned int stride[3] = { 0, 0, 0 };
+    for( unsigned int i=0; i<nvariables; i++ )
+        x[i] = &x_cell[i];
+    double ret;
+    evaluate(x, stride, 1, &ret);
+    return ret;
+}
+void Function_Bytecode::valuesAt(vector<double*> x, unsigned int size, double* ret) {
+    const double* xx[3];
+    unsigned int stride[3] = { 1, 1, 1 };
+    for( unsigned int i=0; i<nvariables; i++ )
+        xx[i] = x[i];
+    evaluate(xx, stride, size, ret);
+}
+void Function_Bytecode::valuesAt(vector<double*> x, double time, unsigned int size, double* ret) {
+    const double* xx[3];
+    unsigned int stride[3] = { 1, 1, 1 };
+    for( unsigned int i=0; i+1<nvariables; i++ )
+        xx[i] = x[i];
+    xx[nvariables-1] = &time;
+    stride[nvariables-1] = 0;
+    evaluate(xx, stride, size, ret);
+}
+
+// Modulo and floor division as in python
+static inline double python_mod(double a, double b) {
+    double mod = fmod(a, b);
+    if( mod ) {
+        if( (b < 0.) != (mod < 0.) ) mod += b;
+    } else {
+        mod = copysign(0., b);
+    }
+    return mod;
+}
+static inline double python_floordiv(double a, double b) {
+    double mod = fmod(a, b);
+    double div = (a - mod) / b;
+    if( mod && (b < 0.) != (mod < 0.) ) div -= 1.;
+    double floordiv;
+    if( div ) {
+        floordiv = floor(div);
+        if( div - floordiv > 0.5 ) floordiv += 1.;
+    } else {
+        floordiv = copysign(0., a/b);
+    }
+    return floordiv;
+}
+
+void Function_Bytecode::evaluate(const double **x, const unsigned int *stride, unsigned int size, double* ret) {
+    // The stack holds blocks of points (on the heap only for very deep expressions)
+    const unsigned int block = 32;
+    double local_stack[block*64];
+    vector<double> heap_stack;
+    double* stack = local_stack;
+    if( stack_size > 64 ) {
+        heap_stack.resize( block*stack_size );
+        stack = &heap_stack[0];
+    }
+    
+    for( unsigned int first=0; first<size; first+=block ) {
+        unsigned int n = min( block, size-first );
+        int top = -1;
+        for( unsigned int i=0; i<operations.size(); i++ ) {
+            int op = operations[i];
+            if( op <= ARG ) {
+                top++;
+                double* a = &stack[top*block];
+                if( op == CONST ) {
+                    for( unsigned int k=0; k<n; k++ ) a[k] = values[i];
+                } else {
+                    int iarg = values[i];
+                    const double* xa = x[iarg];
+                    unsigned int s = stride[iarg];
+                    for( unsigned int k=0; k<n; k++ ) a[k] = xa[(first+k)*s];
+                }
+            } else if( op < ADD ) {
+                double* a = &stack[top*block];
+                switch( op ) {
+                    case NEG  : for( unsigned int k=0; k<n; k++ ) a[k] = -a[k]; break;
+                    case NOT  : for( unsigned int k=0; k<n; k++ ) a[k] = a[k]==0. ? 1. : 0.; break;
+                    case EXP  : for( unsigned int k=0; k<n; k++ ) a[k] = exp  (a[k]); break;
+                    case LOG  : for( unsigned int k=0; k<n; k++ ) a[k] = log  (a[k]); break;
+                    case LOG10: for( unsigned int k=0; k<n; k++ ) a[k] = log10(a[k]); break;
+                    case SQRT : for( unsigned int k=0; k<n; k++ ) a[k] = sqrt (a[k]); break;
+                    case SIN  : for( unsigned int k=0; k<n; k++ ) a[k] = sin  (a[k]); break;
+                    case COS  : for( unsigned int k=0; k<n; k++ ) a[k] = cos  (a[k]); break;
+                    case TAN  : for( unsigned int k=0; k<n; k++ ) a[k] = tan  (a[k]); break;
+                    case ASIN : for( unsigned int k=0; k<n; k++ ) a[k] = asin (a[k]); break;
+                    case ACOS : for( unsigned int k=0; k<n; k++ ) a[k] = acos (a[k]); break;
+                    case ATAN : for( unsigned int k=0; k<n; k++ ) a[k] = atan (a[k]); break;
+                    case SINH : for( unsigned int k=0; k<n; k++ ) a[k] = sinh (a[k]); break;
+                    case COSH : for( unsigned int k=0; k<n; k++ ) a[k] = cosh (a[k]); break;
+                    case TANH : for( unsigned int k=0; k<n; k++ ) a[k] = tanh (a[k]); break;
+                    case FABS : for( unsigned int k=0; k<n; k++ ) a[k] = fabs (a[k]); break;
+                    case FLOOR: for( unsigned int k=0; k<n; k++ ) a[k] = floor(a[k]); break;
+                    case CEIL : for( unsigned int k=0; k<n; k++ ) a[k] = ceil (a[k]); break;
+                }
+            } else if( op < WHERE ) {
+                top--;
+                double* a = &stack[top*block];
+                double* b = &stack[(top+1)*block];
+                switch( op ) {
+                    case ADD     : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] + b[k]; break;
+                    case SUB     : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] - b[k]; break;
+                    case MUL     : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] * b[k]; break;
+                    case DIV     : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] / b[k]; break;
+                    case POW     : for( unsigned int k=0; k<n; k++ ) a[k] = pow(a[k], b[k]); break;
+                    case MOD     : for( unsigned int k=0; k<n; k++ ) a[k] = python_mod(a[k], b[k]); break;
+                    case FLOORDIV: for( unsigned int k=0; k<n; k++ ) a[k] = python_floordiv(a[k], b[k]); break;
+                    case ATAN2   : for( unsigned int k=0; k<n; k++ ) a[k] = atan2(a[k], b[k]); break;
+                    case MIN     : for( unsigned int k=0; k<n; k++ ) a[k] = b[k] < a[k] ? b[k] : a[k]; break;
+                    case MAX     : for( unsigned int k=0; k<n; k++ ) a[k] = b[k] > a[k] ? b[k] : a[k]; break;
+                    case LT      : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] <  b[k] ? 1. : 0.; break;
+                    case LE      : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] <= b[k] ? 1. : 0.; break;
+                    case GT      : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] >  b[k] ? 1. : 0.; break;
+                    case GE      : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] >= b[k] ? 1. : 0.; break;
+                    case EQ      : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] == b[k] ? 1. : 0.; break;
+                    case NE      : for( unsigned int k=0; k<n; k++ ) a[k] = a[k] != b[k] ? 1. : 0.; break;
+                }
+            } else {
+                top -= 2;
+                double* c = &stack[top*block];
+                double* a = &stack[(top+1)*block];
+                double* b = &stack[(top+2)*block];
+                for( unsigned int k=0; k<n; k++ ) c[k] = c[k]!=0. ? a[k] : b[k];
+            }
+        }
+        for( unsigned int k=0; k<n; k++ )
+            ret[first+k] = stack[k];
+    }
+}
+
+
 // Constant profiles
 double Function_Constant1D::valueAt(vector<double> x_cell) {
     return (x_cell[0]>xvacuum) ? value : 0.;
@@ -36,6 +36,10 @@ public:
     virtual PyArrayObject* valueAt(std::vector<PyArrayObject*>) {
         return NULL;
     };
+    //! Gets the value of an N-D function at points specified as numpy arrays, and a time
+    virtual PyArrayObject* valueAt(std::vector<PyArrayObject*>, double) {
+        return NULL;
+    };
 #endif
 };
 
@@ -69,6 +73,7 @@ public:
     double valueAt(std::vector<double>); // space
 #ifdef SMILEI_USE_NUMPY
     PyArrayObject* valueAt(std::vector<PyArrayObject*>); // numpy
+    PyArrayObject* valueAt(std::vector<PyArrayObject*>, double); // numpy space + time
 #endif
 private:
     PyObject *py_profile;
@@ -85,6 +90,7 @@ public:
     double valueAt(std::vector<double>); // space
 #ifdef SMILEI_USE_NUMPY
     PyArrayObject* valueAt(std::vector<PyArrayObject*>); // numpy
+    PyArrayObject* valueAt(std::vector<PyArrayObject*>, double); // numpy space + time
 #endif
 private:
     PyObject *py_profile;
@@ -103,6 +109,42 @@ private:
 };
 
 
+// Child class for python functions compiled in a bytecode (see _compileProfile in pyprofiles.py)
+// The bytecode is evaluated without python, by blocks of points, so that it is thread-safe
+
+class Function_Bytecode : public Function
+{
+public:
+    Function_Bytecode(PyObject *program, unsigned int nvariables);
+    Function_Bytecode(Function_Bytecode *f) :
+        operations(f->operations), values(f->values), nvariables(f->nvariables), stack_size(f->stack_size) {};
+    ~Function_Bytecode() {};
+    double valueAt(double); // time
+    double valueAt(std::vector<double>, double); // space + time (space discarded in 1D)
+    double valueAt(std::vector<double>); // space
+    //! Values at several points (spatial) : x[idim] points to the coordinates along idim
+    void valuesAt(std::vector<double*> x, unsigned int size, double* ret);
+    //! Values at several points (spatio-temporal)
+    void valuesAt(std::vector<double*> x, double time, unsigned int size, double* ret);
+
+    //! Whether the bytecode was understood, and gives the same values as the python function at a few points
+    bool isValid(PyObject *py_profile);
+
+private:
+    enum Operation { CONST, ARG, NEG, NOT, EXP, LOG, LOG10, SQRT, SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH,
+        FABS, FLOOR, CEIL, ADD, SUB, MUL, DIV, POW, MOD, FLOORDIV, ATAN2, MIN, MAX, LT, LE, GT, GE, EQ, NE, WHERE };
+    //! Operations in postfix order, and the constant or the argument index of each operation
+    std::vector<int> operations;
+    std::vector<double> values;
+    unsigned int nvariables;
+    //! Maximum depth of the stack (0 if the bytecode is not valid)
+    unsigned int stack_size;
+
+    //! Evaluates the bytecode : x[i] points to the values of the i-th argument, separated by stride[i] (0 for a scalar)
+    void evaluate(const double **x, const unsigned int *stride, unsigned int size, double* ret);
+};
+
+
 
 // Children classes for hard-coded functions
 
@@ -12,7 +12,8 @@ using namespace std;
 Profile::Profile(PyObject* py_profile, unsigned int nvariables, string name, bool try_numpy) :
     profileName(""),
     nvariables(nvariables),
-    uses_numpy(false)
+    uses_numpy(false),
+    uses_bytecode(false)
 {
     ostringstream info_("");
     info_ << nvariables << "D";
@@ -187,9 +188,24 @@ Profile::Profile(PyObject* py_profile, unsigned int nvariables, string name, boo
             ERROR("Profile `"<<name<<"`: defined with unsupported number of variables");
         
         
+        // Try to compile the profile in a bytecode, which is evaluated without python
+        PyObject* program = PyObject_CallMethod(PyImport_AddModule("__main__"), const_cast<char *>("_compileProfile"), const_cast<char *>("(Oi)"), py_profile, nvariables);
+        PyTools::checkPyError(false, false);
+        if( program && program != Py_None ) {
+            Function_Bytecode* f = new Function_Bytecode(program, nvariables);
+            if( f->isValid(py_profile) ) {
+                function = f;
+                uses_bytecode = true;
+            } else {
+                delete f;
+                DEBUG("Profile `"<<name<<"`: the compiled profile does not match the python function");
+            }
+        }
+        Py_XDECREF(program);
+        
         // Verify that the profile transforms a float in a float
 #ifdef SMILEI_USE_NUMPY
-        if( try_numpy ) {
+        if( try_numpy && !uses_bytecode ) {
             // If numpy available, verify that the profile accepts numpy arguments
             double test_value[2] = {0.,0.};
             npy_intp dims[1] = {2};
@@ -226,11 +242,15 @@ Profile::Profile(PyObject* py_profile, unsigned int nvariables, string name, boo
         }
         
         // Assign the evaluating function, which depends on the number of arguments
-        if      ( nvariables == 1 ) function = new Function_Python1D(py_profile);
-        else if ( nvariables == 2 ) function = new Function_Python2D(py_profile);
-        else if ( nvariables == 3 ) function = new Function_Python3D(py_profile);
-        
-        info_ << " user-defined function";
+        if( uses_bytecode ) {
+            info_ << " user-defined function (compiled)";
+        } else {
+            if      ( nvariables == 1 ) function = new Function_Python1D(py_profile);
+            else if ( nvariables == 2 ) function = new Function_Python2D(py_profile);
+            else if ( nvariables == 3 ) function = new Function_Python3D(py_profile);
+            
+            info_ << " user-defined function";
+        }
     }
     
     info = info_.str();
@@ -243,6 +263,7 @@ Profile::Profile(Profile *p){
   nvariables  = p->nvariables ;
   info        = p->info       ;
   uses_numpy  = p->uses_numpy ;
+  uses_bytecode = p->uses_bytecode;
   if( profileName != "" ) {
     if( profileName == "constant" ) {
       if     ( nvariables == 1 )
@@ -301,6 +322,8 @@ Profile::Profile(Profile *p){
     } else if( profileName == "tsin2plateau" ){
       function = new Function_TimeSin2Plateau(static_cast<Function_TimeSin2Plateau*>(p->function));
     }
+  }else if( uses_bytecode ) {
+    function = new Function_Bytecode(static_cast<Function_Bytecode*>(p->function));
   }else {
     if      ( nvariables == 1 ) function = new Function_Python1D(static_cast<Function_Python1D*>(p->function));
     else if ( nvariables == 2 ) function = new Function_Python2D(static_cast<Function_Python2D*>(p->function));
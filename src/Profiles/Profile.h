@@ -36,25 +36,38 @@ public:
     inline void valuesAt(std::vector<Field*> &coordinates, Field &ret) {
         unsigned int ndim = coordinates.size();
         unsigned int size = coordinates[0]->globalDims_;
+        std::vector<std::vector<double> > buffer;
+        // If compiled profile, evaluate all points at once (without python)
+        if( uses_bytecode ) {
+            std::vector<double*> x = doubleCoordinates(coordinates, buffer);
+#ifdef SMILEI_FLOAT_FIELDS
+            std::vector<double> values(size);
+            static_cast<Function_Bytecode*>(function)->valuesAt(x, size, &values[0]);
+            for( unsigned int i=0; i<size; i++)
+                ret(i) = values[i];
+#else
+            static_cast<Function_Bytecode*>(function)->valuesAt(x, size, ret.data());
+#endif
+            return;
+        }
 #ifdef SMILEI_USE_NUMPY
         // If numpy profile, then expose coordinates as numpy before evaluating profile
         if( uses_numpy ) {
             std::vector<PyArrayObject*> x(ndim);
+            std::vector<double*> xd = doubleCoordinates(coordinates, buffer);
             npy_intp dims[1] = {(npy_intp) size};
             // Expose arrays as numpy, and evaluate
             for( unsigned int idim=0; idim<ndim; idim++ )
-                x[idim] = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(coordinates[idim]->data()));
-            PyArrayObject* values = function->valueAt(x);
+                x[idim] = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, xd[idim]);
+            PyObject* values = (PyObject*) function->valueAt(x);
             for( unsigned int idim=0; idim<ndim; idim++ )
                 Py_DECREF(x[idim]);
-            // Copy array to return Field3D
-            double* arr = (double*) PyArray_GETPTR1(values, 0);
-            for( unsigned int i=0; i<size; i++)
-                ret(i) = arr[i];
-            Py_DECREF(values);
-        } else
+            // Copy array to return Field
+            if( copyNumpyValues(values, size, ret) )
+                return;
+        }
 #endif
-        // Otherwise, calculate profile for each point
+        // Otherwise, or if the numpy evaluation failed, calculate profile for each point
         {
             std::vector<double> x(ndim);
             for( unsigned int i=0; i<size; i++ ) {
@@ -66,13 +79,103 @@ public:
         }
     };
     
+    //! Get the value of the profile at several locations (spatio-temporal)
+    inline void valuesAt(std::vector<Field*> &coordinates, double time, Field &ret) {
+        unsigned int ndim = coordinates.size();
+        unsigned int size = coordinates[0]->globalDims_;
+        std::vector<std::vector<double> > buffer;
+        // If compiled profile, evaluate all points at once (without python)
+        if( uses_bytecode ) {
+            std::vector<double*> x = doubleCoordinates(coordinates, buffer);
+#ifdef SMILEI_FLOAT_FIELDS
+            std::vector<double> values(size);
+            static_cast<Function_Bytecode*>(function)->valuesAt(x, time, size, &values[0]);
+            for( unsigned int i=0; i<size; i++)
+                ret(i) = values[i];
+#else
+            static_cast<Function_Bytecode*>(function)->valuesAt(x, time, size, ret.data());
+#endif
+            return;
+        }
+#ifdef SMILEI_USE_NUMPY
+        // If numpy profile, then expose coordinates as numpy before evaluating profile
+        if( uses_numpy ) {
+            std::vector<PyArrayObject*> x(ndim);
+            std::vector<double*> xd = doubleCoordinates(coordinates, buffer);
+            npy_intp dims[1] = {(npy_intp) size};
+            // Expose arrays as numpy, and evaluate
+            for( unsigned int idim=0; idim<ndim; idim++ )
+                x[idim] = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, xd[idim]);
+            PyObject* values = (PyObject*) function->valueAt(x, time);
+            for( unsigned int idim=0; idim<ndim; idim++ )
+                Py_DECREF(x[idim]);
+            // Copy array to return Field
+            if( copyNumpyValues(values, size, ret) )
+                return;
+        }
+#endif
+        // Otherwise, or if the numpy evaluation failed, calculate profile for each point
+        {
+            std::vector<double> x(ndim);
+            for( unsigned int i=0; i<size; i++ ) {
+               for( unsigned int idim=0; idim<ndim; idim++ )
+                   x[idim]=(*coordinates[idim])(i);
+               ret(i) = function->valueAt(x, time);
+            }
+        }
+    };
+    
+#ifdef SMILEI_USE_NUMPY
+    //! Copy the result of a numpy profile to ret (a single value is copied to all points), and release it
+    //! Returns false if it cannot be used: python error, or not convertible to an array of size 1 or size
+    inline bool copyNumpyValues(PyObject* values, unsigned int size, Field &ret) {
+        if( !values ) {
+            PyTools::checkPyError();
+            return false;
+        }
+        PyArrayObject* arr = (PyArrayObject*) PyArray_FROM_OTF(values, NPY_DOUBLE, NPY_ARRAY_IN_ARRAY);
+        Py_DECREF(values);
+        if( !arr ) {
+            PyTools::checkPyError();
+            return false;
+        }
+        npy_intp n = PyArray_SIZE(arr);
+        bool ok = ( n == (npy_intp) size || n == 1 );
+        if( ok ) {
+            double* d = (double*) PyArray_DATA(arr);
+            for( unsigned int i=0; i<size; i++)
+                ret(i) = d[ n==1 ? 0 : i ];
+        }
+        Py_DECREF(arr);
+        return ok;
+    };
+#endif
+    
     //! Get info on the loaded profile, to be printed later
     inline std::string getInfo() { return info; };
     
+    //! Whether the profile calls python (it cannot be evaluated by several threads at once)
+    inline bool usesPython() { return profileName=="" && !uses_bytecode; };
+    
     //! Name of the profile, in the case of a built-in profile
     std::string profileName;
     
 private:
+    //! Coordinates as double precision arrays (copied in buffer only if the fields are single precision)
+    inline std::vector<double*> doubleCoordinates(std::vector<Field*> &coordinates, std::vector<std::vector<double> > &buffer) {
+        std::vector<double*> x(coordinates.size());
+        buffer.resize(coordinates.size());
+        for( unsigned int idim=0; idim<coordinates.size(); idim++ ) {
+#ifdef SMILEI_FLOAT_FIELDS
+            buffer[idim].assign( coordinates[idim]->data(), coordinates[idim]->data()+coordinates[idim]->globalDims_ );
+            x[idim] = &buffer[idim][0];
+#else
+            x[idim] = coordinates[idim]->data();
+#endif
+        }
+        return x;
+    };
+    
     //! Object that holds the information on the profile function
     Function * function;
     
@@ -85,6 +188,9 @@ private:
     //! Whether the profile is using numpy
     bool uses_numpy;
     
+    //! Whether the profile is compiled in a bytecode (evaluated without python)
+    bool uses_bytecode;
+    
 };//END class Profile
 
 
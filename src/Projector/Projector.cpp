@@ -2,8 +2,41 @@
 
 #include "Params.h"
 #include "Patch.h"
+#include "ElectroMagn.h"
 
 Projector::Projector(Params &params, Patch* patch)
 {
 }
 
+
+void ProjectionTile::allocate( ElectroMagn* EMfields, int ibin, int clrw, std::vector<unsigned int> &b_dim, bool diag_flag, bool is_spectral, int ispec )
+{
+    field[0] = EMfields->Jx_;
+    field[1] = EMfields->Jy_;
+    field[2] = EMfields->Jz_;
+    field[3] = EMfields->rho_;
+    nfields = is_spectral ? 4 : 3;
+    // On the timesteps of the diagnostics, the projection applies to the species-specific arrays, when they exist
+    if ( diag_flag ) {
+        if ( EMfields->Jx_s [ispec] ) field[0] = EMfields->Jx_s [ispec];
+        if ( EMfields->Jy_s [ispec] ) field[1] = EMfields->Jy_s [ispec];
+        if ( EMfields->Jz_s [ispec] ) field[2] = EMfields->Jz_s [ispec];
+        if ( EMfields->rho_s[ispec] ) field[3] = EMfields->rho_s[ispec];
+        nfields = 4;
+    }
+    for ( unsigned int i=0 ; i<nfields ; i++ ) {
+        // Rows along x covered by the bin (+1 if the field is dual along x)
+        unsigned int stride = field[i]->globalDims_/field[i]->dims_[0];
+        offset[i] = ibin*clrw*stride;
+        buffer[i].assign( std::min( ( b_dim[0]+1 )*stride, field[i]->globalDims_-offset[i] ), 0. );
+    }
+}
+
+void ProjectionTile::reduce()
+{
+    for ( unsigned int i=0 ; i<nfields ; i++ ) {
+        field_t* f = &field[i]->data_[offset[i]];
+        for ( unsigned int j=0 ; j<buffer[i].size() ; j++ )
+            f[j] += buffer[i][j];
+    }
+}
@@ -1,6 +1,9 @@
 #ifndef PROJECTOR_H
 #define PROJECTOR_H
 
+#include <vector>
+#include <algorithm>
+
 #include "Params.h"
 #include "Field.h"
 
@@ -12,6 +15,86 @@ class Field;
 class Particles;
 
 
+//----------------------------------------------------------------------------------------------------------------------
+//! class ProjectionBuffer: part of a current or density array, starting at the first row of a bin, on which the
+//! particles of this bin are projected. The projection is always done in double precision: directly in the field when
+//! field_t is double, otherwise in a buffer which is added to the field when the ProjectionBuffer is destroyed.
+//----------------------------------------------------------------------------------------------------------------------
+class ProjectionBuffer {
+
+public:
+    ProjectionBuffer( Field* field, unsigned int offset, std::vector<unsigned int> &b_dim )
+    {
+#ifdef SMILEI_FLOAT_FIELDS
+        field_ = &field->data_[offset];
+        // Rows along x covered by the bin (+1 if the field is dual along x)
+        unsigned int size = ( b_dim[0]+1 ) * ( field->globalDims_/field->dims_[0] );
+        buffer_.resize( std::min( size, field->globalDims_-offset ), 0. );
+#else
+        data_ = &field->data_[offset];
+#endif
+    };
+    ~ProjectionBuffer()
+    {
+#ifdef SMILEI_FLOAT_FIELDS
+        for ( unsigned int i=0 ; i<buffer_.size() ; i++ )
+            field_[i] += buffer_[i];
+#endif
+    };
+
+    //! Array on which the particles are projected
+    inline double* data()
+    {
+#ifdef SMILEI_FLOAT_FIELDS
+        return &buffer_[0];
+#else
+        return data_;
+#endif
+    };
+
+private:
+#ifdef SMILEI_FLOAT_FIELDS
+    //! Part of the field to which the buffer is added
+    field_t* field_;
+    //! Double precision accumulation buffer
+    std::vector<double> buffer_;
+#else
+    double* data_;
+#endif
+};
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! class ProjectionTile: private double precision buffers of the currents (and charge) of one bin, sized to the bin
+//! plus the stencil of the projection. The bins of a patch may be projected on their tiles by different threads
+//! at the same time; the tiles are then added to the fields by a single thread (reduce), once all bins are done.
+//----------------------------------------------------------------------------------------------------------------------
+class ProjectionTile {
+
+public:
+    ProjectionTile() : nfields(0) {};
+
+    //! Selects the fields receiving the projection of bin ibin (per species if diag_flag) and allocates the buffers
+    void allocate( ElectroMagn* EMfields, int ibin, int clrw, std::vector<unsigned int> &b_dim, bool diag_flag, bool is_spectral, int ispec );
+    //! Adds the buffers to the fields
+    void reduce();
+
+    inline double* Jx () { return &buffer[0][0]; };
+    inline double* Jy () { return &buffer[1][0]; };
+    inline double* Jz () { return &buffer[2][0]; };
+    //! NULL if the charge is not projected
+    inline double* rho() { return nfields==4 ? &buffer[3][0] : NULL; };
+
+private:
+    //! Number of projected fields (Jx, Jy, Jz and possibly rho)
+    unsigned int nfields;
+    //! Projected fields, and position of the first row of the bin in these fields
+    Field* field[4];
+    unsigned int offset[4];
+    std::vector<double> buffer[4];
+};
+
+
 //----------------------------------------------------------------------------------------------------------------------
 //! class Projector: contains the virtual operators used during the current projection
 //----------------------------------------------------------------------------------------------------------------------
@@ -32,6 +115,9 @@ public:
 
    //!Wrapper
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, bool is_spectral, std::vector<unsigned int> &b_dim, int ispec) = 0;
+
+    //! Wrapper for the projection on the tile of bin ibin (see ProjectionTile)
+    virtual void operator() (ProjectionTile &tile, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, std::vector<unsigned int> &b_dim) = 0;
 private:
 
 };
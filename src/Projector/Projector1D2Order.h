@@ -22,6 +22,9 @@ public:
     //!Wrapper
     void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, bool is_spectral, std::vector<unsigned int> &b_dim, int ispec) override final;
 
+    //! Wrapper for the projection on the tile of a bin
+    void operator() (ProjectionTile &tile, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, std::vector<unsigned int> &b_dim) override final;
+
 private:
     double dx_ov_dt;
 };
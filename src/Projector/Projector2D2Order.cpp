@@ -465,27 +465,46 @@ void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
     // If no field diagnostics this timestep, then the projection is done directly on the total arrays
     if (!diag_flag){ 
         if (!is_spectral) {
-            double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw*dim1);
-            double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1));
-            double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw*dim1);
+            ProjectionBuffer b_Jx( EMfields->Jx_, ibin*clrw*dim1, b_dim );
+            ProjectionBuffer b_Jy( EMfields->Jy_, ibin*clrw*(dim1+1), b_dim );
+            ProjectionBuffer b_Jz( EMfields->Jz_, ibin*clrw*dim1, b_dim );
             for (int ipart=istart ; ipart<iend; ipart++ )
-                (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+                (*this)(b_Jx.data(), b_Jy.data(), b_Jz.data(), particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
         }
         else {
-            double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw* dim1   );
-            double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1));
-            double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw* dim1   );
-            double* b_rho=  &(*EMfields->rho_)(ibin*clrw* dim1   );
+            ProjectionBuffer b_Jx( EMfields->Jx_, ibin*clrw* dim1, b_dim );
+            ProjectionBuffer b_Jy( EMfields->Jy_, ibin*clrw*(dim1+1), b_dim );
+            ProjectionBuffer b_Jz( EMfields->Jz_, ibin*clrw* dim1, b_dim );
+            ProjectionBuffer b_rho( EMfields->rho_, ibin*clrw* dim1, b_dim );
             for ( int ipart=istart ; ipart<iend; ipart++ )
-                (*this)(b_Jx , b_Jy , b_Jz , b_rho , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+                (*this)(b_Jx.data(), b_Jy.data(), b_Jz.data(), b_rho.data(), particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
         }         
     // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double* b_Jx  = EMfields->Jx_s [ispec] ? &(*EMfields->Jx_s [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jx_ )(ibin*clrw* dim1   ) ;
-        double* b_Jy  = EMfields->Jy_s [ispec] ? &(*EMfields->Jy_s [ispec])(ibin*clrw*(dim1+1)) : &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)) ;
-        double* b_Jz  = EMfields->Jz_s [ispec] ? &(*EMfields->Jz_s [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jz_ )(ibin*clrw* dim1   ) ;
-        double* b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw* dim1   ) : &(*EMfields->rho_)(ibin*clrw* dim1   ) ;
+        ProjectionBuffer b_Jx( EMfields->Jx_s[ispec] ? EMfields->Jx_s[ispec] : EMfields->Jx_, ibin*clrw* dim1, b_dim );
+        ProjectionBuffer b_Jy( EMfields->Jy_s[ispec] ? EMfields->Jy_s[ispec] : EMfields->Jy_, ibin*clrw*(dim1+1), b_dim );
+        ProjectionBuffer b_Jz( EMfields->Jz_s[ispec] ? EMfields->Jz_s[ispec] : EMfields->Jz_, ibin*clrw* dim1, b_dim );
+        ProjectionBuffer b_rho( EMfields->rho_s[ispec] ? EMfields->rho_s[ispec] : EMfields->rho_, ibin*clrw* dim1, b_dim );
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+            (*this)(b_Jx.data(), b_Jy.data(), b_Jz.data(), b_rho.data(), particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for the projection on the tile of a bin
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D2Order::operator() (ProjectionTile &tile, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, std::vector<unsigned int> &b_dim)
+{
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
+    std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
+    
+    if ( tile.rho() ) {
+        for ( int ipart=istart ; ipart<iend; ipart++ )
+            (*this)(tile.Jx(), tile.Jy(), tile.Jz(), tile.rho(), particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+    } else {
+        for ( int ipart=istart ; ipart<iend; ipart++ )
+            (*this)(tile.Jx(), tile.Jy(), tile.Jz(), particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
     }
 }
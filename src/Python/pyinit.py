@@ -178,6 +178,9 @@ class Main(SmileiSingleton):
     patch_decomposition = "hilbert"
     patch_orientation = ""
     clrw = -1
+    cluster_tasks = False
+    hybrid_communication = False
+    supergrid = False
     every_clean_particles_overhead = 100
     timestep = None
     nmodes = 2
@@ -193,6 +196,7 @@ class Main(SmileiSingleton):
     solve_poisson = True
     poisson_max_iteration = 50000
     poisson_max_error = 1.e-14
+    poisson_solver = "CG"
     
     # Relativistic Poisson tuning
     solve_relativistic_poisson = False
@@ -204,6 +208,7 @@ class Main(SmileiSingleton):
     EM_boundary_conditions = [["periodic"]]
     EM_boundary_conditions_k = []
     save_magnectic_fields_for_SM = True
+    number_of_pml_cells = 10
     Envelope_boundary_conditions = [["reflective"]]
     time_fields_frozen = 0.
     Laser_Envelope_model = False
@@ -370,6 +375,7 @@ class Laser(SmileiComponent):
     phase = [0., 0.]
     delay_phase = [0., 0.]
     space_time_profile = None
+    file = None
 
 class LaserEnvelope(SmileiSingleton):
     """Laser Envelope parameters"""
@@ -587,6 +587,289 @@ def LaserGaussian3D( box_side="xmin", a0=1., omega=1., focus=None, waist=3., inc
         delay_phase    = [ 0., dephasing ]
     )
 
+# Compiler of user-defined profiles into a simple bytecode, evaluated by Smilei without python.
+# It accepts lambdas and functions made of assignments, `if` blocks and `return` of arithmetic
+# expressions, comparisons, boolean operators, conditional expressions, calls to usual math (or numpy)
+# functions and calls to other functions of the same kind. Names (or items of lists) that are not arguments are resolved
+# once (when the profile is created) from the closure or the globals of the function.
+# Returns a list of instructions in postfix order, or None if the function cannot be compiled.
+class _ProfileCompilerError(Exception):
+    pass
+
+def _profileCompilerOperations():
+    import math
+    unary  = dict(exp=math.exp, log=math.log, log10=math.log10, sqrt=math.sqrt,
+        sin=math.sin, cos=math.cos, tan=math.tan, asin=math.asin, acos=math.acos, atan=math.atan,
+        sinh=math.sinh, cosh=math.cosh, tanh=math.tanh, fabs=math.fabs, floor=math.floor, ceil=math.ceil)
+    binary = dict(pow=math.pow, atan2=math.atan2)
+    functions = []
+    for name, f in unary.items():
+        functions += [(f, name, 1)]
+    for name, f in binary.items():
+        functions += [(f, name, 2)]
+    functions += [(abs, "fabs", 1), (min, "min", 2), (max, "max", 2)]
+    try:
+        import numpy
+        for name in unary:
+            functions += [(getattr(numpy, name), name, 1)]
+        functions += [(numpy.arcsin, "asin", 1), (numpy.arccos, "acos", 1), (numpy.arctan, "atan", 1),
+            (numpy.abs, "fabs", 1), (numpy.power, "pow", 2), (numpy.arctan2, "atan2", 2),
+            (numpy.minimum, "min", 2), (numpy.maximum, "max", 2), (numpy.where, "where", 3)]
+    except:
+        pass
+    return functions
+
+def _compileProfile(function, nargs):
+    import ast, inspect, linecache, numbers
+    operations = _profileCompilerOperations()
+    binops = {ast.Add:"add", ast.Sub:"sub", ast.Mult:"mul", ast.Div:"div", ast.Pow:"pow", ast.Mod:"mod", ast.FloorDiv:"floordiv"}
+    cmpops = {ast.Lt:"lt", ast.LtE:"le", ast.Gt:"gt", ast.GtE:"ge", ast.Eq:"eq", ast.NotEq:"ne"}
+    pyops  = {"add":lambda a,b:a+b, "sub":lambda a,b:a-b, "mul":lambda a,b:a*b, "div":lambda a,b:a/b,
+        "pow":lambda a,b:a**b, "mod":lambda a,b:a%b, "floordiv":lambda a,b:a//b,
+        "lt":lambda a,b:a<b, "le":lambda a,b:a<=b, "gt":lambda a,b:a>b, "ge":lambda a,b:a>=b,
+        "eq":lambda a,b:a==b, "ne":lambda a,b:a!=b, "min":min, "max":max, "neg":lambda a:-a, "not":lambda a:not a,
+        "where":lambda c,a,b: a if c else b}
+    # Nodes of the expression: ("const", value), ("arg", index), ("object", python object) or (operation, operands...)
+    def fail():
+        raise _ProfileCompilerError()
+    def constant(node):
+        if hasattr(ast, "Constant"):
+            return (True, node.value) if isinstance(node, ast.Constant) else (False, None)
+        if isinstance(node, ast.Num): return True, node.n
+        if isinstance(node, ast.Str): return True, node.s
+        if hasattr(ast, "NameConstant") and isinstance(node, ast.NameConstant): return True, node.value
+        return False, None
+    def toNode(value):
+        if isinstance(value, bool) or isinstance(value, numbers.Real):
+            return ("const", float(value))
+        return ("object", value)
+    def operation(op, *operands):
+        for o in operands:
+            if o[0] == "object": fail()
+        if op == "where" and operands[0][0] == "const":
+            return operands[1] if operands[0][1] else operands[2]
+        if op == "where" and operands[1] == operands[2]:
+            return operands[1]
+        if op == "where" and operands[1:] == (("const", 1.), ("const", 0.)) and operands[0][0] in list(cmpops.values()) + ["not"]:
+            return operands[0]
+        if all(o[0] == "const" for o in operands):
+            if op in pyops:
+                return toNode(pyops[op](*[o[1] for o in operands]))
+            for f, name, n in operations:
+                if name == op and n == len(operands):
+                    return toNode(f(*[o[1] for o in operands]))
+        return (op,) + tuple(operands)
+    def truth(node):
+        if node[0] in list(cmpops.values()) + ["not"]:
+            return node
+        return operation("ne", node, ("const", 0.))
+    # Find the definition of a function in its source
+    sources = {}
+    def definition(f):
+        code = f.__code__
+        if code.co_filename not in sources:
+            lines = linecache.getlines(code.co_filename)
+            if not lines: fail()
+            sources[code.co_filename] = ast.parse("".join(lines))
+        tree = sources[code.co_filename]
+        candidates = []
+        for node in ast.walk(tree):
+            if isinstance(node, ast.Lambda) and code.co_name == "<lambda>" and node.lineno == code.co_firstlineno:
+                candidates += [node]
+            if isinstance(node, ast.FunctionDef) and node.name == code.co_name and not node.decorator_list \
+               and node.lineno == code.co_firstlineno:
+                candidates += [node]
+        # Several lambdas on the same line : compare the names and constants that they use
+        if len(candidates) > 1:
+            def signature(node):
+                names, consts = set(), set()
+                for n in ast.walk(node):
+                    if isinstance(n, ast.Name): names.add(n.id)
+                    elif isinstance(n, ast.arg): names.add(n.arg)
+                    elif isinstance(n, ast.Attribute): names.add(n.attr)
+                    elif constant(n)[0] and isinstance(constant(n)[1], numbers.Real): consts.add(abs(constant(n)[1]))
+                return names, consts
+            names = set(code.co_varnames) | set(code.co_freevars) | set(code.co_names)
+            consts = set(abs(c) for c in code.co_consts if isinstance(c, numbers.Real))
+            candidates = [c for c in candidates if signature(c)[0] == names]
+            if len(set(ast.dump(c) for c in candidates)) > 1:
+                candidates = [c for c in candidates if signature(c)[1] == consts]
+            if len(set(ast.dump(c) for c in candidates)) > 1: fail()
+        if not candidates: fail()
+        return candidates[0]
+    # Inline a function call
+    def inline(f, args, depth):
+        if depth > 20 or not inspect.isfunction(f): fail()
+        node = definition(f)
+        a = node.args
+        if a.vararg or a.kwarg or getattr(a, "kwonlyargs", []): fail()
+        names = [arg.arg if hasattr(arg, "arg") else arg.id for arg in a.args]
+        defaults = f.__defaults__ or ()
+        if len(args) > len(names) or len(args) < len(names)-len(defaults): fail()
+        env = dict(zip(names, args))
+        for name, value in zip(names[len(names)-len(defaults):], defaults):
+            if name not in env: env[name] = toNode(value)
+        closure = {}
+        if f.__closure__:
+            for name, cell in zip(f.__code__.co_freevars, f.__closure__):
+                closure[name] = cell.cell_contents
+        context = (f.__globals__, closure, set(f.__code__.co_varnames), depth)
+        if isinstance(node, ast.Lambda):
+            return expression(node.body, env, context)
+        returned, result = statements(node.body, env, context)
+        if returned != ("const", 1.): fail()
+        return result
+    def lookup(name, env, context):
+        globals_, closure, local, depth = context
+        if name in env: return env[name]
+        if name in local: fail()
+        if name in closure: return toNode(closure[name])
+        if name in globals_: return toNode(globals_[name])
+        builtins = globals_.get("__builtins__")
+        builtins = getattr(builtins, "__dict__", builtins)
+        if name in builtins: return toNode(builtins[name])
+        fail()
+    def expression(node, env, context):
+        e = lambda n: expression(n, env, context)
+        isconstant, value = constant(node)
+        if isconstant:
+            return toNode(value)
+        if isinstance(node, ast.Name):
+            return lookup(node.id, env, context)
+        if isinstance(node, ast.Attribute):
+            base = e(node.value)
+            if base[0] != "object" or not hasattr(base[1], node.attr): fail()
+            return toNode(getattr(base[1], node.attr))
+        if isinstance(node, ast.Subscript):
+            base, index = e(node.value), node.slice
+            if hasattr(ast, "Index") and isinstance(index, ast.Index): index = index.value
+            index = e(index)
+            if base[0] != "object" or index[0] != "const" or index[1] != int(index[1]): fail()
+            return toNode(base[1][int(index[1])])
+        if isinstance(node, ast.BinOp) and type(node.op) in binops:
+            return operation(binops[type(node.op)], e(node.left), e(node.right))
+        if isinstance(node, ast.UnaryOp):
+            if isinstance(node.op, ast.USub): return operation("neg", e(node.operand))
+            if isinstance(node.op, ast.UAdd): return operation("add", ("const", 0.), e(node.operand))
+            if isinstance(node.op, ast.Not ): return operation("not", e(node.operand))
+        if isinstance(node, ast.Compare):
+            left, result = e(node.left), None
+            for op, right in zip(node.ops, node.comparators):
+                if type(op) not in cmpops: fail()
+                right = e(right)
+                c = operation(cmpops[type(op)], left, right)
+                result = c if result is None else operation("where", truth(result), c, ("const", 0.))
+                left = right
+            return result
+        if isinstance(node, ast.BoolOp):
+            result = e(node.values[0])
+            for value in node.values[1:]:
+                value = e(value)
+                if isinstance(node.op, ast.And): result = operation("where", truth(result), value, result)
+                else                           : result = operation("where", truth(result), result, value)
+            return result
+        if isinstance(node, ast.IfExp):
+            return operation("where", truth(e(node.test)), e(node.body), e(node.orelse))
+        if isinstance(node, ast.Call):
+            f = e(node.func)
+            if f[0] != "object" or getattr(node, "starargs", None) or getattr(node, "kwargs", None): fail()
+            args = [e(a) for a in node.args]
+            for f_, name, n in operations:
+                if f_ is f[1]:
+                    if node.keywords or len(args) < 1: fail()
+                    if name in ["min", "max"] and len(args) > 2:
+                        result = args[0]
+                        for a in args[1:]: result = operation(name, result, a)
+                        return result
+                    if len(args) != n: fail()
+                    if name == "where": args[0] = truth(args[0])
+                    return operation(name, *args)
+            if node.keywords:
+                if not inspect.isfunction(f[1]): fail()
+                names = inspect.getfullargspec(f[1]).args if hasattr(inspect, "getfullargspec") else inspect.getargspec(f[1]).args
+                defaults = f[1].__defaults__ or ()
+                args += [None]*(len(names)-len(args))
+                for k in node.keywords:
+                    if k.arg not in names or args[names.index(k.arg)] is not None: fail()
+                    args[names.index(k.arg)] = e(k.value)
+                for i in range(len(names)):
+                    if args[i] is None:
+                        if i < len(names)-len(defaults): fail()
+                        args[i] = toNode(defaults[i-len(names)+len(defaults)])
+            return inline(f[1], args, context[3]+1)
+        fail()
+    # Statements are executed symbolically: the branches of `if` blocks become conditional expressions
+    # Each branch is executed once: the variables that they assign are merged after the `if`, and the body returns
+    # (returned, value), the condition for a `return` to have been executed, and the value returned then
+    def statements(body, env, context):
+        returned, value = ("const", 0.), None
+        def merge(r, v):
+            if r == ("const", 0.): return returned, value
+            if value is None     : return r, v
+            return truth(operation("where", returned, ("const", 1.), r)), operation("where", returned, value, v)
+        for s in body:
+            if isinstance(s, ast.Return):
+                if s.value is None: fail()
+                return merge(("const", 1.), expression(s.value, env, context))
+            elif isinstance(s, ast.Assign):
+                if len(s.targets) != 1: fail()
+                target = s.targets[0]
+                if isinstance(target, ast.Name):
+                    env[target.id] = expression(s.value, env, context)
+                elif isinstance(target, ast.Tuple) and isinstance(s.value, ast.Tuple) and len(target.elts) == len(s.value.elts):
+                    values = [expression(v, env, context) for v in s.value.elts]
+                    for t, v in zip(target.elts, values):
+                        if not isinstance(t, ast.Name): fail()
+                        env[t.id] = v
+                else:
+                    fail()
+            elif isinstance(s, ast.AugAssign):
+                if not isinstance(s.target, ast.Name) or type(s.op) not in binops: fail()
+                env[s.target.id] = operation(binops[type(s.op)], expression(s.target, env, context), expression(s.value, env, context))
+            elif isinstance(s, ast.If):
+                test = truth(expression(s.test, env, context))
+                if test[0] == "const":
+                    returned, value = merge(*statements(s.body if test[1] else s.orelse, env, context))
+                else:
+                    yes_env, no_env = dict(env), dict(env)
+                    yes_returned, yes = statements(s.body  , yes_env, context)
+                    no_returned , no  = statements(s.orelse, no_env , context)
+                    # The variables of a branch that returned are not used after the `if`
+                    # A variable assigned in a single branch is not defined after the `if`
+                    for name in set(yes_env) | set(no_env):
+                        if yes_returned == ("const", 1.) and name in no_env:
+                            env[name] = no_env[name]
+                        elif no_returned == ("const", 1.) and name in yes_env:
+                            env[name] = yes_env[name]
+                        elif name in yes_env and name in no_env:
+                            env[name] = operation("where", test, yes_env[name], no_env[name])
+                        else:
+                            env.pop(name, None)
+                    r = truth(operation("where", test, yes_returned, no_returned))
+                    v = no if yes is None else yes if no is None else operation("where", test, yes, no)
+                    returned, value = merge(r, v)
+                if returned == ("const", 1.):
+                    return returned, value
+            elif isinstance(s, ast.Pass) or (isinstance(s, ast.Expr) and constant(s.value)[0]):
+                pass
+            else:
+                fail()
+        return returned, value
+    # Postfix order, the shared sub-expressions being repeated: programs too long are left to python
+    def emit(node, program):
+        if node[0] == "object" or len(program) > 10000: fail()
+        if node[0] in ["const", "arg"]:
+            program += [(node[0], float(node[1]))]
+        else:
+            for operand in node[1:]:
+                emit(operand, program)
+            program += [(node[0], 0.)]
+        return program
+    try:
+        return emit(inline(function, [("arg", i) for i in range(nargs)], 0), [])
+    except Exception:
+        return None
+
 
 """
 -----------------------------------------------------------------------
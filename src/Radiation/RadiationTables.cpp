@@ -278,8 +278,12 @@ void RadiationTables::compute_h_table(SmileiMPI *smpi)
         // Get the number of ranks
         nb_ranks = smpi->getSize();
 
-        // Allocation of the array h_table
-        h_table.resize(h_dim);
+        // Allocation of the array h_table on the master MPI process,
+        // it is gathered on this process and then shared in each node
+        if (rank==0)
+        {
+            h_table.resize(h_dim);
+        }
 
         // Allocation of the table for load repartition
         imin_table = new int[nb_ranks];
@@ -341,9 +345,12 @@ void RadiationTables::compute_h_table(SmileiMPI *smpi)
         }
 
         // Communication of the data
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &h_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        h_table.share(smpi);
 
         // flag computed at true
         h_computed = true;
@@ -406,8 +413,12 @@ void RadiationTables::compute_integfochi_table(SmileiMPI *smpi)
         // Get the number of ranks
         nb_ranks = smpi->getSize();
 
-        // Allocation of the array integfochi_table
-        integfochi_table.resize(integfochi_dim);
+        // Allocation of the array integfochi_table on the master MPI process,
+        // it is gathered on this process and then shared in each node
+        if (rank==0)
+        {
+            integfochi_table.resize(integfochi_dim);
+        }
 
         // Allocation of the table for load repartition
         imin_table = new int[nb_ranks];
@@ -463,9 +474,12 @@ void RadiationTables::compute_integfochi_table(SmileiMPI *smpi)
         }
 
         // Communication of the data
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &integfochi_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        integfochi_table.share(smpi);
 
         // flag computed at true
         integfochi_computed = true;
@@ -538,11 +552,13 @@ void RadiationTables::compute_xip_table(SmileiMPI *smpi)
         // Get the number of ranks
         nb_ranks = smpi->getSize();
 
-        // Allocation of the array xip_chiphmin_table
-        xip_chiphmin_table.resize(xip_chipa_dim);
-
-        // Allocation of the array xip_table
-        xip_table.resize(xip_chipa_dim*xip_chiph_dim);
+        // Allocation of the arrays xip_chiphmin_table and xip_table on the master MPI process,
+        // they are gathered on this process and then shared in each node
+        if (rank==0)
+        {
+            xip_chiphmin_table.resize(xip_chipa_dim);
+            xip_table.resize(xip_chipa_dim*xip_chiph_dim);
+        }
 
         // Allocation of the table for load repartition
         imin_table = new int[nb_ranks];
@@ -628,9 +644,12 @@ void RadiationTables::compute_xip_table(SmileiMPI *smpi)
         }
 
         // Communication of the xip_chiphmin table
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &xip_chiphmin_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        xip_chiphmin_table.share(smpi);
 
         // 2. - Computation of the xip table
         MESSAGE("            Computation of xip:");
@@ -712,9 +731,12 @@ void RadiationTables::compute_xip_table(SmileiMPI *smpi)
         }
 
         // Communication of the xip table
-        MPI_Allgatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
+        MPI_Gatherv(&buffer[0], length_table[rank], MPI_DOUBLE,
                 &xip_table[0], &length_table[0], &imin_table[0],
-                MPI_DOUBLE, smpi->getGlobalComm());
+                MPI_DOUBLE, 0, smpi->getGlobalComm());
+
+        // Share the table in the memory of each node
+        xip_table.share(smpi);
 
         // flag computed at true
         xip_computed = true;
@@ -1962,9 +1984,6 @@ void RadiationTables::bcast_h_table(SmileiMPI *smpi)
         buf_size = position;
         MPI_Pack_size(2, MPI_DOUBLE, smpi->getGlobalComm(), &position);
         buf_size += position;
-        MPI_Pack_size(h_dim, MPI_DOUBLE, smpi->getGlobalComm(),
-                      &position);
-        buf_size += position;
     }
 
     MESSAGE("            Buffer size: " << buf_size);
@@ -1985,15 +2004,14 @@ void RadiationTables::bcast_h_table(SmileiMPI *smpi)
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
         MPI_Pack(&h_chipa_max,
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&h_table[0],h_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
     }
 
     // Bcast all parameters
     MPI_Bcast(&buffer[0], buf_size, MPI_PACKED, 0,smpi->getGlobalComm());
 
+    // Share the table in the memory of each node
+    h_table.share(smpi);
+
     // Other ranks unpack
     if (smpi->getRank() != 0)
     {
@@ -2004,13 +2022,6 @@ void RadiationTables::bcast_h_table(SmileiMPI *smpi)
                    &h_chipa_min, 1, MPI_DOUBLE,smpi->getGlobalComm());
         MPI_Unpack(buffer, buf_size, &position,
                    &h_chipa_max, 1, MPI_DOUBLE,smpi->getGlobalComm());
-
-        // Resize table before unpacking values
-        h_table.resize(h_dim);
-
-        MPI_Unpack(buffer, buf_size, &position,&h_table[0],
-                    h_dim, MPI_DOUBLE,smpi->getGlobalComm());
-
     }
 
     h_log10_chipa_min = log10(h_chipa_min);
@@ -2047,9 +2058,6 @@ void RadiationTables::bcast_integfochi_table(SmileiMPI *smpi)
         buf_size = position;
         MPI_Pack_size(2, MPI_DOUBLE, smpi->getGlobalComm(), &position);
         buf_size += position;
-        MPI_Pack_size(integfochi_dim, MPI_DOUBLE, smpi->getGlobalComm(),
-                      &position);
-        buf_size += position;
     }
 
     MESSAGE("            Buffer size: " << buf_size);
@@ -2070,15 +2078,14 @@ void RadiationTables::bcast_integfochi_table(SmileiMPI *smpi)
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
         MPI_Pack(&integfochi_chipa_max,
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&integfochi_table[0],integfochi_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
     }
 
     // Bcast all parameters
     MPI_Bcast(&buffer[0], buf_size, MPI_PACKED, 0,smpi->getGlobalComm());
 
+    // Share the table in the memory of each node
+    integfochi_table.share(smpi);
+
     // Other ranks unpack
     if (smpi->getRank() != 0)
     {
@@ -2089,13 +2096,6 @@ void RadiationTables::bcast_integfochi_table(SmileiMPI *smpi)
                    &integfochi_chipa_min, 1, MPI_DOUBLE,smpi->getGlobalComm());
         MPI_Unpack(buffer, buf_size, &position,
                    &integfochi_chipa_max, 1, MPI_DOUBLE,smpi->getGlobalComm());
-
-        // Resize table before unpacking values
-        integfochi_table.resize(integfochi_dim);
-
-        MPI_Unpack(buffer, buf_size, &position,&integfochi_table[0],
-                    integfochi_dim, MPI_DOUBLE,smpi->getGlobalComm());
-
     }
 
     integfochi_log10_chipa_min = log10(integfochi_chipa_min);
@@ -2132,12 +2132,6 @@ void RadiationTables::bcast_xip_table(SmileiMPI *smpi)
         buf_size = position;
         MPI_Pack_size(2, MPI_DOUBLE, smpi->getGlobalComm(), &position);
         buf_size += position;
-        MPI_Pack_size(xip_chipa_dim, MPI_DOUBLE, smpi->getGlobalComm(),
-                      &position);
-        buf_size += position;
-        MPI_Pack_size(xip_chipa_dim*xip_chiph_dim, MPI_DOUBLE,
-                      smpi->getGlobalComm(), &position);
-        buf_size += position;
     }
 
     MESSAGE("            Buffer size for MPI exchange: " << buf_size);
@@ -2160,17 +2154,15 @@ void RadiationTables::bcast_xip_table(SmileiMPI *smpi)
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
         MPI_Pack(&xip_chipa_max,
              1,MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&xip_chiphmin_table[0],xip_chipa_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
-
-        MPI_Pack(&xip_table[0],xip_chipa_dim*xip_chiph_dim,
-            MPI_DOUBLE,buffer,buf_size,&position,smpi->getGlobalComm());
     }
 
     // Bcast all parameters
     MPI_Bcast(&buffer[0], buf_size, MPI_PACKED, 0,smpi->getGlobalComm());
 
+    // Share the tables in the memory of each node
+    xip_chiphmin_table.share(smpi);
+    xip_table.share(smpi);
+
     // Other ranks unpack
     if (smpi->getRank() != 0)
     {
@@ -2183,16 +2175,6 @@ void RadiationTables::bcast_xip_table(SmileiMPI *smpi)
                    &xip_chipa_min, 1, MPI_DOUBLE,smpi->getGlobalComm());
         MPI_Unpack(buffer, buf_size, &position,
                    &xip_chipa_max, 1, MPI_DOUBLE,smpi->getGlobalComm());
-
-        // Resize tables before unpacking values
-        xip_chiphmin_table.resize(xip_chipa_dim);
-        xip_table.resize(xip_chipa_dim*xip_chiph_dim);
-
-        MPI_Unpack(buffer, buf_size, &position,&xip_chiphmin_table[0],
-                    xip_chipa_dim, MPI_DOUBLE,smpi->getGlobalComm());
-
-        MPI_Unpack(buffer, buf_size, &position,&xip_table[0],
-            xip_chipa_dim*xip_chiph_dim, MPI_DOUBLE,smpi->getGlobalComm());
     }
 
     // Log10 of xip_chipa_min for efficiency
@@ -19,6 +19,7 @@
 
 #include "Params.h"
 #include "H5.h"
+#include "NodeSharedTable.h"
 
 //------------------------------------------------------------------------------
 //! RadiationTables class: holds parameters, tables and functions to compute
@@ -300,7 +301,7 @@ class RadiationTables
 
         //! Array containing tabulated values of the function h for the
         //! stochastic diffusive operator of Niel et al.
-        std::vector<double > h_table;
+        NodeSharedTable h_table;
 
         //! Minimum boundary of the table h
         double h_chipa_min;
@@ -335,7 +336,7 @@ class RadiationTables
         //! (which is also the optical depth for the Monte-Carlo process).
         //! This table is the integration of the Synchrotron emissivity
         //! refers to as F over the quantum parameter Chi.
-        std::vector<double > integfochi_table;
+        NodeSharedTable integfochi_table;
 
         //! Minimum boundary of the table integfochi_table
         double integfochi_chipa_min;
@@ -365,7 +366,7 @@ class RadiationTables
         //! Table containing the chiph min values
         //! Under this value, photon energy is
         //! considered negligible
-        std::vector<double > xip_chiphmin_table;
+        NodeSharedTable xip_chiphmin_table;
 
         // ---------------------------------------------
         // Table xip
@@ -373,7 +374,7 @@ class RadiationTables
 
         //! Table containing the cumulative distribution function \f$P(0 \rightarrow \chi_{\gamma})\f$
         //! that gives gives the probability for a photon emission in the range \f$[0, \chi_{\gamma}]\f$
-        std::vector<double> xip_table;
+        NodeSharedTable xip_table;
 
         //! Minimum boundary for chipa in the table xip and xip_chiphmin
         double xip_chipa_min;
@@ -210,7 +210,15 @@ int main (int argc, char* argv[])
         // Init electric field (Ex/1D, + Ey/2D)
         if (!vecPatches.isRhoNull(&smpi) && params.solve_poisson == true) {
             TITLE("Solving Poisson at time t = 0");
-            vecPatches.solvePoisson( params, &smpi );
+            if ( params.poisson_solver == "FFT" ) {
+                // One slab of patches per MPI process, for the duration of the solve
+                Domain poisson_domain( params, params.poisson_fft_factor );
+                poisson_domain.build( params, &smpi, vecPatches, openPMD );
+                vecPatches.solvePoisson( params, &smpi, &poisson_domain );
+                poisson_domain.clean();
+            }
+            else
+                vecPatches.solvePoisson( params, &smpi );
         }
 
         TITLE("Applying external fields at time t = 0");
@@ -238,17 +246,19 @@ int main (int argc, char* argv[])
     timers.reboot();
 
 
-    Domain domain( params ); 
+    Domain domain( params, params.global_factor ); 
     unsigned int global_factor(1);
-    #ifdef _PICSAR
-    for ( unsigned int iDim = 0 ; iDim < params.nDim_field ; iDim++ )
-        global_factor *= params.global_factor[iDim];
-    // Force temporary usage of double grids, even if global_factor = 1
-    //    especially to compare solvers
-    //if (global_factor!=1) {
+    if ( params.uncoupled_grids ) {
+        for ( unsigned int iDim = 0 ; iDim < params.nDim_field ; iDim++ )
+            global_factor *= params.global_factor[iDim];
         domain.build( params, &smpi, vecPatches, openPMD );
-    //}
-    #endif
+        SyncCartesianPatch::patchedToCartesianFields( vecPatches, domain, params, &smpi );
+    }
+
+    if ( params.supergrid ) {
+        TITLE("Gathering the fields of the patches in one grid per MPI process");
+        vecPatches.buildSuperGrid( params, &smpi );
+    }
 
     timers.global.reboot();
     
@@ -330,27 +340,16 @@ int main (int argc, char* argv[])
             vecPatches.applyAntennas(time_dual);
             
             // solve Maxwell's equations
-            #ifndef _PICSAR
-            // Force temporary usage of double grids, even if global_factor = 1
-            //    especially to compare solvers           
-            //if ( global_factor==1 )
-            {
-                if( time_dual > params.time_fields_frozen ) {
+            if( time_dual > params.time_fields_frozen ) {
+                if ( !params.uncoupled_grids ) {
                     vecPatches.solveMaxwell( params, simWindow, itime, time_dual, timers );
-                }
-            }
-            #else
-            // Force temporary usage of double grids, even if global_factor = 1
-            //    especially to compare solvers           
-            //if ( global_factor!=1 )
-            {
-                if( time_dual > params.time_fields_frozen ) {
+                } else {
+                    // Fields solved on the Domain (spectral solvers)
                     SyncCartesianPatch::patchedToCartesian( vecPatches, domain, params, &smpi, timers, itime );
                     domain.solveMaxwell( params, simWindow, itime, time_dual, timers );
                     SyncCartesianPatch::cartesianToPatches( domain, vecPatches, params, &smpi, timers, itime );
                 }
             }
-            #endif
 
             vecPatches.finalize_and_sort_parts(params, &smpi, simWindow, RadiationTables,
                                                MultiphotonBreitWheelerTables,
@@ -422,7 +421,7 @@ int main (int argc, char* argv[])
     // ------------------------------
     //  Cleanup & End the simulation
     // ------------------------------
-    if (global_factor!=1) 
+    if ( params.uncoupled_grids )
         domain.clean();
     vecPatches.close( &smpi );
     smpi.barrier(); // Don't know why but sync needed by HDF5 Phasespace managment
@@ -0,0 +1,623 @@
+
+#include "AggregatedMPIbuffers.h"
+#include "Field.h"
+#include "Patch.h"
+#include "VectorPatch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create the persistent requests exchanging sbuf and rbuf with all the neighbors of the graph communicator comm
+//   - MPI-4 : 1 persistent neighborhood collective
+//   - otherwise : 1 MPI_Recv_init and 1 MPI_Send_init per neighbor with a non empty message, started in the same
+//     order by all MPI processes
+// ---------------------------------------------------------------------------------------------------------------------
+static void createNeighborRequests( void* sbuf, vector<int>& scounts, vector<int>& sdispls,
+                                    void* rbuf, vector<int>& rcounts, vector<int>& rdispls,
+                                    MPI_Datatype type, MPI_Comm comm, int tag, vector<MPI_Request>& requests )
+{
+#if MPI_VERSION >= 4
+    requests.resize( 1 );
+    MPI_Neighbor_alltoallv_init( sbuf, &( scounts[0] ), &( sdispls[0] ), type,
+                                 rbuf, &( rcounts[0] ), &( rdispls[0] ), type,
+                                 comm, MPI_INFO_NULL, &requests[0] );
+#else
+    int indegree, outdegree, weighted;
+    MPI_Dist_graph_neighbors_count( comm, &indegree, &outdegree, &weighted );
+    vector<int> sources( max( indegree, 1 ) ), destinations( max( outdegree, 1 ) );
+    MPI_Dist_graph_neighbors( comm, indegree, &sources[0], MPI_UNWEIGHTED, outdegree, &destinations[0], MPI_UNWEIGHTED );
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent( type, &lb, &extent );
+
+    requests.clear();
+    for ( int ineighbor=0 ; ineighbor<indegree ; ineighbor++ ) {
+        if ( rcounts[ineighbor] == 0 ) continue;
+        requests.push_back( MPI_REQUEST_NULL );
+        MPI_Recv_init( (char*)rbuf + rdispls[ineighbor]*extent, rcounts[ineighbor], type, sources[ineighbor], tag,
+                       comm, &requests.back() );
+    }
+    for ( int ineighbor=0 ; ineighbor<outdegree ; ineighbor++ ) {
+        if ( scounts[ineighbor] == 0 ) continue;
+        requests.push_back( MPI_REQUEST_NULL );
+        MPI_Send_init( (char*)sbuf + sdispls[ineighbor]*extent, scounts[ineighbor], type, destinations[ineighbor], tag,
+                       comm, &requests.back() );
+    }
+#endif
+}
+
+
+// Free persistent requests, unless MPI is already finalized
+static void freeRequests( vector<MPI_Request>& requests )
+{
+    int finalized;
+    MPI_Finalized( &finalized );
+    for ( unsigned int ireq=0 ; ireq<requests.size() ; ireq++ )
+        if ( !finalized && requests[ireq] != MPI_REQUEST_NULL )
+            MPI_Request_free( &requests[ireq] );
+    requests.clear();
+}
+
+
+AggregatedMPIbuffers::AggregatedMPIbuffers()
+{
+    iDim_ = 0;
+    sum_  = false;
+    comm_ = MPI_COMM_NULL;
+    pending_ = false;
+    requestsCreated_ = false;
+    tag_ = 0;
+}
+
+
+AggregatedMPIbuffers::~AggregatedMPIbuffers()
+{
+    freeRequests( requests_ );
+    for ( unsigned int ipart=0 ; ipart<partitionRequests_.size() ; ipart++ )
+        freeRequests( partitionRequests_[ipart] );
+}
+
+
+// Forget the messages and free the persistent requests, before a new build or before MPI_Finalize
+void AggregatedMPIbuffers::clear()
+{
+    freeRequests( requests_ );
+    requestsCreated_ = false;
+    messages_.clear();
+    sbuf_.clear();
+    rbuf_.clear();
+    scounts_.clear();
+    sdispls_.clear();
+    rcounts_.clear();
+    rdispls_.clear();
+    packList_.clear();
+    unpackList_[0].clear();
+    unpackList_[1].clear();
+    pending_ = false;
+    thread_comms_.clear();
+    sendPartitions_.clear();
+    recvPartitions_.clear();
+    for ( unsigned int ipart=0 ; ipart<partitionRequests_.size() ; ipart++ )
+        freeRequests( partitionRequests_[ipart] );
+    partitionRequests_.clear();
+    threadPending_.clear();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Build the messages exchanged along iDim
+//   - strips sent to side s are sorted by the hindex of the sending patch
+//   - strips received from side s are sorted by the hindex of the neighbor on side s, which sent them
+//   so that both processes agree on the content of the buffer without exchanging it
+// The messages of both sides are concatenated per neighbor of comm : sides 0 then 1 in the sent buffer, sides 1 then 0
+// in the received buffer (the strips sent to side 0 are received from side 1)
+// With thread_comms, the message of each neighbor is split in partitions of consecutive strips instead
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::build( VectorPatch& vecPatches, vector<Field*>& fields, vector<int>& MPIIdx, unsigned int ncomp,
+                                  unsigned int iDim, bool sum, MPI_Comm comm, vector<MPI_Comm>& thread_comms )
+{
+    clear();
+    iDim_ = iDim;
+    sum_  = sum;
+    comm_ = comm;
+    if ( comm_ == MPI_COMM_NULL ) return;
+    thread_comms_ = thread_comms;
+    tag_ = 3*sum + iDim;
+    sendPartitions_.resize( thread_comms_.size() );
+    recvPartitions_.resize( thread_comms_.size() );
+
+    unsigned int nMPI = MPIIdx.size();
+    unsigned int oversize = vecPatches(0)->EMfields->oversize[iDim];
+
+    // Patches (index in MPIIdx) sorted by key, per (rank, side)
+    map< pair<int,int>, vector< pair<unsigned int,unsigned int> > > toSend, toRecv;
+    for ( unsigned int ifield=0 ; ifield<nMPI ; ifield++ ) {
+        Patch* patch = vecPatches( MPIIdx[ifield] );
+        for ( int side=0 ; side<2 ; side++ ) {
+            if ( !patch->is_a_MPI_neighbor( iDim, side ) ) continue;
+            pair<int,int> channel( patch->MPI_neighbor_[iDim][side], side );
+            toSend[channel].push_back( make_pair( patch->hindex, ifield ) );
+            toRecv[channel].push_back( make_pair( (unsigned int)patch->neighbor_[iDim][side], ifield ) );
+        }
+    }
+
+    map< pair<int,int>, unsigned int > messageIndex;
+    for ( map< pair<int,int>, vector< pair<unsigned int,unsigned int> > >::iterator it = toSend.begin() ; it != toSend.end() ; it++ ) {
+        Message msg;
+        msg.rank = it->first.first;
+        msg.side = it->first.second;
+
+        vector< pair<unsigned int,unsigned int> >& sendPatches = it->second;
+        vector< pair<unsigned int,unsigned int> >& recvPatches = toRecv[it->first];
+        sort( sendPatches.begin(), sendPatches.end() );
+        sort( recvPatches.begin(), recvPatches.end() );
+
+        unsigned int soffset(0), roffset(0);
+        for ( unsigned int ip=0 ; ip<sendPatches.size() ; ip++ ) {
+            for ( unsigned int icomp=0 ; icomp<ncomp ; icomp++ ) {
+                Field* field = fields[ icomp*nMPI + sendPatches[ip].second ];
+                unsigned int n    = field->dims_[iDim];
+                unsigned int gsp  = oversize + 1 + field->isDual_[iDim];
+                unsigned int size = field->globalDims_ / n;
+
+                Strip strip;
+                strip.field = field;
+                if ( sum ) {
+                    strip.width = oversize + gsp;
+                    strip.start = msg.side * ( n - strip.width );
+                } else {
+                    strip.width = oversize;
+                    strip.start = msg.side ? n - oversize - gsp : gsp;
+                }
+                strip.offset = soffset;
+                soffset += strip.width * size;
+                msg.send.push_back( strip );
+            }
+        }
+        for ( unsigned int ip=0 ; ip<recvPatches.size() ; ip++ ) {
+            for ( unsigned int icomp=0 ; icomp<ncomp ; icomp++ ) {
+                Field* field = fields[ icomp*nMPI + recvPatches[ip].second ];
+                unsigned int n    = field->dims_[iDim];
+                unsigned int gsp  = oversize + 1 + field->isDual_[iDim];
+                unsigned int size = field->globalDims_ / n;
+
+                Strip strip;
+                strip.field = field;
+                if ( sum ) {
+                    strip.width = oversize + gsp;
+                    strip.start = msg.side * ( n - strip.width );
+                } else {
+                    strip.width = oversize;
+                    strip.start = msg.side * ( n - oversize );
+                }
+                // Rows shared between the patches of the grid of the MPI process unpacked by their owner only
+                strip.rows[0] = 0;
+                strip.rows[1] = field->dims_[0];
+                if ( !sum && iDim > 0 )
+                    vecPatches.supergrid_.ownedRows( MPIIdx[recvPatches[ip].second], field, strip.rows[0], strip.rows[1] );
+                strip.offset = roffset;
+                roffset += strip.width * size;
+                msg.recv.push_back( strip );
+            }
+        }
+        msg.ssize = soffset;
+        msg.rsize = roffset;
+        messageIndex[it->first] = messages_.size();
+        messages_.push_back( msg );
+    }
+
+    // Position of the messages in the buffers of the exchange
+    int indegree, outdegree, weighted;
+    MPI_Dist_graph_neighbors_count( comm_, &indegree, &outdegree, &weighted );
+    vector<int> sources( max( indegree, 1 ) ), destinations( max( outdegree, 1 ) );
+    MPI_Dist_graph_neighbors( comm_, indegree, &sources[0], MPI_UNWEIGHTED, outdegree, &destinations[0], MPI_UNWEIGHTED );
+
+    // Arrays of size 1 at least, so that their addresses are valid without neighbor
+    scounts_.resize( max( outdegree, 1 ), 0 );
+    sdispls_.resize( max( outdegree, 1 ), 0 );
+    rcounts_.resize( max( indegree, 1 ), 0 );
+    rdispls_.resize( max( indegree, 1 ), 0 );
+    unsigned int soffset(0), roffset(0), nplaced(0);
+    for ( int ineighbor=0 ; ineighbor<outdegree ; ineighbor++ ) {
+        sdispls_[ineighbor] = soffset;
+        vector< pair<unsigned int,unsigned int> > strips;
+        for ( int side=0 ; side<2 ; side++ ) {
+            map< pair<int,int>, unsigned int >::iterator it = messageIndex.find( make_pair( destinations[ineighbor], side ) );
+            if ( it == messageIndex.end() ) continue;
+            Message& msg = messages_[it->second];
+            for ( unsigned int istrip=0 ; istrip<msg.send.size() ; istrip++ ) {
+                msg.send[istrip].offset += soffset;
+                strips.push_back( make_pair( it->second, istrip ) );
+            }
+            soffset += msg.ssize;
+            nplaced++;
+        }
+        scounts_[ineighbor] = soffset - sdispls_[ineighbor];
+        split( destinations[ineighbor], strips, soffset, true );
+    }
+    for ( int ineighbor=0 ; ineighbor<indegree ; ineighbor++ ) {
+        rdispls_[ineighbor] = roffset;
+        vector< pair<unsigned int,unsigned int> > strips;
+        for ( int side=1 ; side>=0 ; side-- ) {
+            map< pair<int,int>, unsigned int >::iterator it = messageIndex.find( make_pair( sources[ineighbor], side ) );
+            if ( it == messageIndex.end() ) continue;
+            Message& msg = messages_[it->second];
+            for ( unsigned int istrip=0 ; istrip<msg.recv.size() ; istrip++ ) {
+                msg.recv[istrip].offset += roffset;
+                strips.push_back( make_pair( it->second, istrip ) );
+            }
+            roffset += msg.rsize;
+        }
+        rcounts_[ineighbor] = roffset - rdispls_[ineighbor];
+        split( sources[ineighbor], strips, roffset, false );
+    }
+    if ( nplaced != messages_.size() )
+        ERROR( "An MPI neighbor along dimension " << iDim << " is not a neighbor of the graph communicator" );
+    sbuf_.resize( max( soffset, 1u ) );
+    rbuf_.resize( max( roffset, 1u ) );
+
+    for ( unsigned int imsg=0 ; imsg<messages_.size() ; imsg++ ) {
+        for ( unsigned int istrip=0 ; istrip<messages_[imsg].send.size() ; istrip++ )
+            packList_.push_back( make_pair( imsg, istrip ) );
+        for ( unsigned int istrip=0 ; istrip<messages_[imsg].recv.size() ; istrip++ )
+            unpackList_[messages_[imsg].side].push_back( make_pair( imsg, istrip ) );
+    }
+
+    partitionRequests_.resize( thread_comms_.size() );
+    for ( unsigned int ipart=0 ; ipart<thread_comms_.size() ; ipart++ )
+        partitionRequests_[ipart].resize( recvPartitions_[ipart].size() + sendPartitions_[ipart].size(), MPI_REQUEST_NULL );
+    threadPending_.resize( thread_comms_.size(), false );
+
+} // END build
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split the strips exchanged with rank in partitions of consecutive strips, the partition ipart holding the strips
+// [ipart*nstrips/npartitions, (ipart+1)*nstrips/npartitions[
+// The strips sent by a process and received by the other are the same, so that both agree on the partitions
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::split( int rank, vector< pair<unsigned int,unsigned int> >& strips, unsigned int end, bool send )
+{
+    unsigned int npartitions = thread_comms_.size();
+    unsigned int nstrips = strips.size();
+    for ( unsigned int ipart=0 ; ipart<npartitions ; ipart++ ) {
+        unsigned int first = ipart*nstrips/npartitions;
+        unsigned int last  = ( ipart+1 )*nstrips/npartitions;
+        if ( first == last ) continue;
+
+        Partition partition;
+        partition.rank = rank;
+        if ( send ) {
+            partition.offset = messages_[strips[first].first].send[strips[first].second].offset;
+            partition.size = ( last<nstrips ? messages_[strips[last].first].send[strips[last].second].offset : end ) - partition.offset;
+            partition.strips.assign( strips.begin()+first, strips.begin()+last );
+            sendPartitions_[ipart].push_back( partition );
+        } else {
+            partition.offset = messages_[strips[first].first].recv[strips[first].second].offset;
+            partition.size = ( last<nstrips ? messages_[strips[last].first].recv[strips[last].second].offset : end ) - partition.offset;
+            recvPartitions_[ipart].push_back( partition );
+        }
+    }
+
+} // END split
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack the strips and start the persistent requests of the exchange, called by all threads
+// Nothing is done if the exchange was already started (VectorPatch::dynamics or solveMaxwell start it as soon as
+// the patches with an MPI neighbor are computed)
+// The requests are created at the first init after build: the buffers do not move until the next build, but the
+// VectorPatch returned by PatchesFactory::createVector is copied
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::init()
+{
+    if ( comm_ == MPI_COMM_NULL ) return;
+    if ( !thread_comms_.empty() ) {
+        initPartitions();
+        return;
+    }
+    if ( pending_ ) return;
+
+    #pragma omp for schedule(dynamic)
+    for ( unsigned int i=0 ; i<packList_.size() ; i++ ) {
+        Message& msg = messages_[ packList_[i].first ];
+        Strip& strip = msg.send[ packList_[i].second ];
+        copyStrip( strip, &( sbuf_[strip.offset] ), true );
+    }
+
+    #pragma omp single
+    {
+        if ( !requestsCreated_ ) {
+            createNeighborRequests( &( sbuf_[0] ), scounts_, sdispls_, &( rbuf_[0] ), rcounts_, rdispls_,
+                                    SMILEI_MPI_FIELD, comm_, tag_, requests_ );
+            requestsCreated_ = true;
+        }
+        if ( requests_.size() )
+            MPI_Startall( requests_.size(), &requests_[0] );
+        pending_ = true;
+    }
+
+} // END init
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create the persistent requests of the partitions ipart, on their thread communicator (receptions then sendings)
+// Called by the thread of the partitions at their first init after build (see init)
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::createPartitionRequests( unsigned int ipart )
+{
+    vector<Partition>& recv = recvPartitions_[ipart];
+    vector<Partition>& send = sendPartitions_[ipart];
+    vector<MPI_Request>& requests = partitionRequests_[ipart];
+    for ( unsigned int i=0 ; i<recv.size() ; i++ )
+        MPI_Recv_init( &( rbuf_[recv[i].offset] ), recv[i].size, SMILEI_MPI_FIELD, recv[i].rank, tag_,
+                       thread_comms_[ipart], &requests[i] );
+    for ( unsigned int i=0 ; i<send.size() ; i++ )
+        MPI_Send_init( &( sbuf_[send[i].offset] ), send[i].size, SMILEI_MPI_FIELD, send[i].rank, tag_,
+                       thread_comms_[ipart], &requests[recv.size()+i] );
+
+} // END createPartitionRequests
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Start the receptions of the partitions of the current thread, then pack and start each sending as soon as it is
+// packed
+// Nothing is done if the thread already started its partitions
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::initPartitions()
+{
+    int ithread( 0 ), nthreads( 1 );
+#ifdef _OPENMP
+    ithread  = omp_get_thread_num();
+    nthreads = omp_get_num_threads();
+#endif
+    if ( threadPending_[ithread] ) return;
+
+    for ( unsigned int ipart=ithread ; ipart<thread_comms_.size() ; ipart+=nthreads ) {
+        vector<Partition>& recv = recvPartitions_[ipart];
+        vector<Partition>& send = sendPartitions_[ipart];
+        vector<MPI_Request>& requests = partitionRequests_[ipart];
+        if ( requests.size() && requests[0] == MPI_REQUEST_NULL )
+            createPartitionRequests( ipart );
+        if ( recv.size() )
+            MPI_Startall( recv.size(), &requests[0] );
+        for ( unsigned int i=0 ; i<send.size() ; i++ ) {
+            for ( unsigned int istrip=0 ; istrip<send[i].strips.size() ; istrip++ ) {
+                Strip& strip = messages_[ send[i].strips[istrip].first ].send[ send[i].strips[istrip].second ];
+                copyStrip( strip, &( sbuf_[strip.offset] ), true );
+            }
+            MPI_Start( &requests[recv.size()+i] );
+        }
+    }
+    threadPending_[ithread] = true;
+
+} // END initPartitions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Wait for the exchange (or for the partitions of each thread) and unpack the strips, called by all threads
+// Strips received from side 1 are unpacked before those from side 0, as in Patch::finalizeSumField
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::finalize()
+{
+    if ( !thread_comms_.empty() ) {
+        int ithread( 0 ), nthreads( 1 );
+#ifdef _OPENMP
+        ithread  = omp_get_thread_num();
+        nthreads = omp_get_num_threads();
+#endif
+        if ( !threadPending_[ithread] ) return;
+        for ( unsigned int ipart=ithread ; ipart<thread_comms_.size() ; ipart+=nthreads ) {
+            vector<MPI_Request>& requests = partitionRequests_[ipart];
+            if ( requests.size() > 0 )
+                MPI_Waitall( requests.size(), &requests[0], MPI_STATUSES_IGNORE );
+        }
+        threadPending_[ithread] = false;
+        // The strips of a field may have been received by other threads
+        #pragma omp barrier
+    } else {
+        if ( !pending_ ) return;
+
+        #pragma omp single
+        if ( requests_.size() )
+            MPI_Waitall( requests_.size(), &requests_[0], MPI_STATUSES_IGNORE );
+    }
+
+    for ( int side=1 ; side>=0 ; side-- ) {
+        #pragma omp for schedule(dynamic)
+        for ( unsigned int i=0 ; i<unpackList_[side].size() ; i++ ) {
+            Message& msg = messages_[ unpackList_[side][i].first ];
+            Strip& strip = msg.recv[ unpackList_[side][i].second ];
+            copyStrip( strip, &( rbuf_[strip.offset] ), false );
+        }
+    }
+
+    #pragma omp single nowait
+    pending_ = false;
+
+} // END finalize
+
+
+// Copy the strip [start, start+width[ along iDim_ of a field from or to a contiguous buffer
+void AggregatedMPIbuffers::copyStrip( Strip& strip, field_t* buf, bool toBuffer )
+{
+    Field* field = strip.field;
+    unsigned int n[3] = { 1, 1, 1 };
+    for ( unsigned int i=0 ; i<field->dims_.size() ; i++ )
+        n[i] = field->dims_[i];
+
+    unsigned int lo[3] = { 0, 0, 0 };
+    unsigned int hi[3] = { n[0], n[1], n[2] };
+    lo[iDim_] = strip.start;
+    hi[iDim_] = strip.start + strip.width;
+    unsigned int len = hi[2]-lo[2];
+    // Received strip : only its rows along X owned by the patch (see SuperGrid::ownedRows)
+    if ( !toBuffer && iDim_ > 0 ) {
+        buf += ( strip.rows[0]-lo[0] )*( hi[1]-lo[1] )*len;
+        lo[0] = strip.rows[0];
+        hi[0] = strip.rows[1];
+    }
+
+    for ( unsigned int i=lo[0] ; i<hi[0] ; i++ ) {
+        for ( unsigned int j=lo[1] ; j<hi[1] ; j++ ) {
+            field_t* f = &( field->data_[ ( i*n[1] + j )*n[2] + lo[2] ] );
+            if ( toBuffer )
+                memcpy( buf, f, len*sizeof( field_t ) );
+            else if ( !sum_ )
+                memcpy( f, buf, len*sizeof( field_t ) );
+            else
+                for ( unsigned int k=0 ; k<len ; k++ )
+                    f[k] += buf[k];
+            buf += len;
+        }
+    }
+
+} // END copyStrip
+
+
+AggregatedParticlesCounts::AggregatedParticlesCounts()
+{
+    nspecies_ = 0;
+    comm_ = MPI_COMM_NULL;
+    requestsCreated_ = false;
+}
+
+
+AggregatedParticlesCounts::~AggregatedParticlesCounts()
+{
+    freeRequests( requests_ );
+}
+
+
+// Forget the messages and free the persistent requests, before a new build or before MPI_Finalize
+void AggregatedParticlesCounts::clear()
+{
+    freeRequests( requests_ );
+    requestsCreated_ = false;
+    send_.clear();
+    recv_.clear();
+    sbuf_.clear();
+    rbuf_.clear();
+    scounts_.clear();
+    sdispls_.clear();
+    rcounts_.clear();
+    rdispls_.clear();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Build the messages of numbers of particles
+//   - numbers sent to a process are sorted by (hindex of the sending patch, neighbor index)
+//   - numbers received from a process are sorted by (hindex of the neighbor which sent them, neighbor index)
+//   so that both processes agree on the content of the buffer without exchanging it
+// The patch which sends particles moving of o to its neighbor o (ineighbor) is the neighbor -o (nneighbors-1-ineighbor)
+// of the receiving patch
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedParticlesCounts::build( VectorPatch& vecPatches, MPI_Comm comm )
+{
+    clear();
+    comm_ = comm;
+    if ( comm_ == MPI_COMM_NULL ) return;
+    nspecies_ = vecPatches(0)->vecSpecies.size();
+
+    // ((hindex, neighbor index), patch index) per rank
+    map< int, vector< pair< pair<int,int>, unsigned int > > > toSend, toRecv;
+    for ( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        Patch* patch = vecPatches( ipatch );
+        int nneighbors = patch->particle_neighbor_.size();
+        for ( int ineighbor=0 ; ineighbor<nneighbors ; ineighbor++ ) {
+            if ( ineighbor == nneighbors/2 ) continue;
+            if ( ( patch->particle_neighbor_[ineighbor] != MPI_PROC_NULL )
+              && ( patch->MPI_particle_neighbor_[ineighbor] != patch->MPI_me_ ) )
+                toSend[ patch->MPI_particle_neighbor_[ineighbor] ].push_back( make_pair( make_pair( patch->hindex, ineighbor ), ipatch ) );
+            int jneighbor = nneighbors-1-ineighbor;
+            if ( ( patch->particle_neighbor_[jneighbor] != MPI_PROC_NULL )
+              && ( patch->MPI_particle_neighbor_[jneighbor] != patch->MPI_me_ ) )
+                toRecv[ patch->MPI_particle_neighbor_[jneighbor] ].push_back( make_pair( make_pair( patch->particle_neighbor_[jneighbor], ineighbor ), ipatch ) );
+        }
+    }
+
+    int indegree, outdegree, weighted;
+    MPI_Dist_graph_neighbors_count( comm_, &indegree, &outdegree, &weighted );
+    vector<int> sources( max( indegree, 1 ) ), destinations( max( outdegree, 1 ) );
+    MPI_Dist_graph_neighbors( comm_, indegree, &sources[0], MPI_UNWEIGHTED, outdegree, &destinations[0], MPI_UNWEIGHTED );
+
+    // Arrays of size 1 at least, so that their addresses are valid without neighbor
+    scounts_.resize( max( outdegree, 1 ), 0 );
+    sdispls_.resize( max( outdegree, 1 ), 0 );
+    rcounts_.resize( max( indegree, 1 ), 0 );
+    rdispls_.resize( max( indegree, 1 ), 0 );
+    unsigned int nplaced(0);
+    for ( int ineighbor=0 ; ineighbor<outdegree ; ineighbor++ ) {
+        sdispls_[ineighbor] = send_.size() * nspecies_;
+        map< int, vector< pair< pair<int,int>, unsigned int > > >::iterator it = toSend.find( destinations[ineighbor] );
+        if ( it != toSend.end() ) {
+            sort( it->second.begin(), it->second.end() );
+            for ( unsigned int i=0 ; i<it->second.size() ; i++ )
+                send_.push_back( make_pair( it->second[i].second, it->second[i].first.second ) );
+            nplaced++;
+        }
+        scounts_[ineighbor] = send_.size() * nspecies_ - sdispls_[ineighbor];
+    }
+    for ( int ineighbor=0 ; ineighbor<indegree ; ineighbor++ ) {
+        rdispls_[ineighbor] = recv_.size() * nspecies_;
+        map< int, vector< pair< pair<int,int>, unsigned int > > >::iterator it = toRecv.find( sources[ineighbor] );
+        if ( it != toRecv.end() ) {
+            sort( it->second.begin(), it->second.end() );
+            for ( unsigned int i=0 ; i<it->second.size() ; i++ )
+                recv_.push_back( make_pair( it->second[i].second, it->second[i].first.second ) );
+        }
+        rcounts_[ineighbor] = recv_.size() * nspecies_ - rdispls_[ineighbor];
+    }
+    if ( nplaced != toSend.size() )
+        ERROR( "An MPI neighbor of the patches is not a neighbor of the graph communicator" );
+    sbuf_.resize( max( (unsigned int)send_.size() * nspecies_, 1u ) );
+    rbuf_.resize( max( (unsigned int)recv_.size() * nspecies_, 1u ) );
+
+} // END build
+
+
+// Gather the numbers of particles to send and start the persistent requests (created at the first call after build,
+// see AggregatedMPIbuffers::init), called by all threads
+void AggregatedParticlesCounts::init( VectorPatch& vecPatches )
+{
+    if ( comm_ == MPI_COMM_NULL ) return;
+
+    #pragma omp single
+    {
+        for ( unsigned int i=0 ; i<send_.size() ; i++ ) {
+            vector<int>& send_sz = vecPatches( send_[i].first )->particlesMPIbuff.send_sz[ send_[i].second ];
+            copy( send_sz.begin(), send_sz.end(), sbuf_.begin() + i*nspecies_ );
+        }
+        if ( !requestsCreated_ ) {
+            createNeighborRequests( &( sbuf_[0] ), scounts_, sdispls_, &( rbuf_[0] ), rcounts_, rdispls_,
+                                    MPI_INT, comm_, 0, requests_ );
+            requestsCreated_ = true;
+        }
+        if ( requests_.size() )
+            MPI_Startall( requests_.size(), &requests_[0] );
+    }
+
+} // END init
+
+
+// Wait for the exchange and scatter the numbers of particles to receive, called by all threads
+void AggregatedParticlesCounts::finalize( VectorPatch& vecPatches )
+{
+    if ( comm_ == MPI_COMM_NULL ) return;
+
+    #pragma omp single
+    {
+        if ( requests_.size() )
+            MPI_Waitall( requests_.size(), &requests_[0], MPI_STATUSES_IGNORE );
+        for ( unsigned int i=0 ; i<recv_.size() ; i++ ) {
+            vector<int>& recv_sz = vecPatches( recv_[i].first )->particlesMPIbuff.recv_sz[ recv_[i].second ];
+            copy( rbuf_.begin() + i*nspecies_, rbuf_.begin() + (i+1)*nspecies_, recv_sz.begin() );
+        }
+    }
+
+} // END finalize
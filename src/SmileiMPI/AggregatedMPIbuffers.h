@@ -0,0 +1,147 @@
+#ifndef AGGREGATEDMPIBUFFERS_H
+#define AGGREGATEDMPIBUFFERS_H
+
+#include <mpi.h>
+#include <vector>
+
+#include "Tools.h"
+
+class Field;
+class VectorPatch;
+
+//! Field synchronization along one dimension with one message per neighbouring MPI process
+//!   - the strips of all patches, of all components and of both sides exchanged with a same process are packed in a
+//!     single buffer, all messages are exchanged by persistent requests on a graph communicator: a neighborhood
+//!     collective with MPI-4 (MPI_Neighbor_alltoallv_init), 1 send and 1 receive per neighbor otherwise
+//!   - intra-MPI process synchronizations are still done by SyncVectorPatch
+class AggregatedMPIbuffers {
+public:
+    AggregatedMPIbuffers();
+    ~AggregatedMPIbuffers();
+
+    //! Build the messages from the lists of fields with an MPI neighbor along iDim
+    //!   fields[icomp*MPIIdx.size()+ifield] is the component icomp of the patch MPIIdx[ifield]
+    //!   sum = true  : the received strips are summed (currents, see Patch::initSumField)
+    //!   sum = false : the received strips overwrite the ghost cells (see Patch::initExchange)
+    //!   comm        : graph communicator (see SmileiMPI::createNeighborsComm), whose neighbors include all MPI
+    //!                 neighbors of the patches
+    //!   thread_comms: duplicates of comm, 1 per partition of the messages (Main.hybrid_communication), or empty
+    void build( VectorPatch& vecPatches, std::vector<Field*>& fields, std::vector<int>& MPIIdx, unsigned int ncomp,
+                unsigned int iDim, bool sum, MPI_Comm comm, std::vector<MPI_Comm>& thread_comms );
+
+    //! Forget the messages and free the persistent requests
+    void clear();
+
+    //! Pack the strips (shared between threads) and start the exchange (1 thread), if not already started
+    //!   - over comm : called by all MPI processes in the same order, even without message
+    //!   - with thread_comms, each thread packs and sends its own partitions, without waiting for the other threads
+    void init();
+    //! Wait for the exchange (1 thread), or for the partitions of each thread, and unpack the strips (shared between
+    //! threads)
+    void finalize();
+
+private:
+    //! Part of a field sent or received, the whole field along the dimensions other than iDim_
+    struct Strip {
+        Field* field;
+        //! First index along iDim_ and number of cells along iDim_
+        unsigned int start, width;
+        //! Position in sbuf_ or rbuf_
+        unsigned int offset;
+        //! Rows [rows[0], rows[1][ along X unpacked, for a received strip along Y or Z (see SuperGrid::ownedRows)
+        unsigned int rows[2];
+    };
+
+    //! Messages exchanged with the MPI process rank, for the patches whose neighbor on side is owned by rank
+    struct Message {
+        int rank;
+        int side;
+        std::vector<Strip> send, recv;
+        unsigned int ssize, rsize;
+    };
+
+    //! Part of the message exchanged with a neighbor of comm_ : consecutive strips, sent or received by 1 thread
+    struct Partition {
+        int rank;
+        //! Position and number of values in sbuf_ or rbuf_
+        unsigned int offset, size;
+        //! (message, strip) indexes of the strips to pack, for a sent partition
+        std::vector< std::pair<unsigned int,unsigned int> > strips;
+    };
+
+    //! Copy a strip from a field to buf (or buf into the field, summed or not)
+    void copyStrip( Strip& strip, field_t* buf, bool toBuffer );
+
+    //! Split the strips exchanged with rank (ending at the position end of the buffer) in 1 partition per thread
+    //! communicator, both MPI processes split the same number of strips the same way
+    void split( int rank, std::vector< std::pair<unsigned int,unsigned int> >& strips, unsigned int end, bool send );
+    //! Create the persistent requests of the partitions ipart
+    void createPartitionRequests( unsigned int ipart );
+    //! Start the receptions and pack and send the partitions of the current thread
+    void initPartitions();
+
+    unsigned int iDim_;
+    bool sum_;
+    MPI_Comm comm_;
+    //! True between init and finalize
+    bool pending_;
+
+    std::vector<Message> messages_;
+    //! Packed strips of all messages, in the order of the neighbors of comm_
+    std::vector<field_t> sbuf_, rbuf_;
+    //! Number of values and position in sbuf_ / rbuf_ per neighbor of comm_
+    std::vector<int> scounts_, sdispls_, rcounts_, rdispls_;
+    //! Persistent requests of the exchange, created at the first init after build
+    std::vector<MPI_Request> requests_;
+    bool requestsCreated_;
+    //! (message, strip) indexes to share the packing and the unpacking (1 list per side) between threads
+    std::vector< std::pair<unsigned int,unsigned int> > packList_, unpackList_[2];
+
+    //! Communicator of each partition, the partition ipart is handled by the thread ipart modulo the number of threads
+    std::vector<MPI_Comm> thread_comms_;
+    //! Tag of the partitions, different for each set of exchanged fields sharing thread_comms_
+    int tag_;
+    //! Partitions sent and received per thread communicator
+    std::vector< std::vector<Partition> > sendPartitions_, recvPartitions_;
+    //! Persistent requests of the receptions then of the sendings per thread communicator, created at the first init
+    //! after build
+    std::vector< std::vector<MPI_Request> > partitionRequests_;
+    //! True between init and finalize, per thread
+    std::vector<char> threadPending_;
+};
+
+//! Numbers of particles of all species sent by the patches to their MPI neighbors (faces, edges and corners)
+//!   - the numbers of all patches exchanged with a same process are gathered in one message, all messages are
+//!     exchanged by persistent requests on a graph communicator (see AggregatedMPIbuffers)
+//!   - the particles themselves are still sent patch to patch (see Patch::CommParticles)
+class AggregatedParticlesCounts {
+public:
+    AggregatedParticlesCounts();
+    ~AggregatedParticlesCounts();
+
+    //! Build the messages from Patch::particle_neighbor_, 1 number per species for each patch and each neighbor
+    void build( VectorPatch& vecPatches, MPI_Comm comm );
+
+    //! Forget the messages and free the persistent requests
+    void clear();
+
+    //! Gather the numbers to send of all patches (PatchParticlesMPIbuffers::send_sz) and start the exchange (1 thread)
+    void init( VectorPatch& vecPatches );
+    //! Wait for the exchange and set the numbers to receive of all patches (PatchParticlesMPIbuffers::recv_sz) (1 thread)
+    void finalize( VectorPatch& vecPatches );
+
+private:
+    unsigned int nspecies_;
+    MPI_Comm comm_;
+
+    //! (patch index, neighbor index) of the numbers in sbuf_ / rbuf_, in the order of the neighbors of comm_
+    std::vector< std::pair<unsigned int,int> > send_, recv_;
+    std::vector<int> sbuf_, rbuf_;
+    //! Number of values and position in sbuf_ / rbuf_ per neighbor of comm_
+    std::vector<int> scounts_, sdispls_, rcounts_, rdispls_;
+    //! Persistent requests of the exchange, created at the first init after build
+    std::vector<MPI_Request> requests_;
+    bool requestsCreated_;
+};
+
+#endif
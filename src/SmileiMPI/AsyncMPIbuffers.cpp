@@ -3,6 +3,7 @@
 #include "Field.h"
 #include "Patch.h"
 
+#include <algorithm>
 #include <vector>
 using namespace std;
 
@@ -111,21 +112,55 @@ void SpeciesMPIbuffers::allocate(unsigned int ndims)
     rrequest.resize(ndims);
 
     partRecv.resize(ndims);
-    partSend.resize(ndims);
-
-    part_index_send.resize(ndims);
-    part_index_send_sz.resize(ndims);
     part_index_recv_sz.resize(ndims);
 
     for (unsigned int i=0 ; i<ndims ; i++) {
         srequest[i].resize(2);
         rrequest[i].resize(2);
         partRecv[i].resize(2);
-        partSend[i].resize(2);
-        part_index_send[i].resize(2);
-        part_index_send_sz[i].resize(2);
         part_index_recv_sz[i].resize(2);
     }
 
+    unsigned int nneighbors = 1;
+    for (unsigned int i=0 ; i<ndims ; i++)
+        nneighbors *= 3;
+
+    partNeighborRecv.resize(nneighbors);
+    part_index_neighbor_send.resize(nneighbors);
+    part_neighbor_recv_sz.resize(nneighbors, 0);
+
+}
+
+
+char* SpeciesMPIbuffers::growBuffer( std::vector<char>& buffer, size_t size )
+{
+    if ( buffer.size() < size )
+        buffer.resize( std::max( size, 2*buffer.size() ) );
+    return &( buffer[0] );
+}
+
+
+
+PatchParticlesMPIbuffers::PatchParticlesMPIbuffers()
+{
+}
+
+
+PatchParticlesMPIbuffers::~PatchParticlesMPIbuffers()
+{
 }
 
+
+void PatchParticlesMPIbuffers::allocate(unsigned int nneighbors, unsigned int nspecies)
+{
+    send_sz.resize(nneighbors);
+    recv_sz.resize(nneighbors);
+    for (unsigned int i=0 ; i<nneighbors ; i++) {
+        send_sz[i].resize(nspecies, 0);
+        recv_sz[i].resize(nspecies, 0);
+    }
+    packSend.resize(nneighbors);
+    packRecv.resize(nneighbors);
+    srequest.resize(nneighbors, MPI_REQUEST_NULL);
+    rrequest.resize(nneighbors, MPI_REQUEST_NULL);
+}
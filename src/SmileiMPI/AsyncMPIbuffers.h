@@ -23,7 +23,7 @@ public:
     std::vector< std::vector<MPI_Request> > srequest;
     //! ndim vectors of 2 received requests (1 per direction) 
     std::vector< std::vector<MPI_Request> > rrequest;
-    std::vector< double >  buf[3][2];
+    std::vector< field_t > buf[3][2];
 
     std::vector< std::vector<int> > send_tags_, recv_tags_;
 
@@ -36,19 +36,48 @@ public:
 
     void allocate(unsigned int nDim_field) ;
 
-    //! ndim vectors of 2 sent packets of particles (1 per direction) 
-    std::vector< std::vector<Particles > > partRecv;
     //! ndim vectors of 2 received packets of particles (1 per direction) 
-    std::vector< std::vector<Particles > > partSend;
+    //!   - particles sorted per direction of arrival, as if they had been exchanged one dimension after the other
+    //!   - used by Species::sort_part
+    std::vector< std::vector<Particles > > partRecv;
+    //! ndim vectors of 2 numbers of particles received (1 per direction) 
+    std::vector< std::vector< int > > part_index_recv_sz;
 
-    //! ndim vectors of 2 vectors of index particles to send (1 per direction) 
+    //! 3^ndim packets of particles received from the face, edge and corner neighbors
+    //!   - indexed as Patch::particle_neighbor_ by the displacement of the particles
+    std::vector<Particles> partNeighborRecv;
+    //! 3^ndim vectors of index particles to send (1 per neighbor)
     //!   - not sent
-    //    - used to sort Species::indexes_of_particles_to_exchange built in Species::dynamics
-    std::vector< std::vector< std::vector<int> > > part_index_send;
-    //! ndim vectors of 2 numbers of particles to send (1 per direction) 
-    std::vector< std::vector< int > > part_index_send_sz;
-    //! ndim vectors of 2 numbers of particles to receive (1 per direction) 
-    std::vector< std::vector< int > > part_index_recv_sz;
+    std::vector< std::vector<int> > part_index_neighbor_send;
+    //! 3^ndim numbers of particles received (1 per neighbor)
+    std::vector<int> part_neighbor_recv_sz;
+
+    //! Buffer of all particles packed to send / receive the patch (load balancing, moving window)
+    std::vector<char> packPatch;
+
+    //! Resize buffer to at least size bytes, by doubling its size to reuse it for many exchanges, return its address
+    static char* growBuffer( std::vector<char>& buffer, size_t size );
+
+};
+
+//! Buffers of a patch to exchange the particles of all species with each neighbor (faces, edges and corners)
+//!   - 1 message of particles per neighbor, whatever the number of species
+//!   - the numbers of particles of each species, exchanged before for all patches at once (AggregatedParticlesCounts),
+//!     give the offset of each species in the message of particles (see Particles::packedBytes)
+class PatchParticlesMPIbuffers {
+public:
+    PatchParticlesMPIbuffers();
+    ~PatchParticlesMPIbuffers();
+
+    void allocate(unsigned int nneighbors, unsigned int nspecies);
+
+    //! 3^ndim vectors of numbers of particles to send / to receive (1 per neighbor, 1 number per species)
+    std::vector< std::vector<int> > send_sz, recv_sz;
+    //! 3^ndim buffers of the particles of all species packed one species after the other by Particles::pack
+    //!   - kept from one exchange to the other, see SpeciesMPIbuffers::growBuffer
+    std::vector< std::vector<char> > packSend, packRecv;
+    //! 3^ndim sent / received requests (1 per neighbor)
+    std::vector<MPI_Request> srequest, rrequest;
 
 };
 
@@ -0,0 +1,68 @@
+#include "NodeSharedTable.h"
+
+#include <cstring>
+
+#include "SmileiMPI.h"
+
+using namespace std;
+
+NodeSharedTable::NodeSharedTable()
+{
+    data_ = NULL;
+    size_ = 0;
+    win_ = MPI_WIN_NULL;
+}
+
+NodeSharedTable::~NodeSharedTable()
+{
+    // Collective over the MPI processes of the node
+    if( win_ != MPI_WIN_NULL ) {
+        MPI_Win_free( &win_ );
+    }
+}
+
+void NodeSharedTable::resize( unsigned int n )
+{
+    private_.resize( n );
+    data_ = private_.data();
+    size_ = n;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the private array of the master MPI process into one shared segment per node
+//     - the master MPI process (first of its node, see SmileiMPI::createNodeComms) fills the segment of its node
+//     - the segments of the other nodes are filled by a broadcast between the first MPI processes of the nodes
+// ---------------------------------------------------------------------------------------------------------------------
+void NodeSharedTable::share( SmileiMPI* smpi )
+{
+    MPI_Comm node_comm = smpi->getNodeComm();
+    MPI_Comm node_masters_comm = smpi->getNodeMastersComm();
+
+    MPI_Bcast( &size_, 1, MPI_UNSIGNED, 0, smpi->getGlobalComm() );
+
+    // A table shared again replaces the previous segment
+    if( win_ != MPI_WIN_NULL ) {
+        MPI_Win_free( &win_ );
+    }
+
+    // The whole segment belongs to the first MPI process of the node
+    int node_rank( 0 );
+    MPI_Comm_rank( node_comm, &node_rank );
+    MPI_Aint segment_size = ( node_rank == 0 ) ? ( MPI_Aint )size_*sizeof( double ) : 0;
+    double* segment;
+    MPI_Win_allocate_shared( segment_size, sizeof( double ), MPI_INFO_NULL, node_comm, &segment, &win_ );
+    int disp_unit;
+    MPI_Win_shared_query( win_, 0, &segment_size, &disp_unit, &segment );
+
+    MPI_Win_fence( 0, win_ );
+    if( smpi->isMaster() && size_ > 0 ) {
+        memcpy( segment, private_.data(), size_*sizeof( double ) );
+    }
+    if( node_masters_comm != MPI_COMM_NULL ) {
+        MPI_Bcast( segment, size_, MPI_DOUBLE, 0, node_masters_comm );
+    }
+    MPI_Win_fence( 0, win_ );
+
+    vector<double>().swap( private_ );
+    data_ = segment;
+}
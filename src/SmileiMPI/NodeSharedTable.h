@@ -0,0 +1,49 @@
+#ifndef NODESHAREDTABLE_H
+#define NODESHAREDTABLE_H
+
+#include <mpi.h>
+#include <vector>
+
+class SmileiMPI;
+
+//! Read-only table of doubles stored once per compute node
+//!   - the table is first filled by one MPI process (read from a file or gathered), in a private array
+//!   - share() copies it into a shared memory segment (MPI-3 shared window) allocated by the first MPI process of
+//!     each node, all MPI processes of the node then access this segment, without copy
+//!   - used for the lookup tables of the QED processes (see RadiationTables and MultiphotonBreitWheelerTables)
+class NodeSharedTable {
+public:
+    NodeSharedTable();
+    ~NodeSharedTable();
+
+    //! Allocate the private array of n values, before share()
+    void resize( unsigned int n );
+
+    //! Collective over all MPI processes : copy the private array of the master MPI process into the shared segment
+    //! of each node and free the private arrays
+    void share( SmileiMPI* smpi );
+
+    inline double& operator[]( unsigned int i ) {
+        return data_[i];
+    }
+    inline const double& operator[]( unsigned int i ) const {
+        return data_[i];
+    }
+    inline unsigned int size() const {
+        return size_;
+    }
+
+private:
+    NodeSharedTable( const NodeSharedTable& );
+    NodeSharedTable& operator=( const NodeSharedTable& );
+
+    //! Private array, before share()
+    std::vector<double> private_;
+    //! Values of the table : private_ before share(), the shared segment after
+    double* data_;
+    unsigned int size_;
+    //! Shared window of the node, MPI_WIN_NULL before share()
+    MPI_Win win_;
+};
+
+#endif
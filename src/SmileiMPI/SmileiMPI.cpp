@@ -57,6 +57,8 @@ SmileiMPI::SmileiMPI( int* argc, char*** argv )
     MPI_Comm_size( SMILEI_COMM_WORLD, &smilei_sz );
     MPI_Comm_rank( SMILEI_COMM_WORLD, &smilei_rk );
 
+    createNodeComms();
+
 } // END SmileiMPI::SmileiMPI
 
 
@@ -68,11 +70,30 @@ SmileiMPI::~SmileiMPI()
 {
     delete[]periods_;
 
+    MPI_Comm_free( &node_comm_ );
+    if( node_masters_comm_ != MPI_COMM_NULL ) {
+        MPI_Comm_free( &node_masters_comm_ );
+    }
+
     MPI_Finalize();
 
 } // END SmileiMPI::~SmileiMPI
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Create the communicators of the shared memory nodes
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::createNodeComms()
+{
+    MPI_Comm_split_type( SMILEI_COMM_WORLD, MPI_COMM_TYPE_SHARED, smilei_rk, MPI_INFO_NULL, &node_comm_ );
+
+    int node_rank;
+    MPI_Comm_rank( node_comm_, &node_rank );
+    MPI_Comm_split( SMILEI_COMM_WORLD, node_rank==0 ? 0 : MPI_UNDEFINED, smilei_rk, &node_masters_comm_ );
+
+} // END createNodeComms
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Broadcast namelist in SMILEI_COMM_WORLD
 // ---------------------------------------------------------------------------------------------------------------------
@@ -124,12 +145,14 @@ void SmileiMPI::init( Params& params, DomainDecomposition* domain_decomposition
     dynamics_invgf.resize(omp_get_max_threads());
     dynamics_iold.resize(omp_get_max_threads());
     dynamics_deltaold.resize(omp_get_max_threads());
+    dynamics_fieldtile.resize(omp_get_max_threads());
 #else
     dynamics_Epart.resize(1);
     dynamics_Bpart.resize(1);
     dynamics_invgf.resize(1);
     dynamics_iold.resize(1);
     dynamics_deltaold.resize(1);
+    dynamics_fieldtile.resize(1);
 #endif
 
     // Set periodicity of the simulated problem
@@ -482,47 +505,22 @@ int SmileiMPI::hrank(int h)
 
 
 // ----------------------------------------------------------------------
-// Create MPI type to exchange all particles properties of particles
+// Create a distributed graph communicator of the neighboring MPI processes
+//   - collective over SMILEI_COMM_WORLD, ranks must be symmetric (if i is a neighbor of j, j is a neighbor of i)
+//   - ranks are not reordered : ranks in the graph are those in SMILEI_COMM_WORLD
 // ----------------------------------------------------------------------
-MPI_Datatype SmileiMPI::createMPIparticles( Particles* particles )
+MPI_Comm SmileiMPI::createNeighborsComm( std::vector<int>& ranks )
 {
-    int nbrOfProp = particles->double_prop.size() + particles->short_prop.size() + particles->uint64_prop.size();
-
-    MPI_Aint address[nbrOfProp];
-    for ( unsigned int iprop=0 ; iprop<particles->double_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->double_prop[iprop]))[0] ), &(address[iprop]) );
-    for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->short_prop[iprop]))[0] ), &(address[particles->double_prop.size()+iprop]) );
-    for ( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->uint64_prop[iprop]))[0] ), &(address[particles->double_prop.size()+particles->short_prop.size()+iprop]) );
-
-    int nbr_parts[nbrOfProp];
-    // number of elements per property
-    for (int i=0 ; i<nbrOfProp ; i++)
-        nbr_parts[i] = particles->size();
-
-    MPI_Aint disp[nbrOfProp];
-    // displacement between 2 properties
-    disp[0] = 0;
-    for (int i=1 ; i<nbrOfProp ; i++)
-        disp[i] = address[i] - address[0];
-
-    MPI_Datatype partDataType[nbrOfProp];
-    // define MPI type of each property, default is DOUBLE
-    for ( unsigned int i=0 ; i<particles->double_prop.size() ; i++)
-        partDataType[i] = MPI_DOUBLE;
-    for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ )
-        partDataType[ particles->double_prop.size()+iprop] = MPI_SHORT;
-    for ( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++ )
-        partDataType[ particles->double_prop.size()+particles->short_prop.size()+iprop] = MPI_UNSIGNED_LONG_LONG;
-
-    MPI_Datatype typeParticlesMPI;
-    MPI_Type_create_struct( nbrOfProp, &(nbr_parts[0]), &(disp[0]), &(partDataType[0]), &typeParticlesMPI);
-    MPI_Type_commit( &typeParticlesMPI );
-
-    return typeParticlesMPI;
-
-} // END createMPIparticles
+    MPI_Comm comm;
+    int nranks = ranks.size();
+    int none(0);
+    int* neighbors = nranks ? &ranks[0] : &none;
+    MPI_Dist_graph_create_adjacent( SMILEI_COMM_WORLD,
+                                    nranks, neighbors, MPI_UNWEIGHTED,
+                                    nranks, neighbors, MPI_UNWEIGHTED,
+                                    MPI_INFO_NULL, 0, &comm );
+    return comm;
+} // END createNeighborsComm
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -541,8 +539,7 @@ void SmileiMPI::isend(Patch* patch, int to, int tag, Params& params)
     for (int ispec=0 ; ispec<(int)patch->vecSpecies.size() ; ispec++){
         isend( &(patch->vecSpecies[ispec]->bmax), to, tag+2*ispec+1, patch->requests_[2*ispec] );
         if ( patch->vecSpecies[ispec]->getNbrOfParticles() > 0 ){
-            patch->vecSpecies[ispec]->exchangePatch = createMPIparticles( patch->vecSpecies[ispec]->particles );
-            isend( patch->vecSpecies[ispec]->particles, to, tag+2*ispec, patch->vecSpecies[ispec]->exchangePatch, patch->requests_[2*ispec+1] );
+            isend( patch->vecSpecies[ispec]->particles, to, tag+2*ispec, patch->vecSpecies[ispec]->MPIbuff.packPatch, patch->requests_[2*ispec+1] );
         }
     }
 
@@ -590,21 +587,10 @@ void SmileiMPI::waitall(Patch* patch)
         //patch->requests_[ireq] = MPI_REQUEST_NULL;
     }
 
-    for (int ispec=0 ; ispec<(int)patch->vecSpecies.size() ; ispec++)
-    {
-        if ( patch->vecSpecies[ispec]->getNbrOfParticles() > 0 ) {
-            if (patch->vecSpecies[ispec]->exchangePatch != MPI_DATATYPE_NULL) {
-                MPI_Type_free( &(patch->vecSpecies[ispec]->exchangePatch) );
-                patch->vecSpecies[ispec]->exchangePatch = MPI_DATATYPE_NULL;
-            }
-        }
-    }
-
 }
 
 void SmileiMPI::recv(Patch* patch, int from, int tag, Params& params)
 {
-    MPI_Datatype recvParts;
     int nbrOfPartsRecv;
 
     // Count number max of comms :int tag
@@ -622,9 +608,7 @@ void SmileiMPI::recv(Patch* patch, int from, int tag, Params& params)
         patch->vecSpecies[ispec]->particles->initialize( nbrOfPartsRecv, params.nDim_particle );
         //Receive particles
         if ( nbrOfPartsRecv > 0 ) {
-            recvParts = createMPIparticles( patch->vecSpecies[ispec]->particles );
-            recv( patch->vecSpecies[ispec]->particles, from, tag+2*ispec, recvParts );
-            MPI_Type_free( &(recvParts) );
+            recv( patch->vecSpecies[ispec]->particles, from, tag+2*ispec, patch->vecSpecies[ispec]->MPIbuff.packPatch );
         }
     }
 
@@ -666,17 +650,22 @@ void SmileiMPI::recv(Patch* patch, int from, int tag, Params& params)
 } // END recv ( Patch )
 
 
-void SmileiMPI::isend(Particles* particles, int to, int tag, MPI_Datatype typePartSend, MPI_Request& request)
+void SmileiMPI::isend(Particles* particles, int to, int tag, std::vector<char>& buffer, MPI_Request& request)
 {
-    MPI_Isend( &(particles->position(0,0)), 1, typePartSend, to, tag, MPI_COMM_WORLD, &request );
+    int n_bytes = particles->size() * particles->packedSize();
+    particles->pack( 0, particles->size(), SpeciesMPIbuffers::growBuffer( buffer, n_bytes ) );
+    MPI_Isend( &(buffer[0]), n_bytes, MPI_BYTE, to, tag, MPI_COMM_WORLD, &request );
 
 } // END isend( Particles )
 
 
-void SmileiMPI::recv(Particles* particles, int to, int tag, MPI_Datatype typePartRecv)
+// particles must be initialized with the number of particles to receive
+void SmileiMPI::recv(Particles* particles, int to, int tag, std::vector<char>& buffer)
 {
     MPI_Status status;
-    MPI_Recv( &(particles->position(0,0)), 1, typePartRecv, to, tag, MPI_COMM_WORLD, &status );
+    int n_bytes = particles->size() * particles->packedSize();
+    MPI_Recv( SpeciesMPIbuffers::growBuffer( buffer, n_bytes ), n_bytes, MPI_BYTE, to, tag, MPI_COMM_WORLD, &status );
+    particles->unpack( &(buffer[0]), 0, particles->size() );
 
 } // END recv( Particles )
 
@@ -729,17 +718,13 @@ void SmileiMPI::isend(ElectroMagn* EM, int to, int tag, vector<MPI_Request>& req
         }
     }
 
-    for (unsigned int antennaId=0 ; antennaId<EM->antennas.size() ; antennaId++) {
-        isend( EM->antennas[antennaId].field, to, mpi_tag+tag, requests[tag] ); tag++;
-    }
-
     for (unsigned int bcId=0 ; bcId<EM->emBoundCond.size() ; bcId++ ) {
         if(! EM->emBoundCond[bcId]) continue;
 
         for (unsigned int laserId=0 ; laserId < EM->emBoundCond[bcId]->vecLaser.size() ; laserId++ ) {
 
             Laser * laser = EM->emBoundCond[bcId]->vecLaser[laserId];
-            if( !(laser->spacetime[0]) && !(laser->spacetime[1]) ){
+            if( laser->file.empty() && !(laser->spacetime[0]) && !(laser->spacetime[1]) ){
                 LaserProfileSeparable* profile;
                 profile = static_cast<LaserProfileSeparable*> ( laser->profiles[0] );
                 if( ! profile->space_envelope ) continue;
@@ -751,6 +736,12 @@ void SmileiMPI::isend(ElectroMagn* EM, int to, int tag, vector<MPI_Request>& req
             }
         }
 
+         // Auxiliary fields of the PML
+         vector<Field*> pml_fields = EM->emBoundCond[bcId]->pmlFields();
+         for (unsigned int ifield=0 ; ifield<pml_fields.size() ; ifield++ ) {
+             isend( pml_fields[ifield], to, mpi_tag+tag, requests[tag] ); tag++;
+         }
+
          if ( EM->extFields.size()>0 ) {
 
              if (dynamic_cast<ElectroMagnBC1D_SM*>(EM->emBoundCond[bcId]) ) {
@@ -800,16 +791,12 @@ void SmileiMPI::recv(ElectroMagn* EM, int from, int tag)
         }
     }
 
-    for (int antennaId=0 ; antennaId<(int)EM->antennas.size() ; antennaId++) {
-        recv( EM->antennas[antennaId].field, from, tag); tag++;
-    }
-
     for (unsigned int bcId=0 ; bcId<EM->emBoundCond.size() ; bcId++ ) {
         if(! EM->emBoundCond[bcId]) continue;
 
         for (unsigned int laserId=0 ; laserId<EM->emBoundCond[bcId]->vecLaser.size() ; laserId++ ) {
             Laser * laser = EM->emBoundCond[bcId]->vecLaser[laserId];
-            if( !(laser->spacetime[0]) && !(laser->spacetime[1]) ){
+            if( laser->file.empty() && !(laser->spacetime[0]) && !(laser->spacetime[1]) ){
                 LaserProfileSeparable* profile;
                 profile = static_cast<LaserProfileSeparable*> ( laser->profiles[0] );
                 if( ! profile->space_envelope ) continue;
@@ -821,6 +808,12 @@ void SmileiMPI::recv(ElectroMagn* EM, int from, int tag)
             }
         }
 
+        // Auxiliary fields of the PML
+        vector<Field*> pml_fields = EM->emBoundCond[bcId]->pmlFields();
+        for (unsigned int ifield=0 ; ifield<pml_fields.size() ; ifield++ ) {
+            recv( pml_fields[ifield], from, tag ); tag++;
+        }
+
         if ( EM->extFields.size()>0 ) {
 
             if (dynamic_cast<ElectroMagnBC1D_SM*>(EM->emBoundCond[bcId]) ) {
@@ -856,7 +849,7 @@ void SmileiMPI::recv(ElectroMagn* EM, int from, int tag)
 
 void SmileiMPI::isend(Field* field, int to, int hindex, MPI_Request& request)
 {
-    MPI_Isend( &((*field)(0)),field->globalDims_, MPI_DOUBLE, to, hindex, MPI_COMM_WORLD, &request );
+    MPI_Isend( &((*field)(0)),field->globalDims_, SMILEI_MPI_FIELD, to, hindex, MPI_COMM_WORLD, &request );
 
 } // End isend ( Field )
 
@@ -864,7 +857,7 @@ void SmileiMPI::isend(Field* field, int to, int hindex, MPI_Request& request)
 void SmileiMPI::recv(Field* field, int from, int hindex)
 {
     MPI_Status status;
-    MPI_Recv( &((*field)(0)),field->globalDims_, MPI_DOUBLE, from, hindex, MPI_COMM_WORLD, &status );
+    MPI_Recv( &((*field)(0)),field->globalDims_, SMILEI_MPI_FIELD, from, hindex, MPI_COMM_WORLD, &status );
 
 } // End recv ( Field )
 
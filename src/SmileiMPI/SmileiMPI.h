@@ -58,8 +58,9 @@ public:
      // Returns the rank of the MPI process currently owning patch h.
     int hrank(int h);
 
-    // Create MPI type to exchange all particles properties of particles
-    MPI_Datatype createMPIparticles( Particles* particles );
+    // Create a distributed graph communicator whose neighbors are ranks, in both directions (sources = destinations)
+    //     - used by the neighborhood collectives of the aggregated exchanges (see VectorPatch::updateNeighborsComm)
+    MPI_Comm createNeighborsComm( std::vector<int>& ranks );
 
 
     // PATCH SEND / RECV METHODS
@@ -70,8 +71,9 @@ public:
     void waitall(Patch* patch);
     void recv (Patch* patch, int from, int hindex, Params& params);
 
-    void isend(Particles* particles, int to   , int hindex, MPI_Datatype datatype, MPI_Request& request);
-    void recv (Particles* partictles, int from, int hindex, MPI_Datatype datatype);
+    // Particles packed in buffer (see Particles::pack), which must not be modified before the end of the isend
+    void isend(Particles* particles, int to   , int hindex, std::vector<char>& buffer, MPI_Request& request);
+    void recv (Particles* partictles, int from, int hindex, std::vector<char>& buffer);
     void isend(std::vector<int>* vec, int to  , int hindex, MPI_Request& request);
     void recv (std::vector<int> *vec, int from, int hindex);
     
@@ -124,6 +126,17 @@ public:
         return SMILEI_COMM_WORLD;
     }
 
+    //! Return the communicator of the MPI processes sharing the memory of the node
+    inline MPI_Comm getNodeComm()
+    {
+        return node_comm_;
+    }
+    //! Return the communicator of the first MPI processes of the nodes (MPI_COMM_NULL on the other MPI processes)
+    inline MPI_Comm getNodeMastersComm()
+    {
+        return node_masters_comm_;
+    }
+
     //! Return MPI_Comm_size
     inline int getOMPMaxThreads() {
         return smilei_omp_max_threads;
@@ -143,6 +156,8 @@ public:
     std::vector<std::vector<int>> dynamics_iold;
     //! delta_old_pos
     std::vector<std::vector<double>> dynamics_deltaold;
+    //! E and B around the particles of a bin, staged by the 3D interpolators (see Interpolator3D::stageFields)
+    std::vector<std::vector<double>> dynamics_fieldtile;
 
     // Resize buffers for a given number of particles
     inline void dynamics_resize(int ithread, int ndim_part, int npart ){
@@ -169,6 +184,14 @@ protected:
     //! Global MPI Communicator
     MPI_Comm SMILEI_COMM_WORLD;
 
+    //! Split SMILEI_COMM_WORLD per shared memory node, used by the tables shared in the node (see NodeSharedTable)
+    //!   - the MPI processes are ordered as in SMILEI_COMM_WORLD, the master is the first of its node
+    void createNodeComms();
+    //! MPI processes of the node
+    MPI_Comm node_comm_;
+    //! First MPI processes of all nodes
+    MPI_Comm node_masters_comm_;
+
     //! Number of MPI process in the current communicator
     int smilei_sz;
     //! MPI process Id in the current communicator
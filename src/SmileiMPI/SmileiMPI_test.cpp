@@ -60,6 +60,8 @@ SmileiMPI_test::SmileiMPI_test( int* argc, char*** argv )
         ERROR("Test mode cannot be run with several MPI processes. Instead, indicate the MPIxOMP intended partition after the -T argument.");
     }
     
+    createNodeComms();
+    
     smilei_sz = nMPI;
     smilei_rk = 0;
     smilei_omp_max_threads = nOMP;
@@ -98,6 +100,7 @@ void SmileiMPI_test::init( Params& params, DomainDecomposition* domain_decomposi
     dynamics_invgf.resize(1);
     dynamics_iold.resize(1);
     dynamics_deltaold.resize(1);
+    dynamics_fieldtile.resize(1);
     
     // Set periodicity of the simulated problem
     periods_  = new int[params.nDim_field];
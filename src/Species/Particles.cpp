@@ -263,6 +263,89 @@ void Particles::cp_particles(unsigned int iPart, unsigned int nPart, Particles &
 
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Number of bytes of a particle packed by pack()
+// ---------------------------------------------------------------------------------------------------------------------
+unsigned int Particles::packedSize() const
+{
+    return double_prop.size()*sizeof(double) + short_prop.size()*sizeof(short) + uint64_prop.size()*sizeof(uint64_t);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack the particles listed in indexes in buffer, to be sent as MPI_BYTE instead of building an MPI datatype
+// Each property of all particles is stored contiguously, so that unpack only needs a copy per property
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::pack( std::vector<int>& indexes, char* buffer )
+{
+    unsigned int nPart = indexes.size();
+
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        double* dest = reinterpret_cast<double*>( buffer );
+        double* prop = &( (*double_prop[iprop])[0] );
+        for ( unsigned int i=0 ; i<nPart ; i++ )
+            dest[i] = prop[ indexes[i] ];
+        buffer += nPart*sizeof(double);
+    }
+
+    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
+        uint64_t* dest = reinterpret_cast<uint64_t*>( buffer );
+        uint64_t* prop = &( (*uint64_prop[iprop])[0] );
+        for ( unsigned int i=0 ; i<nPart ; i++ )
+            dest[i] = prop[ indexes[i] ];
+        buffer += nPart*sizeof(uint64_t);
+    }
+
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        short* dest = reinterpret_cast<short*>( buffer );
+        short* prop = &( (*short_prop[iprop])[0] );
+        for ( unsigned int i=0 ; i<nPart ; i++ )
+            dest[i] = prop[ indexes[i] ];
+        buffer += nPart*sizeof(short);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack nPart contiguous particles in buffer, same layout as above
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::pack( unsigned int iPart, unsigned int nPart, char* buffer )
+{
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        memcpy( buffer, &( (*double_prop[iprop])[iPart] ), nPart*sizeof(double) );
+        buffer += nPart*sizeof(double);
+    }
+
+    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
+        memcpy( buffer, &( (*uint64_prop[iprop])[iPart] ), nPart*sizeof(uint64_t) );
+        buffer += nPart*sizeof(uint64_t);
+    }
+
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        memcpy( buffer, &( (*short_prop[iprop])[iPart] ), nPart*sizeof(short) );
+        buffer += nPart*sizeof(short);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Overwrite nPart particles starting at iPart with the particles packed in buffer
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::unpack( char* buffer, unsigned int iPart, unsigned int nPart )
+{
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        memcpy( &( (*double_prop[iprop])[iPart] ), buffer, nPart*sizeof(double) );
+        buffer += nPart*sizeof(double);
+    }
+
+    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
+        memcpy( &( (*uint64_prop[iprop])[iPart] ), buffer, nPart*sizeof(uint64_t) );
+        buffer += nPart*sizeof(uint64_t);
+    }
+
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        memcpy( &( (*short_prop[iprop])[iPart] ), buffer, nPart*sizeof(short) );
+        buffer += nPart*sizeof(short);
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Suppress particle iPart
 // ---------------------------------------------------------------------------------------------------------------------
@@ -73,6 +73,21 @@ public:
     //! Insert particle iPart at dest_id in dest_parts
     void cp_particle(unsigned int ipart, Particles &dest_parts, int dest_id );
 
+    //! Number of bytes of a particle packed by pack()
+    unsigned int packedSize() const;
+    //! Number of bytes of nPart packed particles, rounded up to the alignment of double so that the particles of
+    //! another species can be packed after them in the same buffer
+    inline unsigned int packedBytes( unsigned int nPart ) const {
+        unsigned int n = nPart*packedSize();
+        return ( n + alignof(double) - 1 ) / alignof(double) * alignof(double);
+    }
+    //! Pack the particles indexes[0..nPart[ in buffer (nPart*packedSize() bytes), property after property
+    void pack( std::vector<int>& indexes, char* buffer );
+    //! Pack nPart particles starting at iPart in buffer (nPart*packedSize() bytes), property after property
+    void pack( unsigned int iPart, unsigned int nPart, char* buffer );
+    //! Overwrite nPart particles starting at iPart with the particles packed in buffer
+    void unpack( char* buffer, unsigned int iPart, unsigned int nPart );
+
     //! Suppress particle iPart
     void erase_particle(unsigned int iPart );
     //! Suppress nPart particles from iPart
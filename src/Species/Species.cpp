@@ -175,15 +175,11 @@ void Species::initOperators(Params& params, Patch* patch)
     for (unsigned int iDim=0 ; iDim < nDim_particle ; iDim++){
         for (unsigned int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             MPIbuff.partRecv[iDim][iNeighbor].initialize(0, (*particles));
-            MPIbuff.partSend[iDim][iNeighbor].initialize(0, (*particles));
-            MPIbuff.part_index_send[iDim][iNeighbor].resize(0);
             MPIbuff.part_index_recv_sz[iDim][iNeighbor] = 0;
-            MPIbuff.part_index_send_sz[iDim][iNeighbor] = 0;
         }
     }
-    typePartSend.resize(nDim_particle*2, MPI_DATATYPE_NULL);
-    typePartRecv.resize(nDim_particle*2, MPI_DATATYPE_NULL);
-    exchangePatch = MPI_DATATYPE_NULL;
+    for (unsigned int iNeighbor=0 ; iNeighbor < MPIbuff.partNeighborRecv.size() ; iNeighbor++)
+        MPIbuff.partNeighborRecv[iNeighbor].initialize(0, (*particles));
 
 }
 
@@ -512,7 +508,14 @@ void Species::dynamics(double time_dual, unsigned int ispec,
         //Still needed for ionization
         vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
 
-        for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin++) {
+        // Bins processed as OpenMP tasks (no process creating particles)
+        unsigned int nbin = bmin.size();
+        if ( params.cluster_tasks && !Ionize && !Radiate && !Multiphoton_Breit_Wheeler_process ) {
+            nrj_lost_per_thd[tid] += dynamicsTasks( EMfields, Proj, params, diag_flag, partWalls, patch, smpi, ispec );
+            nbin = 0;
+        }
+
+        for (unsigned int ibin = 0 ; ibin < nbin ; ibin++) {
 
 
             // Interpolate the fields at the particle position
@@ -663,17 +666,12 @@ void Species::dynamics(double time_dual, unsigned int ispec,
     }
     else { // immobile particle (at the moment only project density)
         if ( diag_flag &&(!particles->is_test)){
-            double* b_rho=nullptr;
             for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin ++) { //Loop for projection on buffer_proj
 
-                if (nDim_field==2)
-                    b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw*f_dim1) : &(*EMfields->rho_)(ibin*clrw*f_dim1) ;
-                if (nDim_field==3)
-                    b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw*f_dim1*f_dim2) : &(*EMfields->rho_)(ibin*clrw*f_dim1*f_dim2) ;
-                else if (nDim_field==1)
-                    b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw) : &(*EMfields->rho_)(ibin*clrw) ;
+                // f_dim1 and f_dim2 are 1 along unused dimensions
+                ProjectionBuffer b_rho( EMfields->rho_s[ispec] ? EMfields->rho_s[ispec] : EMfields->rho_, ibin*clrw*f_dim1*f_dim2, b_dim );
                 for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                    (*Proj)(b_rho, (*particles), iPart, ibin*clrw, b_dim);
+                    (*Proj)(b_rho.data(), (*particles), iPart, ibin*clrw, b_dim);
                 } //End loop on particles
             }//End loop on bins
 
@@ -684,6 +682,73 @@ void Species::dynamics(double time_dual, unsigned int ispec,
 
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Particle dynamics with one OpenMP task per bin (Main.cluster_tasks) :
+//   - each task interpolates, pushes and applies the boundary conditions on the particles of its bin, then projects
+//     the currents on the private tile of the bin, with the buffers of the thread executing it
+//   - the tiles are reduced in the fields, and the particles to exchange gathered, in the order of the bins
+// Idle threads of the loop on patches can then execute the bins of the densest patches.
+// ---------------------------------------------------------------------------------------------------------------------
+double Species::dynamicsTasks(ElectroMagn* EMfields, Projector* Proj, Params &params, bool diag_flag,
+                              PartWalls* partWalls, Patch* patch, SmileiMPI* smpi, unsigned int ispec)
+{
+    unsigned int nbin = bmin.size();
+    tiles_.resize( nbin );
+    vector< vector<int> > exchange( nbin );
+    vector<double> nrj_lost( nbin, 0. );
+    double factor = ( mass>0 ) ? mass : 1.;
+
+    #pragma omp taskloop grainsize(1) default(shared)
+    for (unsigned int ibin = 0 ; ibin < nbin ; ibin++) {
+        int ithread;
+        #ifdef _OPENMP
+            ithread = omp_get_thread_num();
+        #else
+            ithread = 0;
+        #endif
+        smpi->dynamics_resize(ithread, nDim_particle, bmax.back());
+
+        // Interpolators store their coefficients : one per thread
+        (*patch->Interp_threads[ithread])(EMfields, *particles, smpi, &(bmin[ibin]), &(bmax[ibin]), ithread );
+
+        // Push the particles and the photons
+        (*Push)(*particles, smpi, bmin[ibin], bmax[ibin], ithread );
+
+        // Apply wall and boundary conditions
+        double ener_iPart(0.);
+        for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
+            for (int iPart=bmin[ibin] ; iPart<bmax[ibin]; iPart++ ) {
+                double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
+                if ( !(*partWalls)[iwall]->apply(*particles, iPart, this, dtgf, ener_iPart)) {
+                    nrj_lost[ibin] += factor * ener_iPart;
+                }
+            }
+        }
+        for (int iPart=bmin[ibin] ; iPart<bmax[ibin]; iPart++ ) {
+            if ( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                exchange[ibin].push_back( iPart );
+                nrj_lost[ibin] += factor * ener_iPart;
+            }
+        }
+
+        // Project currents on the tile of the bin
+        if ((!particles->is_test) && (mass > 0)) {
+            tiles_[ibin].allocate( EMfields, ibin, clrw, b_dim, diag_flag, params.is_spectral, ispec );
+            (*Proj)(tiles_[ibin], *particles, smpi, bmin[ibin], bmax[ibin], ithread, ibin, clrw, b_dim );
+        }
+    }
+
+    double nrj_lost_total(0.);
+    for (unsigned int ibin = 0 ; ibin < nbin ; ibin++) {
+        tiles_[ibin].reduce();
+        for (unsigned int i = 0 ; i < exchange[ibin].size() ; i++)
+            addPartInExchList( exchange[ibin][i] );
+        nrj_lost_total += nrj_lost[ibin];
+    }
+    return nrj_lost_total;
+}
+
+
 // -----------------------------------------------------------------------------
 //! For all particles of the species, import the new particles generated
 //! from these different physical processes:
@@ -744,15 +809,14 @@ void Species::computeCharge(unsigned int ispec, ElectroMagn* EMfields, Projector
     // calculate the particle charge
     // -------------------------------
     if ( (!particles->is_test) ) {
-        double* b_rho=nullptr;
         for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin ++) { //Loop for projection on buffer_proj
             unsigned int bin_start = ibin*clrw*f_dim1*f_dim2;
             // Not for now, else rho is incremented twice. Here and dynamics. Must add restartRhoJs and manage independantly diags output
             //b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(bin_start) : &(*EMfields->rho_)(bin_start);
-            b_rho = &(*EMfields->rho_)(bin_start);
+            ProjectionBuffer b_rho( EMfields->rho_, bin_start, b_dim );
 
             for (unsigned int iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                (*Proj)(b_rho, (*particles), iPart, ibin*clrw, b_dim);
+                (*Proj)(b_rho.data(), (*particles), iPart, ibin*clrw, b_dim);
 
             } //End loop on particles
         }//End loop on bins
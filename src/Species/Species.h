@@ -17,6 +17,7 @@
 #include "RadiationTables.h"
 #include "MultiphotonBreitWheeler.h"
 #include "MultiphotonBreitWheelerTables.h"
+#include "Projector.h"
 
 class ElectroMagn;
 class Pusher;
@@ -188,11 +189,6 @@ public:
     //! Oversize (copy from Params)
     std::vector<unsigned int> oversize;
     
-    //! MPI structure to exchange particles
-    std::vector<MPI_Datatype> typePartSend ;
-    std::vector<MPI_Datatype> typePartRecv ;
-    MPI_Datatype exchangePatch;
-    
     //! Cell_length (copy from Params)
     std::vector<double> cell_length;
     //! min_loc_vec (copy from picparams)
@@ -429,6 +425,13 @@ private:
     //! Local minimum of MPI domain
     double min_loc;
 
+    //! Particle dynamics (push, boundary conditions, projection) with one OpenMP task per bin, the currents of each bin
+    //! being projected on a private tile and reduced afterwards (Main.cluster_tasks). Returns the energy lost at boundaries
+    double dynamicsTasks(ElectroMagn* EMfields, Projector* Proj, Params &params, bool diag_flag,
+                         PartWalls* partWalls, Patch* patch, SmileiMPI* smpi, unsigned int ispec);
+    //! Tiles of the bins in dynamicsTasks, kept from one timestep to the next to reuse their buffers
+    std::vector<ProjectionTile> tiles_;
+
     //! Samples npoints values of energies in a Maxwell-Juttner distribution
     std::vector<double> maxwellJuttner(unsigned int npoints, double temperature);
     //! Array used in the Maxwell-Juttner sampling (see doc)
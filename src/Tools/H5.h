@@ -12,6 +12,13 @@
 #include <vector>
 #include "Tools.h"
 
+//! HDF5 memory type of the arrays of the fields (see field_t)
+#ifdef SMILEI_FLOAT_FIELDS
+#define SMILEI_H5T_FIELD H5T_NATIVE_FLOAT
+#else
+#define SMILEI_H5T_FIELD H5T_NATIVE_DOUBLE
+#endif
+
 class DividedString {
 public:
     DividedString( unsigned int w ) : width(std::max(w,(unsigned int)1)), numstr(0), str("") {};
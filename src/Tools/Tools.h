@@ -103,6 +103,16 @@ if (__i==__rk) {std::cout << "Proc [" << __i << "] " <<__txt << std::endl;} MPI_
 
 #endif // __DEBUG
 
+//! Floating point type of the arrays of the fields, and the corresponding MPI datatype
+//! (single precision if compiled with config=float_fields, double precision by default)
+#ifdef SMILEI_FLOAT_FIELDS
+typedef float field_t;
+#define SMILEI_MPI_FIELD MPI_FLOAT
+#else
+typedef double field_t;
+#define SMILEI_MPI_FIELD MPI_DOUBLE
+#endif
+
 class Tools {
 public:
     static void printMemFootPrint(std::string tag);
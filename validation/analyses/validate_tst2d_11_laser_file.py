@@ -0,0 +1,23 @@
+import os, re, numpy as np, math
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+
+
+# ENERGY OF THE FIELDS
+Uelm = S.Scalar.Uelm().getData()
+Validate("Uelm vs time", Uelm, 1e-6)
+
+# PULSE FROM THE FILE WITH SEVERAL TIME SLABS, INTERPOLATED IN TIME
+By = S.Probe.Probe0.By().getData()
+Bz = S.Probe.Probe0.Bz().getData()
+Validate("By near xmin vs time", By, 1e-6)
+Validate("Bz near xmin vs time", Bz, 1e-6)
+
+# FILE WITH A SINGLE TIME SLAB : NOTHING BEFORE time_start, THEN CONSTANT IN TIME
+times = np.array(S.Probe.Probe1.By().getTimes())
+By = np.array(S.Probe.Probe1.By().getData())
+Validate("No field near xmax before time_start", np.all(By[times<6.]==0.))
+Validate("Field near xmax after time_start", np.max(np.abs(By[times>8.]))>0.01)
+Validate("By near xmax vs time", By, 1e-6)
@@ -0,0 +1,17 @@
+import os, re, numpy as np, math
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+
+
+# ENERGY OF THE FIELDS
+Uelm = np.array(S.Scalar.Uelm().getData())
+Validate("Uelm vs time", Uelm, 1e-6)
+
+# ENERGY REFLECTED BY THE PML AT t_measure, COMPARED TO THE SILVER-MULLER REFLECTION AT THE SAME ANGLE
+angle = S.namelist.angle
+reflected = Uelm[-1] / Uelm.max()
+silver_muller = ((1.-math.cos(angle))/(1.+math.cos(angle)))**2
+Validate("Reflected energy fraction", reflected, 1e-5)
+Validate("PML reflects less than silver-muller", reflected < 0.8*silver_muller)
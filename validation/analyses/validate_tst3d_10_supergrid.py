@@ -0,0 +1,26 @@
+import os, re, numpy as np, math
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+
+
+# THE FIELDS OF THE PATCHES ARE GATHERED IN ONE GRID PER MPI PROCESS
+with open("./restart000/smilei_exe.out") as f:
+	log = f.read()
+Validate("Fields gathered in one grid", re.search("Fields gathered in one grid by [1-9]", log) is not None)
+
+# ENERGIES
+Uelm = S.Scalar.Uelm().getData()
+Validate("Uelm vs time", Uelm, 1e-6)
+Ukin = S.Scalar.Ukin().getData()
+Validate("Ukin vs time", Ukin, 1e-6)
+
+# TEST THAT Ubal_norm STAYS OK
+max_ubal_norm = np.max( np.abs(S.Scalar.Ubal_norm().getData()) )
+Validate("Max Ubal_norm is below 10%", max_ubal_norm<.1 )
+
+# FIELDS ALONG X, ACROSS THE BORDERS BETWEEN THE PATCHES
+for field in ["Ey", "Ez", "Bx", "By", "Bz", "Jy", "Rho"]:
+	data = S.Probe.Probe0(field, timesteps=200).getData()[0]
+	Validate(field+" along x at iteration 200", data, 1e-6)